@@ -0,0 +1,70 @@
+//==============================================================
+// Filename : AdamsBashforthMoultonNumericalIntegration.cpp
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class for Adams-Bashforth-Moulton (4th order) 
+//				 predictor-corrector numerical integration - source
+//==============================================================
+
+// Libraries
+#include "AdamsBashforthMoultonNumericalIntegration.h"
+#include <algorithm>
+
+// Constructor
+AdamsBashforthMoultonNumericalIntegration::AdamsBashforthMoultonNumericalIntegration(double timeStep) : NumericalIntegrationProperties(timeStep) {}
+
+
+// Setters (history)
+/**
+ *	Sets the largest change of a control input between two steps for which the derivative history is kept;
+ *	a larger change is treated as a discontinuity and restarts the method (default zero: any change restarts)
+ *
+ *	@param	restartTolerance : absolute tolerance on the change of each control input
+ */
+void AdamsBashforthMoultonNumericalIntegration::setRestartTolerance(double restartTolerance) {
+	m_restartTolerance = restartTolerance;
+}
+
+/**
+ *	Discards the derivative history, such that the next steps bootstrap again with RK4
+ */
+void AdamsBashforthMoultonNumericalIntegration::resetHistory() {
+	m_history.historyLength = 0;
+	m_history.lastDerivativeValid = false;
+}
+
+/**
+ *	Restores the derivative history saved with getHistory(), without allocating; only the part of the storage in use is
+ *	copied (none without history). A history whose sizes exceed the fixed-size storage, or whose length or ring position
+ *	is out of range, is discarded (the next steps bootstrap again).
+ *
+ *	@param	history : the saved history
+ */
+void AdamsBashforthMoultonNumericalIntegration::setHistory(const AdamsBashforthMoultonHistory& history) {
+	if ((history.stateSize > history.lastStateVector.size()) || (history.controlSize > history.lastControlVector.size()) || (history.historyLength < 0)
+		|| (history.historyLength > 4) || (history.historyIndex < 0) || (history.historyIndex > 3)) {
+		resetHistory();
+		m_history.numberOfRestarts = history.numberOfRestarts;
+		return;
+	}
+
+	// Storage in use
+	const std::size_t n = history.stateSize;
+	const std::size_t m = history.controlSize;
+	if (history.historyLength > 0) {
+		std::copy_n(history.derivativeHistory.begin(), 4 * n, m_history.derivativeHistory.begin());
+		std::copy_n(history.lastStateVector.begin(), n, m_history.lastStateVector.begin());
+		std::copy_n(history.lastControlVector.begin(), m, m_history.lastControlVector.begin());
+	}
+
+	// Sizes, ring and last step
+	m_history.stateSize = n;
+	m_history.controlSize = m;
+	m_history.historyLength = history.historyLength;
+	m_history.historyIndex = history.historyIndex;
+	m_history.lastDerivativeValid = history.lastDerivativeValid;
+	m_history.lastDynamicsType = history.lastDynamicsType;
+	m_history.lastTimeStep = history.lastTimeStep;
+	m_history.numberOfRestarts = history.numberOfRestarts;
+}
\ No newline at end of file
@@ -0,0 +1,254 @@
+//==============================================================
+// Filename : AdamsBashforthMoultonNumericalIntegration.h
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class for Adams-Bashforth-Moulton (4th order) 
+//				 predictor-corrector numerical integration - header
+//==============================================================
+
+// [BEGIN]: Prevent multiple inclusions of header
+#ifndef ADAMSBASHFORTHMOULTONNUMERICALINTEGRATION_H
+#define ADAMSBASHFORTHMOULTONNUMERICALINTEGRATION_H
+
+
+// Libraries
+#include "NumericalIntegrationProperties.h"
+#include "DenseOutputNumericalIntegration.h"
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+// Derivative history in fixed-size storage, for state vectors of up to nine elements and control vectors of up to two
+// (the storage of the integrator itself, see getHistory())
+struct AdamsBashforthMoultonHistory {
+	std::array<double, 4 * 9> derivativeHistory{};	// Ring of four derivatives, each of [stateSize] elements
+	std::array<double, 9> lastStateVector{};
+	std::array<double, 2> lastControlVector{};
+	std::size_t stateSize = 0;
+	std::size_t controlSize = 0;
+	int historyLength = 0;							// Zero --> no history (the next step bootstraps)
+	int historyIndex = 0;
+	bool lastDerivativeValid = false;
+	bool lastDynamicsType = false;
+	double lastTimeStep = 0;
+	int numberOfRestarts = 0;
+};
+
+// AdamsBashforthMoultonNumericalIntegration-class
+class AdamsBashforthMoultonNumericalIntegration : public virtual NumericalIntegrationProperties, public virtual DenseOutputNumericalIntegration {
+public:
+	// Constructor (default)
+	AdamsBashforthMoultonNumericalIntegration() = default;
+
+	// Constructor (with arguments)
+	AdamsBashforthMoultonNumericalIntegration(double timeStep);
+
+
+	// Getters (history)
+	int getHistoryLength() const { return m_history.historyLength; }	// Number of stored derivatives (0 - 4)
+	int getNumberOfRestarts() const { return m_history.numberOfRestarts; }
+	double getRestartTolerance() const { return m_restartTolerance; }
+	void getHistory(AdamsBashforthMoultonHistory& history) const { history = m_history; }
+	const AdamsBashforthMoultonHistory& getHistory() const { return m_history; }
+
+
+	// Setters (history)
+	void setRestartTolerance(double);
+	void resetHistory();
+	void setHistory(const AdamsBashforthMoultonHistory&);
+
+
+	// Calculate (step)
+	template <typename Function, typename OutputFunction, typename State, typename Control, typename Parameters>
+	void calculateStep(Function&&, OutputFunction&&, const State&, const Control&, const Parameters&, bool, State&);
+
+private:
+	// Attributes (history); fixed-size storage, such that a step does not allocate and saving/restoring it is a plain copy.
+	// Last four derivatives f(n), f(n-1), f(n-2), f(n-3) stored as a ring (f(n) at historyIndex), the state and control
+	// vector the last step ended in, and whether f(n) belongs to the last state (evaluated by the corrector)
+	AdamsBashforthMoultonHistory m_history;
+
+	// Attributes (restart)
+	double m_restartTolerance = 0;	// Largest change of a control input that keeps the history
+
+	// Helper functions for calculateStep()
+	double* getDerivative(int age) { return &m_history.derivativeHistory[((m_history.historyIndex + 4 - age) % 4) * m_history.stateSize]; } // age 0 --> f(n)
+	template <typename State, typename Control>
+	bool isHistoryValid(const State&, const Control&, bool);
+	template <typename Function, typename OutputFunction, typename State, typename Control, typename Parameters>
+	void calculateRungeKuttaFourStep(Function&&, OutputFunction&&, const State&, const double*, const Control&, const Parameters&, bool, State&);
+};
+
+
+// Calculate (step)
+/**
+ * Computes the integration of the derivative function using the 4th order Adams-Bashforth-Moulton predictor-corrector
+ * method in PECE-form, with the output vector recomputed from every evaluated state:
+ *
+ *		P: x_p = x_n + (h/24) * (55*f(n) - 59*f(n-1) + 37*f(n-2) - 9*f(n-3))
+ *		E: f_p = f(x_p)
+ *		C: x_next = x_n + (h/24) * (9*f_p + 19*f(n) - 5*f(n-1) + f(n-2))
+ *		E: f(n+1) = f(x_next)			(kept for the next step)
+ *
+ * This costs two derivative evaluations per step instead of four (RK4). The past derivatives are kept in the object;
+ * until four are available (first steps and after a restart), RK4-steps are taken. The history is restarted when the
+ * time step or dynamics type changes, when a control input changes by more than the restart tolerance (a discontinuity
+ * that the past derivatives do not describe), or when the state vector is not the one the last step ended in.
+ * The dense output of the step (cubic Hermite with the derivatives at both ends) is saved, see DenseOutputNumericalIntegration.
+ *
+ * @param	function : the derivative function --> this function must adhere a [ f(x,u,y,P,n,xDot) ] format
+ * @param	outputFunction : computes the output vector from a state vector --> [ y = g(x) ] format
+ * @param	stateVector : the current state vector of the system
+ * @param	controlVector : the current control vector
+ * @param	parametersList : array containing all necessary parameters to compute the derivative equation
+ * @param	dynamicsType : specifies the dynamics type to be used of the system
+ * @param	nextStateVector : array the integrated result of the derivative function is written to (may alias stateVector)
+ */
+template <typename Function, typename OutputFunction, typename State, typename Control, typename Parameters>
+void AdamsBashforthMoultonNumericalIntegration::calculateStep(Function&& function, OutputFunction&& outputFunction, const State& stateVector, const Control& controlVector,
+															  const Parameters& parameterList, bool dynamicsType, State& nextStateVector)
+{
+	// Initialize variables
+	const std::size_t n = stateVector.size();
+	const std::size_t m = controlVector.size();
+	const double timeStep = getTimeStep();
+	State dynamicsStateVector{}, stateVectorK{}, x = stateVector;
+
+	// State or control vector exceeding the storage of the history: RK4 step, no history
+	if ((n > m_history.lastStateVector.size()) || (m > m_history.lastControlVector.size())) {
+		function(x, controlVector, outputFunction(x), parameterList, dynamicsType, dynamicsStateVector);
+		calculateRungeKuttaFourStep(function, outputFunction, stateVector, &dynamicsStateVector[0], controlVector, parameterList, dynamicsType, nextStateVector);
+		return;
+	}
+
+	// Restart history if it does not describe this step
+	if (!isHistoryValid(stateVector, controlVector, dynamicsType)) {
+		if (m_history.historyLength > 0) { m_history.numberOfRestarts++; }
+		m_history.stateSize = n;
+		m_history.controlSize = m;
+		m_history.historyLength = 0;
+		m_history.lastDerivativeValid = false;
+	}
+
+	// Derivative at current state (f(n)), unless already evaluated by the corrector of the last step
+	if (!m_history.lastDerivativeValid) {
+		function(x, controlVector, outputFunction(x), parameterList, dynamicsType, dynamicsStateVector);
+		m_history.historyIndex = (m_history.historyIndex + 1) % 4;
+		for (std::size_t i = 0; i < n; i++) { getDerivative(0)[i] = dynamicsStateVector[i]; }
+		m_history.historyLength = (m_history.historyLength < 4) ? m_history.historyLength + 1 : 4;
+	}
+
+	if (m_history.historyLength < 4) { // Bootstrap with RK4 (f(n) is K1)
+		calculateRungeKuttaFourStep(function, outputFunction, stateVector, getDerivative(0), controlVector, parameterList, dynamicsType, x);
+		m_history.lastDerivativeValid = false;
+	}
+	else { // Adams-Bashforth-Moulton (PECE)
+		const double* f0 = getDerivative(0);
+		const double* f1 = getDerivative(1);
+		const double* f2 = getDerivative(2);
+		const double* f3 = getDerivative(3);
+
+		// Predict (Adams-Bashforth) and evaluate
+		for (std::size_t i = 0; i < n; i++) { stateVectorK[i] = x[i] + (timeStep / 24) * (55 * f0[i] - 59 * f1[i] + 37 * f2[i] - 9 * f3[i]); }
+		function(stateVectorK, controlVector, outputFunction(stateVectorK), parameterList, dynamicsType, dynamicsStateVector);
+
+		// Correct (Adams-Moulton)
+		for (std::size_t i = 0; i < n; i++) { x[i] = x[i] + (timeStep / 24) * (9 * dynamicsStateVector[i] + 19 * f0[i] - 5 * f1[i] + f2[i]); }
+
+		// Evaluate at corrected state (becomes f(n) of the next step; f(n-3) is dropped)
+		function(x, controlVector, outputFunction(x), parameterList, dynamicsType, dynamicsStateVector);
+		m_history.historyIndex = (m_history.historyIndex + 1) % 4;
+		for (std::size_t i = 0; i < n; i++) { getDerivative(0)[i] = dynamicsStateVector[i]; }
+		m_history.lastDerivativeValid = true;
+
+		// Save dense output (f0 still holds the derivative at the start of the step)
+		setDenseOutput(stateVector, f0, x, dynamicsStateVector, timeStep);
+	}
+
+	// Save step for the next call
+	for (std::size_t i = 0; i < n; i++) { m_history.lastStateVector[i] = x[i]; }
+	for (std::size_t i = 0; i < m; i++) { m_history.lastControlVector[i] = controlVector[i]; }
+	m_history.lastDynamicsType = dynamicsType;
+	m_history.lastTimeStep = timeStep;
+
+	// Construct final state vector
+	nextStateVector = x;
+}
+
+/**
+ * Checks whether the stored history belongs to the step that is about to be taken
+ *
+ * @param	stateVector : the current state vector of the system
+ * @param	controlVector : the current control vector
+ * @param	dynamicsType : specifies the dynamics type to be used of the system
+ * @return	A type (bool) which is true if the history can be continued
+ */
+template <typename State, typename Control>
+bool AdamsBashforthMoultonNumericalIntegration::isHistoryValid(const State& stateVector, const Control& controlVector, bool dynamicsType) {
+	// No history, or history of a different system/step
+	if ((m_history.historyLength == 0) || (m_history.stateSize != stateVector.size()) || (m_history.controlSize != controlVector.size())
+		|| (dynamicsType != m_history.lastDynamicsType) || (getTimeStep() != m_history.lastTimeStep)) {
+		return false;
+	}
+
+	// State was changed outside of the integrator
+	for (std::size_t i = 0; i < stateVector.size(); i++) {
+		if (stateVector[i] != m_history.lastStateVector[i]) { return false; }
+	}
+
+	// Control changed discontinuously
+	for (std::size_t i = 0; i < controlVector.size(); i++) {
+		if (std::fabs(controlVector[i] - m_history.lastControlVector[i]) > m_restartTolerance) { return false; }
+	}
+
+	return true;
+}
+
+/**
+ * Takes an RK4-step from the derivative at the start of the step (K1), and saves its dense output
+ *
+ * @param	function : the derivative function
+ * @param	outputFunction : computes the output vector from a state vector
+ * @param	stateVector : the current state vector of the system
+ * @param	K1 : the derivative at the current state
+ * @param	controlVector : the current control vector
+ * @param	parametersList : array containing all necessary parameters to compute the derivative equation
+ * @param	dynamicsType : specifies the dynamics type to be used of the system
+ * @param	nextStateVector : array the next state is written to (may alias stateVector)
+ */
+template <typename Function, typename OutputFunction, typename State, typename Control, typename Parameters>
+void AdamsBashforthMoultonNumericalIntegration::calculateRungeKuttaFourStep(Function&& function, OutputFunction&& outputFunction, const State& stateVector, const double* K1,
+																			const Control& controlVector, const Parameters& parameterList, bool dynamicsType, State& nextStateVector)
+{
+	// Initialize variables
+	const std::size_t n = stateVector.size();
+	const double timeStep = getTimeStep();
+	State K2{}, K3{}, K4{}, stateVectorK{}, x = stateVector;
+
+	// Compute K2 --> f(x + [K1 * (h/2)])
+	for (std::size_t i = 0; i < n; i++) { stateVectorK[i] = x[i] + K1[i] * (timeStep / 2); }
+	function(stateVectorK, controlVector, outputFunction(stateVectorK), parameterList, dynamicsType, K2);
+
+	// Compute K3 --> f(x + [K2 * (h/2)])
+	for (std::size_t i = 0; i < n; i++) { stateVectorK[i] = x[i] + K2[i] * (timeStep / 2); }
+	function(stateVectorK, controlVector, outputFunction(stateVectorK), parameterList, dynamicsType, K3);
+
+	// Compute K4 --> f(x + [K3 * h])
+	for (std::size_t i = 0; i < n; i++) { stateVectorK[i] = x[i] + K3[i] * timeStep; }
+	function(stateVectorK, controlVector, outputFunction(stateVectorK), parameterList, dynamicsType, K4);
+
+	// Sum to construct final state vector
+	for (std::size_t i = 0; i < n; i++) {
+		x[i] = x[i] + K1[i] * (timeStep / 6) + K2[i] * (timeStep / 3) + K3[i] * (timeStep / 3) + K4[i] * (timeStep / 6);
+	}
+
+	// Save dense output (cubic Hermite with K1 and K4 as derivatives)
+	setDenseOutput(stateVector, K1, x, K4, timeStep);
+
+	// Construct final state vector
+	nextStateVector = x;
+}
+
+// [END]: Prevent multiple inclusions of header
+#endif
\ No newline at end of file
@@ -15,6 +15,7 @@
 // Libraries
 #include "CargoProperties.h"
 #include "GravitationalConstants.h"
+#include <cstddef>
 #include <vector>
 
 // CargoDynamics-class
@@ -33,18 +34,20 @@ public:
 	double getYCargo() const { return m_cargoStateVector[1]; }
 	double getXDotCargo() const { return m_cargoStateVector[2]; }
 	double getYDotCargo() const { return m_cargoStateVector[3]; }
+	std::size_t getCargoStateRevision() const { return m_cargoStateRevision; } // Changes with every change of the state vector
 
 
 	// Setters
 	void setCargoStateVector(std::vector<double>); // Main
-	void setXCargo(double);
-	void setYCargo(double);
-	void setXDotCargo(double);
-	void setYDotCargo(double);
+	void setXCargo(double xCargo) { m_cargoStateVector[0] = xCargo; m_cargoStateRevision++; }
+	void setYCargo(double yCargo) { m_cargoStateVector[1] = yCargo; m_cargoStateRevision++; }
+	void setXDotCargo(double xDotCargo) { m_cargoStateVector[2] = xDotCargo; m_cargoStateRevision++; }
+	void setYDotCargo(double yDotCargo) { m_cargoStateVector[3] = yDotCargo; m_cargoStateRevision++; }
 
 private:
 	// Attributes
 	std::vector<double> m_cargoStateVector = { 0, 0, 0, 0 }; // x6 - x9
+	std::size_t m_cargoStateRevision = 0;
 };
 
 
@@ -0,0 +1,40 @@
+//==============================================================
+// Filename : DenseOutputNumericalIntegration.cpp
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class for dense output (continuous extension)
+//				 of the last integration step - source
+//==============================================================
+
+// Libraries
+#include "DenseOutputNumericalIntegration.h"
+#include <algorithm>
+
+
+// Setters (dense output)
+/**
+ *	Discards the dense output of the last step (e.g. after the state was changed outside of the integrator)
+ */
+void DenseOutputNumericalIntegration::resetDenseOutput() {
+	m_denseOutput.timeStep = 0;
+}
+
+/**
+ *	Restores the dense output saved with getDenseOutputHistory(), without allocating; only the coefficients in use are
+ *	copied (none without dense output). Dense output of a state vector exceeding the fixed-size storage is discarded.
+ *
+ *	@param	denseOutputHistory : the saved dense output
+ */
+void DenseOutputNumericalIntegration::setDenseOutputHistory(const DenseOutputHistory& denseOutputHistory) {
+	if (denseOutputHistory.stateSize > denseOutputHistory.coefficients.size() / 5) {
+		resetDenseOutput();
+		return;
+	}
+
+	if (denseOutputHistory.timeStep > 0) {
+		std::copy_n(denseOutputHistory.coefficients.begin(), 5 * denseOutputHistory.stateSize, m_denseOutput.coefficients.begin());
+	}
+	m_denseOutput.stateSize = denseOutputHistory.stateSize;
+	m_denseOutput.timeStep = denseOutputHistory.timeStep;
+}
\ No newline at end of file
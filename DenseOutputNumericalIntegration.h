@@ -0,0 +1,159 @@
+//==============================================================
+// Filename : DenseOutputNumericalIntegration.h
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class for dense output (continuous extension)
+//				 of the last integration step - header
+//==============================================================
+
+// [BEGIN]: Prevent multiple inclusions of header
+#ifndef DENSEOUTPUTNUMERICALINTEGRATION_H
+#define DENSEOUTPUTNUMERICALINTEGRATION_H
+
+
+// Libraries
+#include <array>
+#include <cstddef>
+
+// Dense output of the last step in fixed-size storage, for state vectors of up to nine elements (the storage of the
+// integrator itself, see getDenseOutputHistory())
+struct DenseOutputHistory {
+	std::array<double, 5 * 9> coefficients{};	// r1 - r5, each of [stateSize] elements
+	std::size_t stateSize = 0;
+	double timeStep = 0;						// Zero --> no dense output available
+};
+
+// DenseOutputNumericalIntegration-class
+class DenseOutputNumericalIntegration {
+public:
+	// Constructor (default)
+	DenseOutputNumericalIntegration() = default;
+
+	// Destructor (virtual)
+	virtual ~DenseOutputNumericalIntegration() {}
+
+
+	// Getters (dense output)
+	bool hasDenseOutput() const { return m_denseOutput.timeStep > 0; }
+	double getDenseTimeStep() const { return m_denseOutput.timeStep; } // Length of the step the dense output belongs to
+	void getDenseOutputHistory(DenseOutputHistory& denseOutputHistory) const { denseOutputHistory = m_denseOutput; }
+	const DenseOutputHistory& getDenseOutputHistory() const { return m_denseOutput; }
+
+
+	// Setters (dense output)
+	void resetDenseOutput();
+	void setDenseOutputHistory(const DenseOutputHistory&);
+
+
+	// Calculate (dense output)
+	template <typename State>
+	void calculateDenseOutput(double, State&) const;
+
+protected:
+	// Setters (dense output); called by the integrators at the end of a step
+	template <typename State, typename StartDerivative, typename EndDerivative>
+	void setDenseOutput(const State&, const StartDerivative&, const State&, const EndDerivative&, double);
+	template <typename State, typename StartDerivative, typename EndDerivative, typename Coefficient>
+	void setDenseOutput(const State&, const StartDerivative&, const State&, const EndDerivative&, const Coefficient&, double);
+
+private:
+	// Attributes (dense output); fixed-size storage of the five coefficient vectors r1 - r5 (see calculateDenseOutput()),
+	// such that a step does not allocate and saving/restoring it is a plain copy
+	DenseOutputHistory m_denseOutput;
+};
+
+
+// Calculate (dense output)
+/**
+ * Computes the state at a fraction of the last step from the saved coefficients, without evaluating the derivative:
+ *
+ *		x(t0 + s*h) = r1 + s * (r2 + (1 - s) * (r3 + s * (r4 + (1 - s) * r5)))
+ *
+ * With r5 = 0 this is the cubic Hermite interpolant of the states and derivatives at the start and end of the step.
+ *
+ * @param	timeFraction : the fraction s of the last step, in [0, 1]
+ * @param	stateVector : array the interpolated state vector is written to
+ */
+template <typename State>
+void DenseOutputNumericalIntegration::calculateDenseOutput(double timeFraction, State& stateVector) const
+{
+	// Initialize variables
+	const double s = timeFraction;
+	const double t = 1 - timeFraction;
+	const std::size_t n = m_denseOutput.stateSize;
+	const double* r = m_denseOutput.coefficients.data();
+
+	// Evaluate polynomial
+	for (std::size_t i = 0; i < n; i++) {
+		stateVector[i] = r[i] + s * (r[n + i] + t * (r[2 * n + i] + s * (r[3 * n + i] + t * r[4 * n + i])));
+	}
+}
+
+
+// Setters (dense output)
+/**
+ * Saves the dense output of a step as the cubic Hermite interpolant, matching the state and derivative at its start and end:
+ *
+ *		r1 = x0,   r2 = x1 - x0,   r3 = h * f0 - r2,   r4 = r2 - h * f1 - r3,   r5 = 0
+ *
+ * For Euler (f1 = f0, x1 = x0 + h * f0) this reduces to linear interpolation. RK4 uses f0 = K1 and f1 = K4; K4 is evaluated at
+ * the predictor x0 + h * K3, so it only approximates the derivative at the end of the step and the interpolant is not a
+ * continuous extension of the method with a guaranteed order. It needs no additional derivative evaluations and is far more
+ * accurate than linear interpolation inside the step (see unitTest_denseOutput).
+ *
+ * @param	stateVector : the state vector at the start of the step
+ * @param	startDynamicsVector : the derivative at the start of the step
+ * @param	nextStateVector : the state vector at the end of the step
+ * @param	endDynamicsVector : the derivative (or an approximation of it) at the end of the step
+ * @param	timeStep : the length of the step [s]
+ */
+template <typename State, typename StartDerivative, typename EndDerivative>
+void DenseOutputNumericalIntegration::setDenseOutput(const State& stateVector, const StartDerivative& startDynamicsVector, const State& nextStateVector,
+													 const EndDerivative& endDynamicsVector, double timeStep)
+{
+	// No fifth coefficient
+	struct ZeroCoefficient { double operator[](std::size_t) const { return 0; } };
+
+	// Save
+	setDenseOutput(stateVector, startDynamicsVector, nextStateVector, endDynamicsVector, ZeroCoefficient{}, timeStep);
+}
+
+/**
+ * Saves the dense output of a step as the cubic Hermite interpolant plus a fifth coefficient vector (r5, see
+ * calculateDenseOutput()), as used by the continuous extension of Dormand-Prince.
+ *
+ * @param	stateVector : the state vector at the start of the step
+ * @param	startDynamicsVector : the derivative at the start of the step
+ * @param	nextStateVector : the state vector at the end of the step
+ * @param	endDynamicsVector : the derivative at the end of the step
+ * @param	fifthCoefficient : the coefficient vector r5
+ * @param	timeStep : the length of the step [s]
+ */
+template <typename State, typename StartDerivative, typename EndDerivative, typename Coefficient>
+void DenseOutputNumericalIntegration::setDenseOutput(const State& stateVector, const StartDerivative& startDynamicsVector, const State& nextStateVector,
+													 const EndDerivative& endDynamicsVector, const Coefficient& fifthCoefficient, double timeStep)
+{
+	// State vector exceeding the storage: no dense output
+	const std::size_t n = stateVector.size();
+	if (5 * n > m_denseOutput.coefficients.size()) {
+		resetDenseOutput();
+		return;
+	}
+
+	// Compute coefficients
+	double* r = m_denseOutput.coefficients.data();
+	for (std::size_t i = 0; i < n; i++) {
+		r[i] = stateVector[i];
+		r[n + i] = nextStateVector[i] - stateVector[i];
+		r[2 * n + i] = timeStep * startDynamicsVector[i] - r[n + i];
+		r[3 * n + i] = r[n + i] - timeStep * endDynamicsVector[i] - r[2 * n + i];
+		r[4 * n + i] = fifthCoefficient[i];
+	}
+	m_denseOutput.stateSize = n;
+	m_denseOutput.timeStep = timeStep;
+}
+
+
+// [END]: Prevent multiple inclusions of header
+#endif
\ No newline at end of file
@@ -0,0 +1,49 @@
+//==============================================================
+// Filename : DormandPrinceNumericalIntegration.cpp
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class for adaptive-step Dormand-Prince (RK45)
+//				 numerical integration - source
+//==============================================================
+
+// Libraries
+#include "DormandPrinceNumericalIntegration.h"
+
+// Constructor
+DormandPrinceNumericalIntegration::DormandPrinceNumericalIntegration(double absoluteTolerance, double relativeTolerance) {
+	// Set attributes
+	setTolerances(absoluteTolerance, relativeTolerance);
+}
+
+
+// Setters (tolerances)
+/**
+ *	Sets the tolerances of the local error estimate; a step is accepted if the scaled error
+ *	|e_i| / (absoluteTolerance + relativeTolerance * |x_i|) is at most one (RMS over all states)
+ *
+ *	@param	absoluteTolerance : absolute tolerance on each state; must be larger than zero (otherwise ignored)
+ *	@param	relativeTolerance : relative tolerance on each state; must be larger than zero (otherwise ignored)
+ */
+void DormandPrinceNumericalIntegration::setTolerances(double absoluteTolerance, double relativeTolerance) { // Main
+	setAbsoluteTolerance(absoluteTolerance);
+	setRelativeTolerance(relativeTolerance);
+}
+
+void DormandPrinceNumericalIntegration::setAbsoluteTolerance(double absoluteTolerance) {
+	if (absoluteTolerance > 0) {
+		m_absoluteTolerance = absoluteTolerance;
+	}
+}
+
+void DormandPrinceNumericalIntegration::setRelativeTolerance(double relativeTolerance) {
+	if (relativeTolerance > 0) {
+		m_relativeTolerance = relativeTolerance;
+	}
+}
+
+
+// Setters (internal step)
+void DormandPrinceNumericalIntegration::setInternalTimeStep(double internalTimeStep) {
+	m_internalTimeStep = internalTimeStep;
+}
\ No newline at end of file
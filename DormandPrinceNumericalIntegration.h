@@ -0,0 +1,215 @@
+//==============================================================
+// Filename : DormandPrinceNumericalIntegration.h
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class for adaptive-step Dormand-Prince (RK45)
+//				 numerical integration - header
+//==============================================================
+
+// [BEGIN]: Prevent multiple inclusions of header
+#ifndef DORMANDPRINCENUMERICALINTEGRATION_H
+#define DORMANDPRINCENUMERICALINTEGRATION_H
+
+
+// Libraries
+#include "NumericalIntegrationProperties.h"
+#include "DenseOutputNumericalIntegration.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+// Statistics of an integrated interval
+struct IntegrationStatistics {
+	int derivativeEvaluations = 0;	// Number of calls to the derivative function
+	int acceptedSteps = 0;			// Number of internal steps that met the tolerances
+	int rejectedSteps = 0;			// Number of internal steps that were retried with a smaller step
+	bool aborted = false;			// The error estimate was not finite (e.g. a NaN state); the interval was not completed
+	double integratedInterval = 0;	// Part of the interval that was integrated (the whole interval unless aborted)
+};
+
+// DormandPrinceNumericalIntegration-class
+class DormandPrinceNumericalIntegration : public virtual NumericalIntegrationProperties, public virtual DenseOutputNumericalIntegration {
+public:
+	// Constructor (default)
+	DormandPrinceNumericalIntegration() = default;
+
+	// Constructor (with arguments)
+	DormandPrinceNumericalIntegration(double absoluteTolerance, double relativeTolerance);
+
+	// Destructor (virtual)
+	virtual ~DormandPrinceNumericalIntegration() {}
+
+
+	// Getters (tolerances)
+	double getAbsoluteTolerance() const { return m_absoluteTolerance; }
+	double getRelativeTolerance() const { return m_relativeTolerance; }
+
+	// Getters (internal step)
+	double getInternalTimeStep() const { return m_internalTimeStep; }
+
+
+	// Setters (tolerances); larger than zero
+	void setTolerances(double, double);
+	void setAbsoluteTolerance(double);
+	void setRelativeTolerance(double);
+
+	// Setters (internal step)
+	void setInternalTimeStep(double);
+
+
+	// Calculate (interval)
+	template <typename Function, typename OutputFunction, typename State, typename Control, typename Parameters>
+	IntegrationStatistics calculateInterval(Function&&, OutputFunction&&, const State&, const Control&, const Parameters&, bool, double, State&);
+
+private:
+	// Attributes (tolerances)
+	double m_absoluteTolerance = 1e-6;
+	double m_relativeTolerance = 1e-6;
+
+	// Attributes (internal step); carried over between intervals, zero means "not yet known"
+	double m_internalTimeStep = 0;
+};
+
+
+// Calculate (interval)
+/**
+ * Integrates the derivative function over a requested interval using the embedded Dormand-Prince 5(4) pair.
+ * The internal step is adapted such that the estimated local error stays within the absolute/relative tolerances;
+ * the last accepted step is kept as initial guess for the next interval. The output vector is recomputed from
+ * every stage state with the output function, since it is not constant over an interval. The dense output of the
+ * last accepted internal step (continuous extension of Dormand-Prince, fourth order) is saved, see DenseOutputNumericalIntegration.
+ * If the error estimate of a step is not finite (NaN or infinite stages), the step can neither be accepted nor made
+ * smaller in a meaningful way: the interval is aborted at the last accepted step (see IntegrationStatistics).
+ *
+ * @param	function : the derivative function --> this function must adhere a [ f(x,u,y,P,n,xDot) ] format
+ * @param	outputFunction : computes the output vector from a state vector --> [ y = g(x) ] format
+ * @param	stateVector : the state vector of the system at the start of the interval
+ * @param	controlVector : the control vector (held constant over the interval)
+ * @param	parametersList : array containing all necessary parameters to compute the derivative equation
+ * @param	dynamicsType : specifies the dynamics type to be used of the system
+ * @param	interval : the length of the interval to advance [s]; nothing is integrated unless positive
+ * @param	nextStateVector : array the state at the end of the integrated part is written to (may alias stateVector)
+ * @return	A (IntegrationStatistics) containing the number of derivative evaluations, accepted/rejected steps and the integrated part
+ */
+template <typename Function, typename OutputFunction, typename State, typename Control, typename Parameters>
+IntegrationStatistics DormandPrinceNumericalIntegration::calculateInterval(Function&& function, OutputFunction&& outputFunction, const State& stateVector, const Control& controlVector,
+																		   const Parameters& parameterList, bool dynamicsType, double interval, State& nextStateVector)
+{
+	/* DORMAND-PRINCE 5(4) TABLEAU (FSAL: the last stage equals the first stage of the next step) */
+	const double a21 = 1.0 / 5;
+	const double a31 = 3.0 / 40, a32 = 9.0 / 40;
+	const double a41 = 44.0 / 45, a42 = -56.0 / 15, a43 = 32.0 / 9;
+	const double a51 = 19372.0 / 6561, a52 = -25360.0 / 2187, a53 = 64448.0 / 6561, a54 = -212.0 / 729;
+	const double a61 = 9017.0 / 3168, a62 = -355.0 / 33, a63 = 46732.0 / 5247, a64 = 49.0 / 176, a65 = -5103.0 / 18656;
+	const double a71 = 35.0 / 384, a73 = 500.0 / 1113, a74 = 125.0 / 192, a75 = -2187.0 / 6784, a76 = 11.0 / 84;
+	const double e1 = 71.0 / 57600, e3 = -71.0 / 16695, e4 = 71.0 / 1920, e5 = -17253.0 / 339200, e6 = 22.0 / 525, e7 = -1.0 / 40;
+	const double d1 = -12715105075.0 / 11282082432, d3 = 87487479700.0 / 32700410799, d4 = -10690763975.0 / 1880347072,	// Dense output
+				 d5 = 701980252875.0 / 199316789632, d6 = -1453857185.0 / 822651844, d7 = 69997945.0 / 29380423;
+
+	// Initialize variables
+	IntegrationStatistics statistics{};
+	State x = stateVector;									// Accepted state
+	State K1{}, K2{}, K3{}, K4{}, K5{}, K6{}, K7{};			// Stages
+	State stateVectorK{}, candidateStateVector{};			// Stage and candidate state
+	State denseCoefficient{};								// Fifth coefficient of the dense output
+	const std::size_t n = x.size();
+	double time = 0;
+
+	// Evaluates the derivative at a stage, with the output vector recomputed from that stage
+	auto evaluate = [&](const State& stageStateVector, State& K) {
+		const auto outputVector = outputFunction(stageStateVector);
+		function(stageStateVector, controlVector, outputVector, parameterList, dynamicsType, K);
+		statistics.derivativeEvaluations++;
+	};
+
+	// Nothing to integrate (also for a NaN interval)
+	if (!(interval > 0)) {
+		nextStateVector = x;
+		return statistics;
+	}
+
+	// Initial guess of internal step
+	double h = (m_internalTimeStep > 0) ? std::min(m_internalTimeStep, interval) : std::min(getTimeStep() > 0 ? getTimeStep() : interval, interval);
+	const double minimumTimeStep = 1e-12 * interval;
+
+	// First stage
+	evaluate(x, K1);
+
+	while (time < interval) {
+		// Do not step past the end of the interval
+		const double remaining = interval - time;
+		const bool lastStep = (h >= remaining);
+		const double hStep = lastStep ? remaining : h;
+
+		/* ------------------------------------------ STAGES ------------------------------------------ */
+		for (std::size_t i = 0; i < n; i++) { stateVectorK[i] = x[i] + hStep * (a21 * K1[i]); }
+		evaluate(stateVectorK, K2);
+		for (std::size_t i = 0; i < n; i++) { stateVectorK[i] = x[i] + hStep * (a31 * K1[i] + a32 * K2[i]); }
+		evaluate(stateVectorK, K3);
+		for (std::size_t i = 0; i < n; i++) { stateVectorK[i] = x[i] + hStep * (a41 * K1[i] + a42 * K2[i] + a43 * K3[i]); }
+		evaluate(stateVectorK, K4);
+		for (std::size_t i = 0; i < n; i++) { stateVectorK[i] = x[i] + hStep * (a51 * K1[i] + a52 * K2[i] + a53 * K3[i] + a54 * K4[i]); }
+		evaluate(stateVectorK, K5);
+		for (std::size_t i = 0; i < n; i++) { stateVectorK[i] = x[i] + hStep * (a61 * K1[i] + a62 * K2[i] + a63 * K3[i] + a64 * K4[i] + a65 * K5[i]); }
+		evaluate(stateVectorK, K6);
+		for (std::size_t i = 0; i < n; i++) { candidateStateVector[i] = x[i] + hStep * (a71 * K1[i] + a73 * K3[i] + a74 * K4[i] + a75 * K5[i] + a76 * K6[i]); }
+		evaluate(candidateStateVector, K7);
+		/* -------------------------------------------------------------------------------------------- */
+
+		// Scaled RMS norm of the local error estimate
+		double errorNorm = 0;
+		for (std::size_t i = 0; i < n; i++) {
+			const double localError = hStep * (e1 * K1[i] + e3 * K3[i] + e4 * K4[i] + e5 * K5[i] + e6 * K6[i] + e7 * K7[i]);
+			const double scale = m_absoluteTolerance + m_relativeTolerance * std::max(std::fabs(x[i]), std::fabs(candidateStateVector[i]));
+			errorNorm += (localError / scale) * (localError / scale);
+		}
+		errorNorm = std::sqrt(errorNorm / n);
+
+		// Abort (a smaller step would be rejected as well, down to the minimum step)
+		if (!std::isfinite(errorNorm)) {
+			statistics.aborted = true;
+			break;
+		}
+
+		// Step size factor (safety 0.9, limited to [0.2, 5])
+		const double factor = (errorNorm == 0) ? 5.0 : std::min(5.0, std::max(0.2, 0.9 * std::pow(errorNorm, -0.2)));
+
+		if (errorNorm <= 1 || hStep <= minimumTimeStep) { // Accept
+			statistics.acceptedSteps++;
+			time = lastStep ? interval : time + hStep;
+
+			// Save dense output
+			for (std::size_t i = 0; i < n; i++) { denseCoefficient[i] = hStep * (d1 * K1[i] + d3 * K3[i] + d4 * K4[i] + d5 * K5[i] + d6 * K6[i] + d7 * K7[i]); }
+			setDenseOutput(x, K1, candidateStateVector, K7, denseCoefficient, hStep);
+
+			x = candidateStateVector;
+			K1 = K7; // FSAL
+
+			// Keep the natural step size (not the one truncated at the end of the interval)
+			if (!lastStep || hStep == h) {
+				h = hStep * factor;
+			}
+		}
+		else { // Reject and retry with a smaller step
+			statistics.rejectedSteps++;
+			h = hStep * std::max(0.2, factor);
+		}
+	}
+
+	// Save internal step for the next interval (unless aborted, then the previous guess is kept)
+	if (!statistics.aborted) {
+		m_internalTimeStep = h;
+	}
+
+	// Write result
+	statistics.integratedInterval = time;
+	nextStateVector = x;
+
+	// Return statistics
+	return statistics;
+}
+
+
+// [END]: Prevent multiple inclusions of header
+#endif
\ No newline at end of file
@@ -41,12 +41,12 @@ std::vector<double> DroneControllerControlVector::calculateReferenceControlVecto
 	std::vector<double> referenceControlVector{};
 	
 	// Compute reference control [torque] based on given properties and states of drone (+ cargo)
-	double referenceTau = calculateReferenceTau(gravitationalConstant, dynamicsType,
+	double referenceTau = calculateReferenceTau(dynamicsType, gravitationalConstant,
 												massDrone, xDrone, xDotDrone, yDrone, yDotDrone, thetaDrone,
 												massCargo, xCargo, yCargo);
 
 	// Compute reference control [rotational velocity] based on given properties and states of drone (+ cargo)
-	double referenceOmega = calculateReferenceOmega(gravitationalConstant, dynamicsType,
+	double referenceOmega = calculateReferenceOmega(dynamicsType, gravitationalConstant,
 													massDrone, xDrone, xDotDrone, yDrone, yDotDrone, thetaDrone,
 													massCargo, xCargo, yCargo);
 
@@ -83,16 +83,16 @@ double DroneControllerControlVector::calculateReferenceTau(bool dynamicsType, do
 	double referenceTau{};
 
 	// Retrieve reference force vector
-	std::vector<double> referenceForceVector = calculateReferenceForceVector(gravitationalConstant, dynamicsType,
+	std::vector<double> referenceForceVector = calculateReferenceForceVector(dynamicsType, gravitationalConstant,
 																			 massDrone, xDrone, xDotDrone, yDrone, yDotDrone,
 																			 massCargo, xCargo, yCargo);
 
-	// Compute (account for division by zero)
+	// Compute; the thrust tau * cos(theta) supplies the vertical force (account for division by zero)
 	if (cos(thetaDrone) == 0) {
 		referenceTau = 0;
 	}
 	else {
-		referenceTau = referenceForceVector[0] / cos(thetaDrone);
+		referenceTau = referenceForceVector[1] / cos(thetaDrone);
 	}
 
 	// Return value
@@ -123,7 +123,7 @@ double DroneControllerControlVector::calculateReferenceOmega(bool dynamicsType,
 {
 	// Initialize variables
 	double referenceOmega{};
-	double referenceTheta = calculateReferenceTheta(gravitationalConstant, dynamicsType, 
+	double referenceTheta = calculateReferenceTheta(dynamicsType, gravitationalConstant,
 													massDrone, xDrone, xDotDrone, yDrone, yDotDrone, 
 													massCargo, xCargo, yCargo);
 
@@ -160,7 +160,7 @@ double DroneControllerControlVector::calculateReferenceTheta(bool dynamicsType,
 	double referenceTheta{};
 
 	// Retrieve reference force vector
-	std::vector<double> referenceForceVector = calculateReferenceForceVector(gravitationalConstant, dynamicsType,
+	std::vector<double> referenceForceVector = calculateReferenceForceVector(dynamicsType, gravitationalConstant,
 																			 massDrone, xDrone, xDotDrone, yDrone, yDotDrone,
 																			 massCargo, xCargo, yCargo);
 
@@ -138,7 +138,7 @@ double DroneControllerForce::calculateCargoDampingForceComponent(double xDrone,
 	double cargoDampingForceComponent{};
 
 	// Compute
-	cargoDampingForceComponent = getOscillationDampingConstant() * (xDrone - xCargo);
+	cargoDampingForceComponent = getOscillationDampingConstant() * (xCargo - xDrone);
 
 	// Return value
 	return cargoDampingForceComponent;
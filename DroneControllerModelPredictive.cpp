@@ -0,0 +1,285 @@
+//==============================================================
+// Filename : DroneControllerModelPredictive.cpp
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class for a sampling-based model predictive
+//				 controller (MPPI) of the drone with cargo, with
+//				 the rollouts simulated in parallel - source
+//==============================================================
+
+// Libraries
+#include "DroneControllerModelPredictive.h"
+#include "SplitMix64.h"
+#include "GravitationalConstants.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+
+// Constructor
+/**
+ * Creates the controller with the model of the ROS nodes (dynamics_simulator): drone with cargo, 3 kg drone, 1.5 m
+ * rope of 40000 N/m and 50 N s/m, 2 kg cargo. The rollouts are simulated on the calling thread until a thread pool
+ * is set (see setThreadPool()).
+ */
+DroneControllerModelPredictive::DroneControllerModelPredictive() {
+	// Model
+	GravitationalConstants gravitationalConstants;
+	const ParameterArray parametersList = { gravitationalConstants.getGravitationalConstant("Earth"), 3, 0.1, 1.5, 50, 40000, 2, 0.1 }; // See parameter list convention
+	m_parameters = DynamicSystemParameters(parametersList);
+
+	// Rollouts
+	setupRollouts();
+}
+
+
+// Setters (settings)
+/**
+ * Sets the settings of the controller; memory for the rollouts is reserved and the control sequence is reset to hover
+ *
+ * @param	settings : the settings (see ModelPredictiveSettings)
+ */
+void DroneControllerModelPredictive::setSettings(const ModelPredictiveSettings& settings) {
+	m_settings = settings;
+	m_settings.numberOfRollouts = std::max<std::size_t>(m_settings.numberOfRollouts, 1);
+	m_settings.horizon = std::max<std::size_t>(m_settings.horizon, 1);
+	m_settings.rolloutsPerBlock = std::max<std::size_t>(m_settings.rolloutsPerBlock, 1);
+	setupRollouts();
+}
+
+void DroneControllerModelPredictive::setCostWeights(const ModelPredictiveCostWeights& costWeights) {
+	m_costWeights = costWeights;
+}
+
+/**
+ * Sets the model the rollouts are simulated with (RK4 with output vector per stage, at the time step of
+ * DroneRopeCargoSimulator::setImplementation()); the control sequence is reset to hover
+ *
+ * @param	dynamicsType : false --> drone, true --> drone with cargo
+ * @param	parameters : parameter block of the system (see DroneRopeCargoDynamics::getParameters())
+ */
+void DroneControllerModelPredictive::setModel(bool dynamicsType, const DynamicSystemParameters& parameters) {
+	m_dynamicsType = dynamicsType;
+	m_parameters = parameters;
+	setupRollouts();
+}
+
+void DroneControllerModelPredictive::setThreadPool(WorkStealingThreadPool* threadPool) {
+	m_threadPool = threadPool;
+}
+
+
+// Setters (velocity vector)
+void DroneControllerModelPredictive::setVelocityVector(const std::array<double, 2>& velocityVector) {
+	m_velocityVector = velocityVector;
+}
+
+
+// Setters (control sequence)
+/**
+ * Resets the control sequence to hovering (thrust equal to the weight of drone and cargo, no rotation)
+ */
+void DroneControllerModelPredictive::resetControlSequence() {
+	std::fill(m_controlSequence.begin(), m_controlSequence.end(), ControlArray{ calculateHoverThrust(), 0 });
+	m_tick = 0;
+}
+
+
+// Calculate (control vector)
+/**
+ * Computes the control vector with model predictive path integral control (MPPI). Per control tick:
+ *
+ *		1. The control sequence of the last tick is shifted by one step (warm start)
+ *		2. [numberOfRollouts] noisy copies of the sequence are simulated over the horizon from the current state, in
+ *		   blocks of [rolloutsPerBlock] rollouts that are stepped in lockstep (vectorized, see DroneRopeCargoBatchSimulator)
+ *		   and distributed over the thread pool
+ *		3. Every rollout k is weighted with w_k = exp(-(S_k - min S) / lambda) from its cost S_k, and the sequence is
+ *		   moved by the weighted mean of the noise
+ *
+ * The first control vector of the sequence is returned; call once per time step of the model (the control period).
+ * The noise of a rollout is drawn from its own generator (seed, tick, rollout), such that the result does not depend
+ * on the number of workers. A tick does not allocate.
+ *
+ * @param	stateVector : the current state vector of the system
+ * @return	A (ControlArray) representing the weighted control vector
+ */
+ControlArray DroneControllerModelPredictive::calculateControlArray(const StateArray& stateVector) {
+	// Initialize variables
+	const std::size_t numberOfRollouts = m_settings.numberOfRollouts;
+	const std::size_t horizon = m_settings.horizon;
+
+	// 1. Shift the control sequence (the last control vector is repeated)
+	if (m_tick > 0) {
+		std::copy(m_controlSequence.begin() + 1, m_controlSequence.end(), m_controlSequence.begin());
+	}
+
+	// 2. Simulate the rollouts
+	if (m_threadPool != nullptr) {
+		m_threadPool->parallelFor(m_batches.size(), [&](std::size_t block, std::size_t) { simulateBlock(block, stateVector); });
+	}
+	else {
+		for (std::size_t block = 0; block < m_batches.size(); block++) { simulateBlock(block, stateVector); }
+	}
+	m_tick++;
+
+	// 3. Weight the rollouts and move the control sequence (no finite cost --> sequence kept)
+	const double minimumCost = *std::min_element(m_rolloutCosts.begin(), m_rolloutCosts.end());
+	if (!std::isfinite(minimumCost)) {
+		std::fill(m_rolloutWeights.begin(), m_rolloutWeights.end(), 0);
+		m_effectiveNumberOfRollouts = 0;
+		return m_controlSequence[0];
+	}
+
+	double sumOfWeights = 0, sumOfSquaredWeights = 0;
+	for (std::size_t k = 0; k < numberOfRollouts; k++) {
+		m_rolloutWeights[k] = std::exp(-(m_rolloutCosts[k] - minimumCost) / m_settings.temperature);
+		sumOfWeights += m_rolloutWeights[k];
+	}
+	for (std::size_t k = 0; k < numberOfRollouts; k++) {
+		m_rolloutWeights[k] /= sumOfWeights;
+		sumOfSquaredWeights += m_rolloutWeights[k] * m_rolloutWeights[k];
+	}
+	m_effectiveNumberOfRollouts = 1 / sumOfSquaredWeights;
+
+	for (std::size_t t = 0; t < horizon; t++) {
+		ControlArray update{};
+		for (std::size_t k = 0; k < numberOfRollouts; k++) {
+			update[0] += m_rolloutWeights[k] * m_noise[k * horizon + t][0];
+			update[1] += m_rolloutWeights[k] * m_noise[k * horizon + t][1];
+		}
+		for (std::size_t i = 0; i < update.size(); i++) {
+			m_controlSequence[t][i] = std::min(std::max(m_controlSequence[t][i] + update[i], m_settings.controlMinimum[i]), m_settings.controlMaximum[i]);
+		}
+	}
+
+	return m_controlSequence[0];
+}
+
+
+// Helper functions for setSettings() and setModel()
+/**
+ * Reserves the memory of the rollouts (a batch per block, noise, costs, weights, control sequence) and sets the model of
+ * every rollout; the control sequence is reset to hover
+ */
+void DroneControllerModelPredictive::setupRollouts() {
+	// Initialize variables
+	const std::size_t numberOfRollouts = m_settings.numberOfRollouts;
+	const std::size_t rolloutsPerBlock = m_settings.rolloutsPerBlock;
+
+	// Batches
+	m_batches.resize((numberOfRollouts + rolloutsPerBlock - 1) / rolloutsPerBlock);
+	for (std::size_t block = 0; block < m_batches.size(); block++) {
+		DroneRopeCargoBatchSimulator& batch = m_batches[block];
+		batch.setNumberOfSystems(std::min(rolloutsPerBlock, numberOfRollouts - block * rolloutsPerBlock));
+		batch.setImplementation(m_dynamicsType, IntegrationType::RungeKuttaFourStageOutput);
+
+		for (std::size_t rollout = 0; rollout < batch.getNumberOfSystems(); rollout++) {
+			batch.setConstantDroneParameters(rollout, m_parameters.massDrone, m_parameters.dragConstantDrone);
+			batch.setConstantRopeParameters(rollout, m_parameters.ropeLengthInitial, m_parameters.ropeStiffness, m_parameters.ropeDamping);
+			batch.setConstantCargoParameters(rollout, m_parameters.massCargo, m_parameters.dragConstantCargo);
+		}
+	}
+
+	// Noise, costs and control sequence
+	m_noise.assign(numberOfRollouts * m_settings.horizon, ControlArray{});
+	m_rolloutCosts.assign(numberOfRollouts, 0);
+	m_rolloutWeights.assign(numberOfRollouts, 0);
+	m_controlSequence.assign(m_settings.horizon, ControlArray{});
+	resetControlSequence();
+}
+
+/**
+ * Computes the thrust that holds the drone (and the hanging cargo) in the air
+ *
+ * @return	A (double) which is the hover thrust [N]
+ */
+double DroneControllerModelPredictive::calculateHoverThrust() const {
+	return (m_parameters.massDrone + (m_dynamicsType ? m_parameters.massCargo : 0)) * m_parameters.gravitationalConstant;
+}
+
+
+// Helper functions for calculateControlArray()
+/**
+ * Draws the noise of the rollouts of a block and simulates them in lockstep over the horizon, summing their costs.
+ * A rollout that leaves the finite numbers gets an infinite cost (weight zero).
+ *
+ * @param	block : index of the block
+ * @param	stateVector : the current state vector of the system (start of every rollout)
+ */
+void DroneControllerModelPredictive::simulateBlock(std::size_t block, const StateArray& stateVector) {
+	// Initialize variables
+	DroneRopeCargoBatchSimulator& batch = m_batches[block];
+	const std::size_t horizon = m_settings.horizon;
+	const std::size_t firstRollout = block * m_settings.rolloutsPerBlock;
+	const std::uint64_t tickSeed = SplitMix64::calculateStreamSeed(m_settings.seed, std::size_t(m_tick));
+
+	// Noise (Box-Muller, one pair of normal numbers per step), clipped such that the control vector stays within bounds
+	for (std::size_t rollout = 0; rollout < batch.getNumberOfSystems(); rollout++) {
+		SplitMix64 generator{ SplitMix64::calculateStreamSeed(tickSeed, firstRollout + rollout) };
+		ControlArray* noise = &m_noise[(firstRollout + rollout) * horizon];
+
+		for (std::size_t t = 0; t < horizon; t++) {
+			const double radius = std::sqrt(-2 * std::log(1 - generator.nextUniform()));
+			const double angle = 6.283185307179586 * generator.nextUniform();
+			const double normal[2] = { radius * std::cos(angle), radius * std::sin(angle) };
+
+			for (std::size_t i = 0; i < 2; i++) {
+				const double control = std::min(std::max(m_controlSequence[t][i] + m_settings.noiseStandardDeviation[i] * normal[i], m_settings.controlMinimum[i]), m_settings.controlMaximum[i]);
+				noise[t][i] = control - m_controlSequence[t][i];
+			}
+		}
+
+		batch.setStateArray(rollout, stateVector);
+		m_rolloutCosts[firstRollout + rollout] = 0;
+	}
+
+	// Simulate
+	for (std::size_t t = 0; t < horizon; t++) {
+		for (std::size_t rollout = 0; rollout < batch.getNumberOfSystems(); rollout++) {
+			const ControlArray& noise = m_noise[(firstRollout + rollout) * horizon + t];
+			batch.setControlArray(rollout, { m_controlSequence[t][0] + noise[0], m_controlSequence[t][1] + noise[1] });
+		}
+
+		batch.simulationStep();
+
+		const double factor = (t + 1 == horizon) ? m_costWeights.terminal : 1;
+		for (std::size_t rollout = 0; rollout < batch.getNumberOfSystems(); rollout++) {
+			m_rolloutCosts[firstRollout + rollout] += factor * calculateStageCost(batch.getStateArray(rollout), batch.getControlArray(rollout));
+		}
+	}
+
+	// Diverged rollouts
+	for (std::size_t rollout = 0; rollout < batch.getNumberOfSystems(); rollout++) {
+		double& cost = m_rolloutCosts[firstRollout + rollout];
+		if (!std::isfinite(cost)) {
+			cost = std::numeric_limits<double>::infinity();
+		}
+	}
+}
+
+/**
+ * Computes the cost of a step of a rollout (see ModelPredictiveCostWeights)
+ *
+ * @param	stateVector : the state vector at the end of the step
+ * @param	controlVector : the control vector of the step
+ * @return	A (double) which is the cost of the step
+ */
+double DroneControllerModelPredictive::calculateStageCost(const StateArray& stateVector, const ControlArray& controlVector) const {
+	// Drone: velocity tracking, angle and control effort
+	const double velocityErrorX = stateVector[3] - m_velocityVector[0];
+	const double velocityErrorY = stateVector[4] - m_velocityVector[1];
+	const double thrustError = controlVector[0] - calculateHoverThrust();
+	double cost = m_costWeights.velocity * (velocityErrorX * velocityErrorX + velocityErrorY * velocityErrorY) + m_costWeights.angle * stateVector[2] * stateVector[2]
+				  + m_costWeights.thrust * thrustError * thrustError + m_costWeights.angularVelocity * controlVector[1] * controlVector[1];
+
+	// Cargo: swing w.r.t. the drone
+	if (m_dynamicsType) {
+		const double cargoOffset = stateVector[5] - stateVector[0];
+		const double cargoVelocityX = stateVector[7] - stateVector[3];
+		const double cargoVelocityY = stateVector[8] - stateVector[4];
+		cost += m_costWeights.cargoOffset * cargoOffset * cargoOffset + m_costWeights.cargoVelocity * (cargoVelocityX * cargoVelocityX + cargoVelocityY * cargoVelocityY);
+	}
+
+	return cost;
+}
\ No newline at end of file
@@ -0,0 +1,119 @@
+//==============================================================
+// Filename : DroneControllerModelPredictive.h
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class for a sampling-based model predictive
+//				 controller (MPPI) of the drone with cargo, with
+//				 the rollouts simulated in parallel - header
+//==============================================================
+
+// [BEGIN]: Prevent multiple inclusions of header
+#ifndef DRONECONTROLLERMODELPREDICTIVE_H
+#define DRONECONTROLLERMODELPREDICTIVE_H
+
+
+// Libraries
+#include "DroneRopeCargoBatchSimulator.h"
+#include "WorkStealingThreadPool.h"
+#include "DynamicSystemArrays.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Settings of the model predictive controller
+struct ModelPredictiveSettings {
+	std::size_t numberOfRollouts = 256;					// Sampled control sequences per control tick
+	std::size_t horizon = 50;							// Steps of a rollout (of the time step of the model)
+	std::size_t rolloutsPerBlock = 32;					// Rollouts per task of the thread pool (simulated in lockstep)
+	double temperature = 1;								// Lambda; lower --> the weighted control follows the best rollouts
+	std::array<double, 2> noiseStandardDeviation{ 4, 1 };	// Of tau [N] and omega [rad / s]
+	std::array<double, 2> controlMinimum{ 0, -4 };		// Of tau [N] and omega [rad / s]
+	std::array<double, 2> controlMaximum{ 150, 4 };
+	std::uint64_t seed = 0;								// Of the noise; the control is reproducible for equal seeds
+};
+
+// Weights of the cost of a rollout, summed over its steps
+struct ModelPredictiveCostWeights {
+	double velocity = 10;		// Per (m / s)^2 of the drone velocity w.r.t. the reference velocity
+	double cargoOffset = 20;	// Per m^2 of the horizontal position of the cargo w.r.t. the drone (swing)
+	double cargoVelocity = 2;	// Per (m / s)^2 of the velocity of the cargo w.r.t. the drone
+	double angle = 1;			// Per rad^2 of the drone angle
+	double thrust = 0.0001;		// Per N^2 of tau w.r.t. the hover thrust
+	double angularVelocity = 0.01;	// Per (rad / s)^2 of omega
+	double terminal = 10;		// Factor on the cost of the last step
+};
+
+// DroneControllerModelPredictive-class
+class DroneControllerModelPredictive {
+public:
+	// Constructor (default)
+	DroneControllerModelPredictive();
+
+
+	// Getters (settings)
+	const ModelPredictiveSettings& getSettings() const { return m_settings; }
+	const ModelPredictiveCostWeights& getCostWeights() const { return m_costWeights; }
+	double getTimeStep() const { return m_batches.empty() ? 0 : m_batches[0].getTimeStep(); } // Of the model, being the control period
+
+	// Getters (velocity vector)
+	const std::array<double, 2>& getVelocityVector() const { return m_velocityVector; }
+
+	// Getters (last control tick)
+	const std::vector<double>& getRolloutCosts() const { return m_rolloutCosts; }
+	const std::vector<double>& getRolloutWeights() const { return m_rolloutWeights; } // Normalized
+	const std::vector<ControlArray>& getControlSequence() const { return m_controlSequence; } // Weighted, starts with the applied control vector
+	double getEffectiveNumberOfRollouts() const { return m_effectiveNumberOfRollouts; } // 1 / sum of squared weights; low --> few rollouts decide
+
+
+	// Setters (settings)
+	void setSettings(const ModelPredictiveSettings&);
+	void setCostWeights(const ModelPredictiveCostWeights&);
+	void setModel(bool, const DynamicSystemParameters&);
+	void setThreadPool(WorkStealingThreadPool*); // nullptr --> rollouts on the calling thread
+
+	// Setters (velocity vector)
+	void setVelocityVector(const std::array<double, 2>&);
+
+	// Setters (control sequence)
+	void resetControlSequence(); // Hover
+
+
+	// Calculate (control vector)
+	ControlArray calculateControlArray(const StateArray&);
+
+private:
+	// Attributes (settings)
+	ModelPredictiveSettings m_settings;
+	ModelPredictiveCostWeights m_costWeights;
+	WorkStealingThreadPool* m_threadPool = nullptr;
+
+	// Attributes (model); one batch of rollouts per block
+	bool m_dynamicsType = true;
+	DynamicSystemParameters m_parameters;
+	std::vector<DroneRopeCargoBatchSimulator> m_batches;
+
+	// Attributes (velocity vector)
+	std::array<double, 2> m_velocityVector{};
+
+	// Attributes (control sequence and rollouts); memory is reserved when the settings or the model are set
+	std::vector<ControlArray> m_controlSequence;	// horizon
+	std::vector<ControlArray> m_noise;				// numberOfRollouts x horizon (after clipping to the control bounds)
+	std::vector<double> m_rolloutCosts;				// numberOfRollouts
+	std::vector<double> m_rolloutWeights;			// numberOfRollouts
+	double m_effectiveNumberOfRollouts = 0;
+	std::uint64_t m_tick = 0;						// Control ticks so far; selects the noise of a tick
+
+	// Helper functions for setSettings() and setModel()
+	void setupRollouts();
+	double calculateHoverThrust() const;
+
+	// Helper functions for calculateControlArray()
+	void simulateBlock(std::size_t, const StateArray&);
+	double calculateStageCost(const StateArray&, const ControlArray&) const;
+};
+
+
+// [END]: Prevent multiple inclusions of header
+#endif
\ No newline at end of file
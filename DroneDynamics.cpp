@@ -17,28 +17,9 @@ DroneDynamics::DroneDynamics(double massDrone, double dragConstantDrone)
 // Setters (state vector)
 void DroneDynamics::setDroneStateVector(std::vector<double> droneStateVector) {
 	m_droneStateVector = droneStateVector;
+	m_droneStateRevision++;
 }
 
-void DroneDynamics::setXDrone(double xDrone) {
-	m_droneStateVector[0] = xDrone;
-};
-
-void DroneDynamics::setYDrone(double yDrone) {
-	m_droneStateVector[1] = yDrone;
-};
-
-void DroneDynamics::setThetaDrone(double thetaDrone) {
-	m_droneStateVector[2] = thetaDrone;
-};
-
-void DroneDynamics::setXDotDrone(double xDotDrone) {
-	m_droneStateVector[3] = xDotDrone;
-};
-
-void DroneDynamics::setYDotDrone(double xDotDrone) {
-	m_droneStateVector[4] = xDotDrone;
-};
-
 
 // Setters (control vector)
 void DroneDynamics::setDroneControlVector(std::vector<double> droneControlVector) {
@@ -13,6 +13,7 @@
 // Libraries
 #include "DroneProperties.h"
 #include "GravitationalConstants.h"
+#include <cstddef>
 #include <vector>
 
 // DroneDynamics-class
@@ -32,6 +33,7 @@ public:
 	double getThetaDrone() const { return m_droneStateVector[2]; }
 	double getXDotDrone() const { return m_droneStateVector[3]; }
 	double getYDotDrone() const { return m_droneStateVector[4]; }
+	std::size_t getDroneStateRevision() const { return m_droneStateRevision; } // Changes with every change of the state vector
 
 	// Getters (control vector)
 	std::vector<double> getDroneControlVector() { return m_droneControlVector; } // Main
@@ -41,11 +43,11 @@ public:
 
 	// Setters (state vector)
 	void setDroneStateVector(std::vector<double>); // Main
-	void setXDrone(double);
-	void setYDrone(double);
-	void setThetaDrone(double);
-	void setXDotDrone(double);
-	void setYDotDrone(double);
+	void setXDrone(double xDrone) { m_droneStateVector[0] = xDrone; m_droneStateRevision++; }
+	void setYDrone(double yDrone) { m_droneStateVector[1] = yDrone; m_droneStateRevision++; }
+	void setThetaDrone(double thetaDrone) { m_droneStateVector[2] = thetaDrone; m_droneStateRevision++; }
+	void setXDotDrone(double xDotDrone) { m_droneStateVector[3] = xDotDrone; m_droneStateRevision++; }
+	void setYDotDrone(double yDotDrone) { m_droneStateVector[4] = yDotDrone; m_droneStateRevision++; }
 
 	// Setters (control vector)
 	void setDroneControlVector(std::vector<double>); // Main
@@ -55,6 +57,7 @@ public:
 private:
 	// Attributes (state vector)
 	std::vector<double> m_droneStateVector = { 0, 0, 0, 0, 0 }; // x1 - x5
+	std::size_t m_droneStateRevision = 0;
 
 	// Attributes (control vector)
 	std::vector<double> m_droneControlVector = { 0, 0 }; // u1 - u2
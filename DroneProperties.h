@@ -22,6 +22,7 @@ public:
 
 	// Getters (drone)
 	double getMassDrone() const { return m_massDrone; }
+	double getDragConstantDrone() const { return m_dragConstantDrone; }
 
 	// Setters (drone)
 	void setConstantDroneParameters(double, double); // Main
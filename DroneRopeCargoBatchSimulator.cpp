@@ -0,0 +1,389 @@
+//==============================================================
+// Filename : DroneRopeCargoBatchSimulator.cpp
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class to simulate a batch of independent drone
+//				 (+ cargo) systems in lockstep, stored as
+//				 structure-of-arrays and vectorized - source
+//==============================================================
+
+// Libraries
+#include "DroneRopeCargoBatchSimulator.h"
+#include "DroneRopeCargoDynamics.h"
+#include <cmath>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+
+/* ---------------------------------------------------- LANES ---------------------------------------------------- */
+/*	The step is written once for a pack of "lanes" (systems that are processed together) and instantiated for a single
+	system (scalar fallback) and, when compiled with AVX2, for four systems at a time. A pack supports the arithmetic
+	operators and the few functions below. */
+
+// Lanes of a single system (scalar fallback)
+struct ScalarLanes {
+	static constexpr std::size_t width = 1;
+	double value;
+
+	static ScalarLanes load(const double* values) { return { *values }; }
+	static ScalarLanes broadcast(double value) { return { value }; }
+	void store(double* values) const { *values = value; }
+};
+
+inline ScalarLanes operator+(ScalarLanes a, ScalarLanes b) { return { a.value + b.value }; }
+inline ScalarLanes operator-(ScalarLanes a, ScalarLanes b) { return { a.value - b.value }; }
+inline ScalarLanes operator*(ScalarLanes a, ScalarLanes b) { return { a.value * b.value }; }
+inline ScalarLanes operator/(ScalarLanes a, ScalarLanes b) { return { a.value / b.value }; }
+inline ScalarLanes calculateSquareRoot(ScalarLanes a) { return { std::sqrt(a.value) }; }
+inline ScalarLanes calculatePositivePart(ScalarLanes a) { return { (a.value > 0) ? a.value : 0 }; }								// a > 0 ? a : 0
+inline ScalarLanes calculateWhereNonZero(ScalarLanes condition, ScalarLanes a) { return { (condition.value != 0) ? a.value : 0 }; }	// condition != 0 ? a : 0
+inline void calculateSineCosine(ScalarLanes angle, ScalarLanes& sine, ScalarLanes& cosine) { sine.value = std::sin(angle.value); cosine.value = std::cos(angle.value); }
+
+#ifdef __AVX2__
+// Lanes of four systems (AVX2)
+struct AvxLanes {
+	static constexpr std::size_t width = 4;
+	__m256d value;
+
+	static AvxLanes load(const double* values) { return { _mm256_loadu_pd(values) }; }
+	static AvxLanes broadcast(double value) { return { _mm256_set1_pd(value) }; }
+	void store(double* values) const { _mm256_storeu_pd(values, value); }
+};
+
+inline AvxLanes operator+(AvxLanes a, AvxLanes b) { return { _mm256_add_pd(a.value, b.value) }; }
+inline AvxLanes operator-(AvxLanes a, AvxLanes b) { return { _mm256_sub_pd(a.value, b.value) }; }
+inline AvxLanes operator*(AvxLanes a, AvxLanes b) { return { _mm256_mul_pd(a.value, b.value) }; }
+inline AvxLanes operator/(AvxLanes a, AvxLanes b) { return { _mm256_div_pd(a.value, b.value) }; }
+inline AvxLanes calculateSquareRoot(AvxLanes a) { return { _mm256_sqrt_pd(a.value) }; }
+inline AvxLanes calculatePositivePart(AvxLanes a) { return { _mm256_and_pd(_mm256_cmp_pd(a.value, _mm256_setzero_pd(), _CMP_GT_OQ), a.value) }; }
+inline AvxLanes calculateWhereNonZero(AvxLanes condition, AvxLanes a) { return { _mm256_and_pd(_mm256_cmp_pd(condition.value, _mm256_setzero_pd(), _CMP_NEQ_UQ), a.value) }; }
+
+/**
+ * Computes sine and cosine of four angles at once (Cephes-style: reduction by pi/4 in three parts, minimax polynomials).
+ * Accurate to a few units in the last place for the angles of a drone (|angle| < 1e6 rad).
+ *
+ * @param	angle : angles [rad]
+ * @param	sine : sines of the angles
+ * @param	cosine : cosines of the angles
+ */
+inline void calculateSineCosine(AvxLanes angle, AvxLanes& sine, AvxLanes& cosine) {
+	// Reduction constants (pi/4 split in three parts) and polynomial coefficients
+	const __m256d fourOverPi = _mm256_set1_pd(1.27323954473516268615);
+	const __m256d reduction1 = _mm256_set1_pd(7.85398125648498535156E-1);
+	const __m256d reduction2 = _mm256_set1_pd(3.77489470793079817668E-8);
+	const __m256d reduction3 = _mm256_set1_pd(2.69515142907905952645E-15);
+	const double sineCoefficients[6] = { 1.58962301576546568060E-10, -2.50507477628578072866E-8, 2.75573136213857245213E-6,
+										 -1.98412698295895385996E-4, 8.33333333332211858878E-3, -1.66666666666666307295E-1 };
+	const double cosineCoefficients[6] = { -1.13585365213876817300E-11, 2.08757008419747316778E-9, -2.75573141792967388112E-7,
+										   2.48015872888517045348E-5, -1.38888888888730564116E-3, 4.16666666666665929218E-2 };
+	const __m256d signMask = _mm256_set1_pd(-0.0);
+
+	// Work on |angle|; sine is odd
+	const __m256d absoluteAngle = _mm256_andnot_pd(signMask, angle.value);
+	__m256d sineSign = _mm256_and_pd(signMask, angle.value);
+
+	// Octant (rounded up to even) and reduced angle
+	__m128i octant = _mm256_cvttpd_epi32(_mm256_mul_pd(absoluteAngle, fourOverPi));
+	octant = _mm_and_si128(_mm_add_epi32(octant, _mm_set1_epi32(1)), _mm_set1_epi32(~1));
+	const __m256d octantValue = _mm256_cvtepi32_pd(octant);
+	__m256d z = _mm256_sub_pd(absoluteAngle, _mm256_mul_pd(octantValue, reduction1));
+	z = _mm256_sub_pd(z, _mm256_mul_pd(octantValue, reduction2));
+	z = _mm256_sub_pd(z, _mm256_mul_pd(octantValue, reduction3));
+	const __m256d zz = _mm256_mul_pd(z, z);
+
+	// Polynomials on [-pi/4, pi/4]
+	__m256d sinePolynomial = _mm256_set1_pd(sineCoefficients[0]);
+	__m256d cosinePolynomial = _mm256_set1_pd(cosineCoefficients[0]);
+	for (int i = 1; i < 6; i++) {
+		sinePolynomial = _mm256_add_pd(_mm256_mul_pd(sinePolynomial, zz), _mm256_set1_pd(sineCoefficients[i]));
+		cosinePolynomial = _mm256_add_pd(_mm256_mul_pd(cosinePolynomial, zz), _mm256_set1_pd(cosineCoefficients[i]));
+	}
+	const __m256d sineReduced = _mm256_add_pd(z, _mm256_mul_pd(_mm256_mul_pd(z, zz), sinePolynomial));
+	const __m256d cosineReduced = _mm256_add_pd(_mm256_sub_pd(_mm256_set1_pd(1.0), _mm256_mul_pd(_mm256_set1_pd(0.5), zz)), _mm256_mul_pd(_mm256_mul_pd(zz, zz), cosinePolynomial));
+
+	// Quadrant: swap polynomials for octants 2 and 6, flip signs for octants 4 and 6 (sine) and 2 and 4 (cosine)
+	const __m256i octant64 = _mm256_cvtepi32_epi64(octant);
+	const __m256d swap = _mm256_castsi256_pd(_mm256_cmpeq_epi64(_mm256_and_si256(octant64, _mm256_set1_epi64x(2)), _mm256_set1_epi64x(2)));
+	const __m256d flip = _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_and_si256(octant64, _mm256_set1_epi64x(4)), 61));
+	const __m256d cosineFlip = _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_and_si256(_mm256_add_epi64(octant64, _mm256_set1_epi64x(2)), _mm256_set1_epi64x(4)), 61));
+
+	sineSign = _mm256_xor_pd(sineSign, flip);
+	sine.value = _mm256_xor_pd(_mm256_blendv_pd(sineReduced, cosineReduced, swap), sineSign);
+	cosine.value = _mm256_xor_pd(_mm256_blendv_pd(cosineReduced, sineReduced, swap), cosineFlip);
+}
+#endif
+
+/**
+ * Computes the derivative of the state vector for a pack of lanes, with the same operations as
+ * DroneRopeCargoDynamics::calculateDerivativeStateVectorFused()
+ *
+ * @param	x : the state vectors (x1 - x9)
+ * @param	ropeLength : the rope lengths (y1)
+ * @param	ropeRateOfChange : the rope rates of change (y2)
+ * @param	thrustX, thrustY : the thrust components of the drones
+ * @param	omega : the angular velocities of the drones (u2)
+ * @param	parameters : the parameters of the lanes, in the order of the parameter list convention (masses as reciprocals)
+ * @param	dynamicsType : specifies the dynamics type to be used of the systems
+ * @param	xDot : the derivatives of the state vectors
+ */
+template <typename Lanes>
+inline void calculateDerivativeLanes(const Lanes (&x)[9], Lanes ropeLength, Lanes ropeRateOfChange, Lanes thrustX, Lanes thrustY, Lanes omega,
+									 const Lanes (&parameters)[8], bool dynamicsType, Lanes (&xDot)[9]) {
+	// Drag drone
+	const Lanes dragDrone = parameters[2] * calculateSquareRoot(x[3] * x[3] + x[4] * x[4]);
+
+	// Drone
+	xDot[0] = x[3];
+	xDot[1] = x[4];
+	xDot[2] = omega;
+
+	if (dynamicsType == false) { // Default case
+		const Lanes zero = Lanes::broadcast(0);
+		xDot[3] = parameters[1] * (thrustX - dragDrone * x[3]);
+		xDot[4] = parameters[1] * (thrustY - dragDrone * x[4]) - parameters[0];
+		xDot[5] = zero;
+		xDot[6] = zero;
+		xDot[7] = zero;
+		xDot[8] = zero;
+		return;
+	}
+
+	// Rope force (zero for a slack rope and for zero rope length)
+	const Lanes ropeForce = calculatePositivePart(parameters[5] * (ropeLength - parameters[3]) + parameters[4] * ropeRateOfChange);
+	const Lanes ropeForceX = calculateWhereNonZero(ropeLength, ropeForce * ((x[0] - x[5]) / ropeLength));
+	const Lanes ropeForceY = calculateWhereNonZero(ropeLength, ropeForce * ((x[1] - x[6]) / ropeLength));
+
+	// Drag cargo
+	const Lanes dragCargo = parameters[7] * calculateSquareRoot(x[7] * x[7] + x[8] * x[8]);
+
+	// Drone
+	xDot[3] = parameters[1] * (thrustX - dragDrone * x[3] - ropeForceX);
+	xDot[4] = parameters[1] * (thrustY - dragDrone * x[4] - ropeForceY) - parameters[0];
+
+	// Cargo
+	xDot[5] = x[7];
+	xDot[6] = x[8];
+	xDot[7] = parameters[6] * (ropeForceX - dragCargo * x[7]);
+	xDot[8] = parameters[6] * (ropeForceY - dragCargo * x[8]) - parameters[0];
+}
+
+/**
+ * Computes the output vector (rope length and rope rate of change) for a pack of lanes,
+ * with the same operations as DroneRopeCargoDynamics::calculateOutputArray()
+ */
+template <typename Lanes>
+inline void calculateOutputLanes(const Lanes (&x)[9], Lanes& ropeLength, Lanes& ropeRateOfChange) {
+	ropeLength = calculateSquareRoot((x[0] - x[5]) * (x[0] - x[5]) + (x[1] - x[6]) * (x[1] - x[6]));
+	ropeRateOfChange = calculateWhereNonZero(ropeLength, (((x[0] - x[5]) + (x[3] - x[7])) + ((x[1] - x[6]) + (x[4] - x[8]))) / ropeLength);
+}
+
+/* ---------------------------------------------------------------------------------------------------------------- */
+
+
+// Constructor
+DroneRopeCargoBatchSimulator::DroneRopeCargoBatchSimulator(std::size_t numberOfSystems) {
+	// Set attributes
+	setNumberOfSystems(numberOfSystems);
+	setImplementation(false, IntegrationType::Euler);
+}
+
+
+// Getters (batch)
+/**
+ * Retrieves whether the batch is stepped with AVX2 (four systems at a time) or with the scalar fallback
+ *
+ * @return	A type (bool) which is true if compiled with AVX2
+ */
+bool DroneRopeCargoBatchSimulator::isVectorized() {
+#ifdef __AVX2__
+	return true;
+#else
+	return false;
+#endif
+}
+
+// Getters (system)
+StateArray DroneRopeCargoBatchSimulator::getStateArray(std::size_t system) const {
+	// Gather state vector of system
+	StateArray stateVector{};
+	for (std::size_t i = 0; i < stateVector.size(); i++) { stateVector[i] = m_stateVectors[i][system]; }
+
+	// Return array
+	return stateVector;
+}
+
+ControlArray DroneRopeCargoBatchSimulator::getControlArray(std::size_t system) const {
+	return { m_tauDrone[system], m_omegaDrone[system] };
+}
+
+OutputArray DroneRopeCargoBatchSimulator::getOutputArray(std::size_t system) const {
+	// Compute output vector from state vector of system
+	OutputArray outputVector{};
+	DroneRopeCargoDynamics::calculateOutputArray(getStateArray(system), outputVector);
+
+	// Return array
+	return outputVector;
+}
+
+
+// Setters (batch)
+/**
+ * Sets the number of systems in the batch. Storage is padded to a multiple of the vector width; padding systems
+ * (and new systems) are at rest with unit masses and no drag, rope or control until set.
+ *
+ * @param	numberOfSystems : the number of systems
+ */
+void DroneRopeCargoBatchSimulator::setNumberOfSystems(std::size_t numberOfSystems) {
+	// Pad to vector width
+#ifdef __AVX2__
+	const std::size_t width = AvxLanes::width;
+#else
+	const std::size_t width = ScalarLanes::width;
+#endif
+	m_numberOfSystems = numberOfSystems;
+	m_numberOfLanes = ((numberOfSystems + width - 1) / width) * width;
+
+	// Resize structure-of-arrays
+	for (std::vector<double>& stateVector : m_stateVectors) { stateVector.resize(m_numberOfLanes, 0); }
+	m_tauDrone.resize(m_numberOfLanes, 0);
+	m_omegaDrone.resize(m_numberOfLanes, 0);
+	m_inverseMassDrone.resize(m_numberOfLanes, 1);
+	m_dragConstantDrone.resize(m_numberOfLanes, 0);
+	m_ropeLengthInitial.resize(m_numberOfLanes, 0);
+	m_ropeStiffness.resize(m_numberOfLanes, 0);
+	m_ropeDamping.resize(m_numberOfLanes, 0);
+	m_inverseMassCargo.resize(m_numberOfLanes, 1);
+	m_dragConstantCargo.resize(m_numberOfLanes, 0);
+}
+
+// Setters (implementation)
+/**
+ * Sets the implementation of the batch, with the same time steps as DroneRopeCargoSimulator::setImplementation().
+ * Supported are Euler, RK4 and RK4 with output vector per stage; other integration types are integrated as RK4
+ * with output vector per stage.
+ *
+ * @param	dynamicsType : false --> drone, true --> drone with cargo
+ * @param	integrationType : the integration type
+ */
+void DroneRopeCargoBatchSimulator::setImplementation(bool dynamicsType, IntegrationType integrationType) {
+	// Set dynamics and integration type
+	m_dynamicsType = dynamicsType;
+	m_integrationType = ((integrationType == IntegrationType::Euler) || (integrationType == IntegrationType::RungeKuttaFour)) ? integrationType : IntegrationType::RungeKuttaFourStageOutput;
+
+	// Choose suitable time step based on chosen combination
+	if ((dynamicsType == true) && (m_integrationType == IntegrationType::Euler)) {	// Drone with cargo - Euler
+		setTimeStep(0.0005);
+	}
+	else {																			// Otherwise
+		setTimeStep(0.01);
+	}
+}
+
+// Setters (system)
+void DroneRopeCargoBatchSimulator::setConstantDroneParameters(std::size_t system, double massDrone, double dragConstantDrone) {
+	m_inverseMassDrone[system] = 1 / massDrone;
+	m_dragConstantDrone[system] = dragConstantDrone;
+}
+
+void DroneRopeCargoBatchSimulator::setConstantRopeParameters(std::size_t system, double ropeLengthInitial, double ropeStiffness, double ropeDamping) {
+	m_ropeLengthInitial[system] = ropeLengthInitial;
+	m_ropeStiffness[system] = ropeStiffness;
+	m_ropeDamping[system] = ropeDamping;
+}
+
+void DroneRopeCargoBatchSimulator::setConstantCargoParameters(std::size_t system, double massCargo, double dragConstantCargo) {
+	m_inverseMassCargo[system] = 1 / massCargo;
+	m_dragConstantCargo[system] = dragConstantCargo;
+}
+
+void DroneRopeCargoBatchSimulator::setStateArray(std::size_t system, const StateArray& stateVector) {
+	for (std::size_t i = 0; i < stateVector.size(); i++) { m_stateVectors[i][system] = stateVector[i]; }
+}
+
+void DroneRopeCargoBatchSimulator::setControlArray(std::size_t system, const ControlArray& controlVector) {
+	m_tauDrone[system] = controlVector[0];
+	m_omegaDrone[system] = controlVector[1];
+}
+
+
+// Other
+/**
+ * Steps all systems of the batch by one time step, with the control vectors held constant over the step.
+ * With AVX2, four systems are integrated at a time; otherwise one at a time (scalar fallback).
+ */
+void DroneRopeCargoBatchSimulator::simulationStep() {
+#ifdef __AVX2__
+	for (std::size_t system = 0; system < m_numberOfLanes; system += AvxLanes::width) {
+		calculateStepLanes<AvxLanes>(system);
+	}
+#else
+	for (std::size_t system = 0; system < m_numberOfLanes; system += ScalarLanes::width) {
+		calculateStepLanes<ScalarLanes>(system);
+	}
+#endif
+}
+
+/**
+ * Integrates a pack of lanes (starting at the given system) by one time step, keeping all intermediate values in registers
+ *
+ * @param	firstSystem : index of the first system of the pack
+ */
+template <typename Lanes>
+void DroneRopeCargoBatchSimulator::calculateStepLanes(std::size_t firstSystem) {
+	// Initialize variables
+	const double timeStep = getTimeStep();
+	Lanes x[9], stateVectorK[9], K1[9], K2[9], K3[9], K4[9];
+	Lanes ropeLength{}, ropeRateOfChange{}, sine{}, cosine{};
+
+	// Load states, controls and parameters (parameter list convention; masses as reciprocals)
+	for (std::size_t i = 0; i < 9; i++) { x[i] = Lanes::load(&m_stateVectors[i][firstSystem]); }
+	const Lanes tau = Lanes::load(&m_tauDrone[firstSystem]);
+	const Lanes omega = Lanes::load(&m_omegaDrone[firstSystem]);
+	const Lanes parameters[8] = { Lanes::broadcast(m_gravitationalConstant), Lanes::load(&m_inverseMassDrone[firstSystem]), Lanes::load(&m_dragConstantDrone[firstSystem]),
+								  Lanes::load(&m_ropeLengthInitial[firstSystem]), Lanes::load(&m_ropeDamping[firstSystem]), Lanes::load(&m_ropeStiffness[firstSystem]),
+								  Lanes::load(&m_inverseMassCargo[firstSystem]), Lanes::load(&m_dragConstantCargo[firstSystem]) };
+	const Lanes zero = Lanes::broadcast(0);
+
+	// Evaluates the derivative at a stage state, with the output vector from that state (or the one at the start of the step)
+	// and the sine/cosine of the drone angle from that state (or the ones of the previous stage, if its angle is equal)
+	auto evaluate = [&](const Lanes (&stageStateVector)[9], bool stageOutput, bool stageAngle, Lanes (&K)[9]) {
+		if (stageOutput) { calculateOutputLanes(stageStateVector, ropeLength, ropeRateOfChange); }
+		if (stageAngle) { calculateSineCosine(stageStateVector[2], sine, cosine); }
+		calculateDerivativeLanes(stageStateVector, ropeLength, ropeRateOfChange, zero - tau * sine, tau * cosine, omega, parameters, m_dynamicsType, K);
+	};
+
+	if (m_integrationType == IntegrationType::Euler) { // Euler-case
+		//		EQUATION: x_next = x_current + h * f(x_current)
+		evaluate(x, true, true, K1);
+		for (std::size_t i = 0; i < 9; i++) { x[i] = x[i] + K1[i] * Lanes::broadcast(timeStep); }
+	}
+	else { // Runge Kutta 4-case
+		const bool stageOutput = (m_integrationType == IntegrationType::RungeKuttaFourStageOutput);
+
+		// Compute K1
+		evaluate(x, true, true, K1);
+
+		// Compute K2 --> f(x + [K1 * (h/2)])
+		for (std::size_t i = 0; i < 9; i++) { stateVectorK[i] = x[i] + K1[i] * Lanes::broadcast(timeStep / 2); }
+		evaluate(stateVectorK, stageOutput, true, K2);
+
+		// Compute K3 --> f(x + [K2 * (h/2)]); the drone angle equals the one of K2, since its derivative (u2) is constant
+		for (std::size_t i = 0; i < 9; i++) { stateVectorK[i] = x[i] + K2[i] * Lanes::broadcast(timeStep / 2); }
+		evaluate(stateVectorK, stageOutput, false, K3);
+
+		// Compute K4 --> f(x + [K3 * h])
+		for (std::size_t i = 0; i < 9; i++) { stateVectorK[i] = x[i] + K3[i] * Lanes::broadcast(timeStep); }
+		evaluate(stateVectorK, stageOutput, true, K4);
+
+		// Sum to construct final state vector
+		//		EQUATION: x_next = x_current + (1/6) * h * (K1 + 2*K2 + 2*K3 + 1*K4)
+		for (std::size_t i = 0; i < 9; i++) {
+			x[i] = x[i] + K1[i] * Lanes::broadcast(timeStep / 6) + K2[i] * Lanes::broadcast(timeStep / 3) + K3[i] * Lanes::broadcast(timeStep / 3) + K4[i] * Lanes::broadcast(timeStep / 6);
+		}
+	}
+
+	// Store states
+	for (std::size_t i = 0; i < 9; i++) { x[i].store(&m_stateVectors[i][firstSystem]); }
+}
\ No newline at end of file
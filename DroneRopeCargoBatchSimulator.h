@@ -0,0 +1,89 @@
+//==============================================================
+// Filename : DroneRopeCargoBatchSimulator.h
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class to simulate a batch of independent drone
+//				 (+ cargo) systems in lockstep, stored as
+//				 structure-of-arrays and vectorized - header
+//==============================================================
+
+// [BEGIN]: Prevent multiple inclusions of header
+#ifndef DRONEROPECARGOBATCHSIMULATOR_H
+#define DRONEROPECARGOBATCHSIMULATOR_H
+
+
+// Libraries
+#include "NumericalIntegrationMethods.h"
+#include "GravitationalConstants.h"
+#include "DynamicSystemArrays.h"
+#include <array>
+#include <cstddef>
+#include <vector>
+
+// DroneRopeCargoBatchSimulator-class
+class DroneRopeCargoBatchSimulator : public NumericalIntegrationProperties, public GravitationalConstants {
+public:
+	// Constructor (default)
+	DroneRopeCargoBatchSimulator() = default;
+
+	// Constructor (with arguments)
+	DroneRopeCargoBatchSimulator(std::size_t numberOfSystems);
+
+
+	// Getters (batch)
+	std::size_t getNumberOfSystems() const { return m_numberOfSystems; }
+	static bool isVectorized(); // Compiled with AVX2
+
+	// Getters (implementation)
+	bool getDynamicsType() const { return m_dynamicsType; }
+	IntegrationType getIntegrationType() const { return m_integrationType; }
+
+	// Getters (system)
+	StateArray getStateArray(std::size_t) const;
+	ControlArray getControlArray(std::size_t) const;
+	OutputArray getOutputArray(std::size_t) const;
+
+
+	// Setters (batch)
+	void setNumberOfSystems(std::size_t);
+
+	// Setters (implementation)
+	void setImplementation(bool dynamicsType, IntegrationType integrationType);
+
+	// Setters (system)
+	void setConstantDroneParameters(std::size_t, double, double);
+	void setConstantRopeParameters(std::size_t, double, double, double);
+	void setConstantCargoParameters(std::size_t, double, double);
+	void setStateArray(std::size_t, const StateArray&);
+	void setControlArray(std::size_t, const ControlArray&);
+
+
+	// Other
+	void simulationStep(); // All systems, one time step
+
+private:
+	// Attributes (batch)
+	std::size_t m_numberOfSystems = 0;
+	std::size_t m_numberOfLanes = 0; // Number of systems, padded to a multiple of the vector width
+
+	// Attributes (implementation)
+	bool m_dynamicsType = false;
+	IntegrationType m_integrationType = IntegrationType::Euler;
+	double m_gravitationalConstant = getGravitationalConstant("Earth");
+
+	// Attributes (structure-of-arrays; one entry per system)
+	std::array<std::vector<double>, 9> m_stateVectors;		// x1 - x9
+	std::vector<double> m_tauDrone, m_omegaDrone;			// u1 - u2
+	std::vector<double> m_inverseMassDrone, m_dragConstantDrone;
+	std::vector<double> m_ropeLengthInitial, m_ropeStiffness, m_ropeDamping;
+	std::vector<double> m_inverseMassCargo, m_dragConstantCargo;
+
+	// Helper functions for simulationStep()
+	template <typename Lanes>
+	void calculateStepLanes(std::size_t);
+};
+
+
+// [END]: Prevent multiple inclusions of header
+#endif
\ No newline at end of file
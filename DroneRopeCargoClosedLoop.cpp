@@ -0,0 +1,246 @@
+//==============================================================
+// Filename : DroneRopeCargoClosedLoop.cpp
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class to run the simulator and the feedback
+//				 controller in closed loop within one process,
+//				 without the ROS nodes in between - source
+//==============================================================
+
+// Libraries
+#include "DroneRopeCargoClosedLoop.h"
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <thread>
+#include <utility>
+
+
+// Constructor
+/**
+ * Creates the closed loop with the parameters of the ROS nodes (dynamics_simulator and controller), for the drone
+ * with cargo and RK4-integration (output vector per stage, stable for the stiff rope). The cargo hangs at rest below
+ * the hovering drone. Use getSimulator() and getController() to change the parameters, the implementation or the
+ * initial state.
+ */
+DroneRopeCargoClosedLoop::DroneRopeCargoClosedLoop()
+	: m_controller(0.2, 0.2, 0.1, 50) // Time constants in [s], oscillation damping in [N / m]
+{
+	// Simulator
+	m_simulator.setConstantDroneParameters(3, 0.1);			// in [kg], [N s^2 / m^2]
+	m_simulator.setConstantRopeParameters(1.5, 40000, 50);	// in [m], [N / m], [N s / m]
+	m_simulator.setConstantCargoParameters(2, 0.1);			// in [kg], [N s^2 / m^2]
+	m_simulator.setImplementation(true, IntegrationType::RungeKuttaFourStageOutput);
+
+	// Cargo hanging at rest (rope stretched by the weight of the cargo)
+	const DynamicSystemParameters& parameters = m_simulator.getParameters();
+	m_simulator.setStateArray({ 0, 0, 0, 0, 0, 0, -(parameters.ropeLengthInitial + parameters.massCargo * parameters.gravitationalConstant / parameters.ropeStiffness), 0, 0 });
+}
+
+
+// Setters (settings)
+void DroneRopeCargoClosedLoop::setSettings(const ClosedLoopSettings& settings) {
+	m_settings = settings;
+}
+
+
+// Other
+/**
+ * Runs the closed loop over a reference velocity schedule, starting from the current state and simulation time of
+ * the simulator. Each simulator step is one tick of the loop; the controller runs every [controllerPeriod] ticks
+ * and its control vector is applied [controlDelay] ticks later. The timing of the ticks follows the mode of the
+ * settings (see runDirect() and runPipeline()); with a real-time factor the ticks are paced to the wall clock,
+ * otherwise the loop runs as fast as possible.
+ *
+ * @param	velocitySchedule : the entries of the reference velocity schedule, in order
+ * @return	A (StateArray) representing the state vector of drone (+ cargo) at the end of the schedule
+ */
+StateArray DroneRopeCargoClosedLoop::run(const std::vector<VelocityScheduleEntry>& velocitySchedule) {
+	m_runStartTime = std::chrono::steady_clock::now();
+	return (m_settings.mode == ClosedLoopMode::Pipeline) ? runPipeline(velocitySchedule, nullptr) : runDirect(velocitySchedule, nullptr);
+}
+
+/**
+ * Runs the closed loop over a reference velocity schedule (see run()), saving every [decimation]-th state vector to
+ * the trajectory buffer of the caller
+ *
+ * @param	velocitySchedule : the entries of the reference velocity schedule, in order
+ * @param	trajectoryBuffer : storage the decimated trajectory is written to; its number of samples is set
+ * @return	A (StateArray) representing the state vector of drone (+ cargo) at the end of the schedule
+ */
+StateArray DroneRopeCargoClosedLoop::run(const std::vector<VelocityScheduleEntry>& velocitySchedule, TrajectoryBuffer& trajectoryBuffer) {
+	m_runStartTime = std::chrono::steady_clock::now();
+	trajectoryBuffer.numberOfSamples = 0;
+	return (m_settings.mode == ClosedLoopMode::Pipeline) ? runPipeline(velocitySchedule, &trajectoryBuffer) : runDirect(velocitySchedule, &trajectoryBuffer);
+}
+
+
+// Helper functions for run()
+/**
+ * Runs the closed loop with the controller reading the state vector of the simulator directly. Per tick the
+ * controller (when due) computes a control vector from the current state, after which the simulator steps with the
+ * latest control vector whose delay has passed; zero until the first one arrives.
+ *
+ * @param	velocitySchedule : the entries of the reference velocity schedule, in order
+ * @param	trajectoryBuffer : storage for the decimated trajectory (nullptr --> none)
+ * @return	A (StateArray) representing the state vector at the end of the schedule
+ */
+StateArray DroneRopeCargoClosedLoop::runDirect(const std::vector<VelocityScheduleEntry>& velocitySchedule, TrajectoryBuffer* trajectoryBuffer) {
+	// Initialize variables
+	const std::size_t controllerPeriod = std::max<std::size_t>(m_settings.controllerPeriod, 1);
+	StateArray stateVector = m_simulator.getStateArray();
+	ControlArray appliedControlVector{};
+	std::size_t stepIndex = 0;
+
+	// Delay line of (tick to apply at, control vector); holds the control vectors computed within one delay
+	std::vector<std::pair<std::size_t, ControlArray>> delayLine(m_settings.controlDelay / controllerPeriod + 1);
+	std::size_t delayLineFront = 0, delayLineSize = 0;
+
+	for (const VelocityScheduleEntry& entry : velocitySchedule) {
+		m_controller.setVelocityVector({ entry.velocityVector[0], entry.velocityVector[1] });
+
+		const long numberOfSteps = std::lround(entry.duration / m_simulator.getTimeStep());
+		for (long step = 0; step < numberOfSteps; step++) {
+			// Controller
+			if (stepIndex % controllerPeriod == 0) {
+				delayLine[(delayLineFront + delayLineSize) % delayLine.size()] = { stepIndex + m_settings.controlDelay, calculateControlArray(stateVector) };
+				delayLineSize++;
+			}
+
+			// Control vectors whose delay has passed
+			while (delayLineSize > 0 && delayLine[delayLineFront].first <= stepIndex) {
+				appliedControlVector = delayLine[delayLineFront].second;
+				delayLineFront = (delayLineFront + 1) % delayLine.size();
+				delayLineSize--;
+			}
+
+			// Simulator
+			m_simulator.simulationStep(appliedControlVector, stateVector);
+			finishStep(++stepIndex, stateVector, trajectoryBuffer);
+		}
+	}
+
+	return stateVector;
+}
+
+/**
+ * Runs the closed loop with the timing of the ROS nodes. The simulator (HRT) and the controller (SRT) exchange their
+ * vectors through the buffer nodes buffer_hrt_srt (state), buffer_srt_hrt (control) and buffer_nrt_srt (reference
+ * velocity). A buffer node queues up to [bufferCapacity] messages and drops further ones; on its timer it forwards
+ * the oldest message, or a zero message when it is empty. The simulator steps once per control message received.
+ *
+ * All timers fire once per tick (the controller every [controllerPeriod] ticks) and every node acts on the messages
+ * published in the previous tick, being the worst-case phase of the timers: a state vector reaches the controller
+ * one tick after it is published, and its control vector is applied to the simulator one tick after it is computed.
+ *
+ * @param	velocitySchedule : the entries of the reference velocity schedule, in order
+ * @param	trajectoryBuffer : storage for the decimated trajectory (nullptr --> none)
+ * @return	A (StateArray) representing the state vector at the end of the schedule
+ */
+StateArray DroneRopeCargoClosedLoop::runPipeline(const std::vector<VelocityScheduleEntry>& velocitySchedule, TrajectoryBuffer* trajectoryBuffer) {
+	// Initialize variables
+	const std::size_t controllerPeriod = std::max<std::size_t>(m_settings.controllerPeriod, 1);
+	StateArray stateVector = m_simulator.getStateArray();
+	StateArray controllerStateVector{}; // Last state message received by the controller
+	std::size_t stepIndex = 0;
+
+	// Buffer nodes
+	std::deque<StateArray> stateBuffer;						// buffer_hrt_srt
+	std::deque<ControlArray> controlBuffer;					// buffer_srt_hrt
+	std::deque<std::array<double, 2>> velocityBuffer;		// buffer_nrt_srt
+
+	// Delay line of (tick to apply at, control vector) between the controller and buffer_srt_hrt
+	std::vector<std::pair<std::size_t, ControlArray>> delayLine(m_settings.controlDelay / controllerPeriod + 1);
+	std::size_t delayLineFront = 0, delayLineSize = 0;
+
+	for (const VelocityScheduleEntry& entry : velocitySchedule) {
+		const long numberOfSteps = std::lround(entry.duration / m_simulator.getTimeStep());
+		for (long step = 0; step < numberOfSteps; step++) {
+			// buffer_srt_hrt --> simulator (steps once per message)
+			ControlArray controlVector{};
+			if (!controlBuffer.empty()) {
+				controlVector = controlBuffer.front();
+				controlBuffer.pop_front();
+			}
+			m_simulator.simulationStep(controlVector, stateVector);
+
+			// Controller --> buffer_srt_hrt
+			if (stepIndex % controllerPeriod == 0) {
+				delayLine[(delayLineFront + delayLineSize) % delayLine.size()] = { stepIndex + m_settings.controlDelay, calculateControlArray(controllerStateVector) };
+				delayLineSize++;
+			}
+			while (delayLineSize > 0 && delayLine[delayLineFront].first <= stepIndex) {
+				if (controlBuffer.size() < m_settings.bufferCapacity) {
+					controlBuffer.push_back(delayLine[delayLineFront].second);
+				}
+				delayLineFront = (delayLineFront + 1) % delayLine.size();
+				delayLineSize--;
+			}
+
+			// buffer_hrt_srt --> controller
+			controllerStateVector = {};
+			if (!stateBuffer.empty()) {
+				controllerStateVector = stateBuffer.front();
+				stateBuffer.pop_front();
+			}
+
+			// buffer_nrt_srt --> controller
+			std::array<double, 2> velocityVector{};
+			if (!velocityBuffer.empty()) {
+				velocityVector = velocityBuffer.front();
+				velocityBuffer.pop_front();
+			}
+			m_controller.setVelocityVector({ velocityVector[0], velocityVector[1] });
+
+			// Simulator --> buffer_hrt_srt, reference --> buffer_nrt_srt
+			if (stateBuffer.size() < m_settings.bufferCapacity) {
+				stateBuffer.push_back(stateVector);
+			}
+			if (velocityBuffer.size() < m_settings.bufferCapacity) {
+				velocityBuffer.push_back(entry.velocityVector);
+			}
+
+			finishStep(++stepIndex, stateVector, trajectoryBuffer);
+		}
+	}
+
+	return stateVector;
+}
+
+/**
+ * Computes the control vector of the controller for a state vector, with the masses and gravitational constant of
+ * the simulator
+ *
+ * @param	stateVector : the state vector the controller acts on
+ * @return	A (ControlArray) representing the control vector
+ */
+ControlArray DroneRopeCargoClosedLoop::calculateControlArray(const StateArray& stateVector) {
+	const DynamicSystemParameters& parameters = m_simulator.getParameters();
+	const std::vector<double> controlVector = m_controller.calculateReferenceControlVector(m_simulator.getDynamicsType(), parameters.gravitationalConstant,
+																						  parameters.massDrone, stateVector[0], stateVector[3], stateVector[1], stateVector[4], stateVector[2],
+																						  parameters.massCargo, stateVector[5], stateVector[6]);
+	return { controlVector[0], controlVector[1] };
+}
+
+/**
+ * Finishes a tick: saves the state vector to the trajectory buffer (every [decimation] ticks) and, with a real-time
+ * factor, waits until the wall clock has caught up with the simulation
+ *
+ * @param	stepIndex : number of ticks taken in this run
+ * @param	stateVector : the state vector after the tick
+ * @param	trajectoryBuffer : storage for the decimated trajectory (nullptr --> none)
+ */
+void DroneRopeCargoClosedLoop::finishStep(std::size_t stepIndex, const StateArray& stateVector, TrajectoryBuffer* trajectoryBuffer) {
+	// Save sample
+	if (trajectoryBuffer != nullptr && (stepIndex % std::max<std::size_t>(trajectoryBuffer->decimation, 1) == 0)
+		&& trajectoryBuffer->numberOfSamples < trajectoryBuffer->capacity) {
+		trajectoryBuffer->samples[trajectoryBuffer->numberOfSamples++] = { m_simulator.getSimulationTime(), stateVector };
+	}
+
+	// Pace
+	if (m_settings.realTimeFactor > 0) {
+		const std::chrono::duration<double> elapsedTime(double(stepIndex) * m_simulator.getTimeStep() / m_settings.realTimeFactor);
+		std::this_thread::sleep_until(m_runStartTime + std::chrono::duration_cast<std::chrono::steady_clock::duration>(elapsedTime));
+	}
+}
\ No newline at end of file
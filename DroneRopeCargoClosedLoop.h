@@ -0,0 +1,90 @@
+//==============================================================
+// Filename : DroneRopeCargoClosedLoop.h
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class to run the simulator and the feedback
+//				 controller in closed loop within one process,
+//				 without the ROS nodes in between - header
+//==============================================================
+
+// [BEGIN]: Prevent multiple inclusions of header
+#ifndef DRONEROPECARGOCLOSEDLOOP_H
+#define DRONEROPECARGOCLOSEDLOOP_H
+
+
+// Libraries
+#include "DroneRopeCargoSimulator.h"
+#include "DroneControllerControlVector.h"
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+// Timing of the closed loop
+enum class ClosedLoopMode {
+	Direct,		// Controller output reaches the simulator without latency (apart from the control delay)
+	Pipeline	// Timing of the ROS nodes: controller (SRT) and simulator (HRT) coupled by the buffer nodes
+};
+
+// Settings of the closed loop
+struct ClosedLoopSettings {
+	ClosedLoopMode mode = ClosedLoopMode::Direct;
+	std::size_t controllerPeriod = 1;	// Simulator steps per controller update; the control vector is held in between
+	std::size_t controlDelay = 0;		// Simulator steps between computing a control vector and applying it
+	std::size_t bufferCapacity = 10;	// Pipeline: messages a buffer node holds; further messages are dropped
+	double realTimeFactor = 0;			// 0 --> as fast as possible, 1 --> paced to the wall clock, 2 --> twice as fast, ...
+};
+
+// Segment of a reference velocity schedule: the reference velocity is held for the duration
+struct VelocityScheduleEntry {
+	double duration = 0;					// [s]; rounded to a whole number of time steps
+	std::array<double, 2> velocityVector{};	// [m / s]
+};
+
+// DroneRopeCargoClosedLoop-class
+class DroneRopeCargoClosedLoop {
+public:
+	// Constructor (default)
+	DroneRopeCargoClosedLoop();
+
+
+	// Getters (settings)
+	const ClosedLoopSettings& getSettings() const { return m_settings; }
+
+	// Getters (simulator and controller)
+	const DroneRopeCargoSimulator& getSimulator() const { return m_simulator; }
+	DroneRopeCargoSimulator& getSimulator() { return m_simulator; }
+	const DroneControllerControlVector& getController() const { return m_controller; }
+	DroneControllerControlVector& getController() { return m_controller; }
+
+
+	// Setters (settings)
+	void setSettings(const ClosedLoopSettings&);
+
+
+	// Other
+	StateArray run(const std::vector<VelocityScheduleEntry>&);
+	StateArray run(const std::vector<VelocityScheduleEntry>&, TrajectoryBuffer&);
+
+private:
+	// Attributes (settings)
+	ClosedLoopSettings m_settings;
+
+	// Attributes (simulator and controller)
+	DroneRopeCargoSimulator m_simulator;
+	DroneControllerControlVector m_controller;
+
+	// Attributes (wall clock); start of the current run, used for pacing
+	std::chrono::steady_clock::time_point m_runStartTime;
+
+	// Helper functions for run()
+	StateArray runDirect(const std::vector<VelocityScheduleEntry>&, TrajectoryBuffer*);
+	StateArray runPipeline(const std::vector<VelocityScheduleEntry>&, TrajectoryBuffer*);
+	ControlArray calculateControlArray(const StateArray&);
+	void finishStep(std::size_t, const StateArray&, TrajectoryBuffer*);
+};
+
+
+// [END]: Prevent multiple inclusions of header
+#endif
\ No newline at end of file
@@ -9,13 +9,22 @@
 
 // Libraries 
 #include "DroneRopeCargoDynamics.h"
+#include <algorithm>
 #include <cmath>
 
 // Constructor
+DroneRopeCargoDynamics::DroneRopeCargoDynamics() {
+	// Gravitational constant (looked up once)
+	m_parameters.gravitationalConstant = getGravitationalConstant("Earth");
+}
+
 DroneRopeCargoDynamics::DroneRopeCargoDynamics(double dynamicsType, double massDrone, double dragConstantDrone, double ropeLengthInitial, double ropeStiffness, double ropeDamping, double massCargo, double dragConstantCargo)
-	: DroneDynamics(massDrone, dragConstantDrone), RopeProperties(ropeLengthInitial, ropeStiffness, ropeDamping), CargoDynamics(massCargo, dragConstantCargo) {
+	: DroneRopeCargoDynamics() {
 	// Set attributes
 	setDynamicsType(dynamicsType);
+	setConstantDroneParameters(massDrone, dragConstantDrone);
+	setConstantRopeParameters(ropeLengthInitial, ropeStiffness, ropeDamping);
+	setConstantCargoParameters(massCargo, dragConstantCargo);
 };
 
 
@@ -44,36 +53,49 @@ std::vector<double> DroneRopeCargoDynamics::getStateVector() {
 	return stateVector;
 }
 
+/**
+ * Retrieves the state vector of the drone + cargo system as a fixed-size array, without allocating
+ *
+ * @return	A (StateArray) which represents the state vector
+ */
+StateArray DroneRopeCargoDynamics::getStateArray() const {
+	// Construct array from drone (x1 - x5) and cargo (x6 - x9) states
+	return { getXDrone(), getYDrone(), getThetaDrone(), getXDotDrone(), getYDotDrone(),
+			 getXCargo(), getYCargo(), getXDotCargo(), getYDotCargo() };
+}
+
 // Getters (output vector)
 /**
  * Retrieves the output vector of the drone + cargo system
  * 
- * @return	A (std::vector<double>) which represents the output vector
+ * @return	A (std::vector<double>) which represents the output vector (rope length, rope rate of change)
  */
-std::vector<double> DroneRopeCargoDynamics::getOutputVector() {
-
-	// Update output vector
-	setOutputVector();
+std::vector<double> DroneRopeCargoDynamics::getOutputVector() const {
+	// Output vector of the current state vector
+	const OutputArray outputVector = getOutputArray();
 
 	// Return vector
-	return m_outputVector;
+	return { outputVector[0], outputVector[1] };
 };
 
-double DroneRopeCargoDynamics::getRopeLength() {
-	// Update output vector
-	setOutputVector();
-
-	// Return value
-	return m_outputVector[0];
-
+/**
+ * Retrieves the output vector of the drone + cargo system as a fixed-size array, without allocating
+ *
+ * @return	A (OutputArray) which represents the output vector (rope length, rope rate of change, rope angle)
+ */
+OutputArray DroneRopeCargoDynamics::getOutputArray() const {
+	// Cached output vector (if it belongs to the current state vector), otherwise computed without writing the cache
+	return isOutputVectorCurrent() ? m_outputVector : calculateCurrentOutputArray();
 }
 
-double DroneRopeCargoDynamics::getRopeRateOfChange() {
-	// Update output vector
-	setOutputVector();
+double DroneRopeCargoDynamics::getRopeLength() const {
+	// Cached value (if it belongs to the current state vector), otherwise computed without writing the cache
+	return isOutputVectorCurrent() ? m_outputVector[0] : calculateCurrentOutputArray()[0];
+}
 
-	// Return value
-	return m_outputVector[1];
+double DroneRopeCargoDynamics::getRopeRateOfChange() const {
+	// Cached value (if it belongs to the current state vector), otherwise computed without writing the cache
+	return isOutputVectorCurrent() ? m_outputVector[1] : calculateCurrentOutputArray()[1];
 }
 
 // Setters (dynamics type)
@@ -81,6 +103,97 @@ void DroneRopeCargoDynamics::setDynamicsType(bool dynamicsType) {
 	m_dynamicsType = dynamicsType;
 }
 
+// Setters (parameters)
+/**
+ * Sets the parameters of the drone, and updates the parameter block (see getParameters())
+ *
+ * @param	massDrone : mass of the drone [kg]
+ * @param	dragConstantDrone : drag constant of the drone [N s^2 / m^2]
+ */
+void DroneRopeCargoDynamics::setConstantDroneParameters(double massDrone, double dragConstantDrone) {
+	DroneDynamics::setConstantDroneParameters(massDrone, dragConstantDrone);
+
+	m_parameters.massDrone = massDrone;
+	m_parameters.dragConstantDrone = dragConstantDrone;
+	m_parameters.inverseMassDrone = 1 / massDrone;
+}
+
+/**
+ * Sets the parameters of the rope, and updates the parameter block (see getParameters())
+ *
+ * @param	ropeLengthInitial : initial (unstretched) length of the rope [m]
+ * @param	ropeStiffness : stiffness of the rope [N / m]
+ * @param	ropeDamping : damping of the rope [N s / m]
+ */
+void DroneRopeCargoDynamics::setConstantRopeParameters(double ropeLengthInitial, double ropeStiffness, double ropeDamping) {
+	RopeProperties::setConstantRopeParameters(ropeLengthInitial, ropeStiffness, ropeDamping);
+
+	m_parameters.ropeLengthInitial = ropeLengthInitial;
+	m_parameters.ropeStiffness = ropeStiffness;
+	m_parameters.ropeDamping = ropeDamping;
+}
+
+/**
+ * Sets the parameters of the cargo, and updates the parameter block (see getParameters())
+ *
+ * @param	massCargo : mass of the cargo [kg]
+ * @param	dragConstantCargo : drag constant of the cargo [N s^2 / m^2]
+ */
+void DroneRopeCargoDynamics::setConstantCargoParameters(double massCargo, double dragConstantCargo) {
+	CargoDynamics::setConstantCargoParameters(massCargo, dragConstantCargo);
+
+	m_parameters.massCargo = massCargo;
+	m_parameters.dragConstantCargo = dragConstantCargo;
+	m_parameters.inverseMassCargo = 1 / massCargo;
+}
+
+/**
+ * Sets all parameters at once from a parameter block (e.g. one retrieved with getParameters()), including the
+ * gravitational constant and the precomputed reciprocals
+ *
+ * @param	parameters : the parameter block
+ */
+void DroneRopeCargoDynamics::setParameters(const DynamicSystemParameters& parameters) {
+	DroneDynamics::setConstantDroneParameters(parameters.massDrone, parameters.dragConstantDrone);
+	RopeProperties::setConstantRopeParameters(parameters.ropeLengthInitial, parameters.ropeStiffness, parameters.ropeDamping);
+	CargoDynamics::setConstantCargoParameters(parameters.massCargo, parameters.dragConstantCargo);
+
+	m_parameters = parameters;
+}
+
+
+/**
+ * Setters of single parameters: hide those of DroneProperties, RopeProperties and CargoProperties, and go through the
+ * setter of their group (see above), such that the parameter block is updated as well
+ */
+void DroneRopeCargoDynamics::setMassDrone(double massDrone) {
+	setConstantDroneParameters(massDrone, getDragConstantDrone());
+}
+
+void DroneRopeCargoDynamics::setDragConstantDrone(double dragConstantDrone) {
+	setConstantDroneParameters(getMassDrone(), dragConstantDrone);
+}
+
+void DroneRopeCargoDynamics::setRopeLengthInitial(double ropeLengthInitial) {
+	setConstantRopeParameters(ropeLengthInitial, getRopeStiffness(), getRopeDamping());
+}
+
+void DroneRopeCargoDynamics::setRopeStiffness(double ropeStiffness) {
+	setConstantRopeParameters(getRopeLengthInitial(), ropeStiffness, getRopeDamping());
+}
+
+void DroneRopeCargoDynamics::setRopeDamping(double ropeDamping) {
+	setConstantRopeParameters(getRopeLengthInitial(), getRopeStiffness(), ropeDamping);
+}
+
+void DroneRopeCargoDynamics::setMassCargo(double massCargo) {
+	setConstantCargoParameters(massCargo, getDragConstantCargo());
+}
+
+void DroneRopeCargoDynamics::setDragConstantCargo(double dragConstantCargo) {
+	setConstantCargoParameters(getMassCargo(), dragConstantCargo);
+}
+
 // Setters (state vector)
 /**
  *	Sets state vector to object with an input state vector
@@ -101,40 +214,160 @@ void DroneRopeCargoDynamics::setStateVector(std::vector<double> stateVector) {
 
 	// Set state vector of cargo
 	setCargoStateVector(cargoStateVector);
+
+	// Cache output vector
+	updateOutputVector();
 }
 
-// Setters (output vector)
 /**
- *	Calculates the output vector based on the current state vector and saves it to the object
+ *	Sets state vector to object with an input state array, without allocating (also caches the output vector)
+ *
+ *	@param	stateVector	: StateArray
  */
-void DroneRopeCargoDynamics::setOutputVector() {
+void DroneRopeCargoDynamics::setStateArray(const StateArray& stateVector) {
+	// Set state vector
+	setStateArrayWithoutOutput(stateVector);
+
+	// Cache output vector
+	updateOutputVector();
+}
+
+/**
+ *	Sets state vector to object with an input state array together with its output vector (e.g. one retrieved with
+ *	getOutputArray() for this state vector), which is cached without computing it
+ *
+ *	@param	stateVector	: StateArray
+ *	@param	outputVector : the output vector of the state vector
+ */
+void DroneRopeCargoDynamics::setStateArray(const StateArray& stateVector, const OutputArray& outputVector) {
+	// Set state vector
+	setStateArrayWithoutOutput(stateVector);
+
+	// Cache output vector
+	setOutputArray(outputVector);
+}
 
-	// Compute output vector
-	std::vector<double> outputVector = calculateOutputVector();
+// Helper functions for setStateArray()
+void DroneRopeCargoDynamics::setStateArrayWithoutOutput(const StateArray& stateVector) {
+	// Set state vector of drone
+	setXDrone(stateVector[0]);
+	setYDrone(stateVector[1]);
+	setThetaDrone(stateVector[2]);
+	setXDotDrone(stateVector[3]);
+	setYDotDrone(stateVector[4]);
 
-	// Save new rope length
-	setRopeLength(outputVector[0]);
+	// Set state vector of cargo
+	setXCargo(stateVector[5]);
+	setYCargo(stateVector[6]);
+	setXDotCargo(stateVector[7]);
+	setYDotCargo(stateVector[8]);
+}
 
-	// Save new rope rate of change
-	setRopeRateOfChange(outputVector[1]);
+// Setters (output vector)
+/**
+ *	Calculates the output vector based on the current state vector and saves it to the object
+ *	(nothing is computed if the output vector already belongs to the current state vector)
+ */
+void DroneRopeCargoDynamics::setOutputVector() {
+	updateOutputVector();
 };
 
+/**
+ *	Saves an output vector (e.g. one retrieved with getOutputArray()) as the output vector of the current state vector,
+ *	without computing it; it is kept until the state vector changes
+ *
+ *	@param	outputVector : the output vector
+ */
+void DroneRopeCargoDynamics::setOutputArray(const OutputArray& outputVector) {
+	m_outputVector = outputVector;
+	m_outputDroneStateRevision = getDroneStateRevision();
+	m_outputCargoStateRevision = getCargoStateRevision();
+}
+
+/**
+ *	Overrides a value of the output vector of the current state vector (the other values are computed if needed). The
+ *	value is returned by the getters (and used by the integration) until the state vector changes, after which the output
+ *	vector is computed from the state vector again
+ *
+ *	@param	ropeLength : the rope length [m]
+ */
 void DroneRopeCargoDynamics::setRopeLength(double ropeLength) {
+	updateOutputVector();
 	m_outputVector[0] = ropeLength;
 };
 
 void DroneRopeCargoDynamics::setRopeRateOfChange(double ropeRateOfChange) {
+	updateOutputVector();
 	m_outputVector[1] = ropeRateOfChange;
 };
 
+void DroneRopeCargoDynamics::setRopeAngle(double ropeAngle) {
+	updateOutputVector();
+	m_outputVector[2] = ropeAngle;
+};
+
 
 // Calculate (output vector)
 /**
- * Computes the output vector of the drone + cargo system
+ * Checks whether the cached output vector belongs to the current state vector (the state revisions of drone and cargo
+ * are unchanged since it was saved)
  *
- * @return	A (std::vector<double>) which represents the computation of the output vector
+ * @return	A type (bool) which is true if the cache is valid
+ */
+bool DroneRopeCargoDynamics::isOutputVectorCurrent() const {
+	return (m_outputDroneStateRevision == getDroneStateRevision()) && (m_outputCargoStateRevision == getCargoStateRevision());
+}
+
+/**
+ * Computes the output vector of the drone + cargo system from the current state vector, without touching the cache. The
+ * rope length, rope rate of change (as in calculateOutputArray()) and rope angle are computed in one pass.
+ *
+ * @return	A (OutputArray) which represents the output vector (rope length, rope rate of change, rope angle)
  */
-std::vector<double> DroneRopeCargoDynamics::calculateOutputVector() {
+OutputArray DroneRopeCargoDynamics::calculateCurrentOutputArray() const {
+
+	// Rope vector (drone relative to cargo)
+	const double ropeX = getXDrone() - getXCargo();
+	const double ropeY = getYDrone() - getYCargo();
+
+	// Calculation of rope length (y1)
+	const double ropeLength = sqrt(ropeX * ropeX + ropeY * ropeY);
+
+	// Calculation of rope rate of change (y2); division by zero prevented
+	const double ropeRateOfChangePart1 = ropeX + (getXDotDrone() - getXDotCargo());
+	const double ropeRateOfChangePart2 = ropeY + (getYDotDrone() - getYDotCargo());
+	const double ropeRateOfChange = (ropeLength == 0) ? 0 : (ropeRateOfChangePart1 + ropeRateOfChangePart2) / ropeLength;
+
+	// Calculation of rope angle (y3), cargo relative to drone
+	const double ropeAngle = atan2(getXCargo() - getXDrone(), getYCargo() - getYDrone());
+
+	// Return array
+	return { ropeLength, ropeRateOfChange, ropeAngle };
+}
+
+/**
+ * Computes the output vector of the current state vector and caches it, unless the cache is already valid
+ */
+void DroneRopeCargoDynamics::updateOutputVector() {
+	// Cache is valid
+	if (isOutputVectorCurrent()) {
+		return;
+	}
+
+	// Save to cache
+	m_outputVector = calculateCurrentOutputArray();
+	m_outputDroneStateRevision = getDroneStateRevision();
+	m_outputCargoStateRevision = getCargoStateRevision();
+}
+
+/**
+ * Computes the output vector of the drone + cargo system from a given state vector, without allocating.
+ * Only the rope length (y1) and rope rate of change (y2) are computed; the rope angle (y3) is set to zero.
+ *
+ * @param	stateVector : the state vector of the system
+ * @param	outputVector : array the computed output vector is written to
+ */
+void DroneRopeCargoDynamics::calculateOutputArray(const StateArray& stateVector, OutputArray& outputVector) {
 	/* NOTATIONS:
 		x1 : xDrone           y1: rope length
 		x2 : yDrone           y2: rope rate of change
@@ -147,20 +380,17 @@ std::vector<double> DroneRopeCargoDynamics::calculateOutputVector() {
 		x9 : yDotCargo
 	*/
 
-	// Initialize vector
-	std::vector<double> outputVector{};
-
 	// Calculation of rope length (y1)
 	double ropeLength{};
 
-	ropeLength = sqrt(pow(getXDrone() - getXCargo(), 2) + pow(getYDrone() - getYCargo(), 2));
+	ropeLength = sqrt(pow(stateVector[0] - stateVector[5], 2) + pow(stateVector[1] - stateVector[6], 2));
 
 	// Calculation of rope rate of change (y2)
 	double ropeRateOfChange{};
 	double ropeRateOfChangePart1{}, ropeRateOfChangePart2{};
 
-	ropeRateOfChangePart1 = (getXDrone() - getXCargo()) + (getXDotDrone() - getXDotCargo());	// Part 1
-	ropeRateOfChangePart2 = (getYDrone() - getYCargo()) + (getYDotDrone() - getYDotCargo());	// Part 2
+	ropeRateOfChangePart1 = (stateVector[0] - stateVector[5]) + (stateVector[3] - stateVector[7]);	// Part 1
+	ropeRateOfChangePart2 = (stateVector[1] - stateVector[6]) + (stateVector[4] - stateVector[8]);	// Part 2
 
 	// Prevent division by zero
 	if (ropeLength == 0) {
@@ -170,12 +400,8 @@ std::vector<double> DroneRopeCargoDynamics::calculateOutputVector() {
 		ropeRateOfChange = (ropeRateOfChangePart1 + ropeRateOfChangePart2) / ropeLength;
 	}
 
-
-	// Construct vector
-	outputVector = { ropeLength, ropeRateOfChange };
-
-	// Return vector
-	return outputVector;
+	// Construct array
+	outputVector = { ropeLength, ropeRateOfChange, 0 };
 }
 
 // Calculate (state derivative)
@@ -190,6 +416,36 @@ std::vector<double> DroneRopeCargoDynamics::calculateOutputVector() {
  * @return	A (std::vector<double>) which represents the computation of the output vector
  */
 std::vector<double> DroneRopeCargoDynamics::calculateDerivativeStateVector(std::vector<double> stateVector, std::vector<double> controlVector, std::vector<double> outputVector, std::vector<double> parametersList, bool dynamicsType) {
+	// Initialize arrays
+	StateArray stateArray{}, dynamicsStateArray{};
+	ControlArray controlArray{};
+	OutputArray outputArray{};
+	ParameterArray parameterArray{};
+
+	// Copy vectors into arrays (the output vector may or may not contain the rope angle)
+	std::copy_n(stateVector.begin(), stateArray.size(), stateArray.begin());
+	std::copy_n(controlVector.begin(), controlArray.size(), controlArray.begin());
+	std::copy_n(outputVector.begin(), std::min(outputVector.size(), outputArray.size()), outputArray.begin());
+	std::copy_n(parametersList.begin(), parameterArray.size(), parameterArray.begin());
+
+	// Compute derivative
+	calculateDerivativeStateVector(stateArray, controlArray, outputArray, parameterArray, dynamicsType, dynamicsStateArray);
+
+	// Return vector
+	return std::vector<double>(dynamicsStateArray.begin(), dynamicsStateArray.end());
+}
+
+/**
+ * Computes the derivative of the state vector of the drone + cargo system, without allocating
+ *
+ * @param	stateVector : the current state vector of the system
+ * @param	controlVector : the current control vector
+ * @param	outputVector : the current output vector of the system
+ * @param	parameters : parameter block of the system (see DynamicSystemParameters)
+ * @param	dynamics : specifies the dynamics type to be used of the system
+ * @param	dynamicsStateVector : array the derivative of the state vector is written to
+ */
+void DroneRopeCargoDynamics::calculateDerivativeStateVector(const StateArray& stateVector, const ControlArray& controlVector, const OutputArray& outputVector, const DynamicSystemParameters& parameters, bool dynamicsType, StateArray& dynamicsStateVector) {
 	/* NOTATIONS:
 		x1* : xDrone		u1 : tauDrone			y1 : rope length
 		x2* : yDrone		u2 : omegaDrone			y2 : rope rate of change
@@ -213,9 +469,6 @@ std::vector<double> DroneRopeCargoDynamics::calculateDerivativeStateVector(std::
 		7 : drag constant cargo
 	*/
 
-	// Intialize vector
-	std::vector<double> dynamicsStateVector{};
-
 	// Initialize states
 	double xDot1{}, xDot2{}, xDot3{}, xDot4{}, xDot5{}, xDot6{}, xDot7{}, xDot8{}, xDot9{};
 
@@ -232,39 +485,39 @@ std::vector<double> DroneRopeCargoDynamics::calculateDerivativeStateVector(std::
 
 	if (dynamicsType == false) { // Default case
 		// Calculate change in x-velocity drone - ACCELERATION (x4*)
-		xDot4 = (1 / parametersList[1]) *	// Mass drone														
+		xDot4 = parameters.inverseMassDrone *	// Mass drone														
 				(
 				calculateThrustComponent(false, controlVector[0], stateVector[2])									// Thrust in x-drone
-				- calculateDragComponent(false, parametersList[2], stateVector[3], stateVector[4])				    // Drag in x-drone
+				- calculateDragComponent(false, parameters.dragConstantDrone, stateVector[3], stateVector[4])				    // Drag in x-drone
 				);
 
 		// Calculate change in y-velocity drone - ACCELERATION (x5*)					
-		xDot5 = (1 / parametersList[1]) *	// Mass drone														
+		xDot5 = parameters.inverseMassDrone *	// Mass drone														
 			(
 				calculateThrustComponent(true, controlVector[0], stateVector[2])									// Thrust in y-drone
-				- calculateDragComponent(true, parametersList[2], stateVector[3], stateVector[4])					// Drag in y-drone
+				- calculateDragComponent(true, parameters.dragConstantDrone, stateVector[3], stateVector[4])					// Drag in y-drone
 				)																									
-				- parametersList[0];																				// Gravity in y
+				- parameters.gravitationalConstant;																				// Gravity in y
 	}
 	else if (dynamicsType == true) { // With cargo
 		// Calculate change in x-velocity drone - ACCELERATION (x4*)
-		xDot4 = (1 / parametersList[1]) *	// Mass drone
+		xDot4 = parameters.inverseMassDrone *	// Mass drone
 				(
 				calculateThrustComponent(false, controlVector[0], stateVector[2])									// Thrust in x-drone
-				- calculateDragComponent(false, parametersList[2], stateVector[3], stateVector[4])					// Drag in x-drone
+				- calculateDragComponent(false, parameters.dragConstantDrone, stateVector[3], stateVector[4])					// Drag in x-drone
 				- calculateRopeForceComponent(stateVector[0], stateVector[5], outputVector[0], outputVector[1],		// Rope force in x
-					parametersList[3], parametersList[4], parametersList[5])										//   ...
+					parameters.ropeLengthInitial, parameters.ropeDamping, parameters.ropeStiffness)										//   ...
 				);
 
 		// Calculate change in y-velocity drone - ACCELERATION (x5*)
-		xDot5 = (1 / parametersList[1]) *	// Mass drone
+		xDot5 = parameters.inverseMassDrone *	// Mass drone
 			(
 				calculateThrustComponent(true, controlVector[0], stateVector[2])									// Thrust in y-drone
-				- calculateDragComponent(true, parametersList[2], stateVector[3], stateVector[4])					// Drag in y-drone
+				- calculateDragComponent(true, parameters.dragConstantDrone, stateVector[3], stateVector[4])					// Drag in y-drone
 				- calculateRopeForceComponent(stateVector[1], stateVector[6], outputVector[0], outputVector[1],		// Rope force in y
-					parametersList[3], parametersList[4], parametersList[5])										//   ...
+					parameters.ropeLengthInitial, parameters.ropeDamping, parameters.ropeStiffness)										//   ...
 				)
-				- parametersList[0];																				// Gravity in y;
+				- parameters.gravitationalConstant;																				// Gravity in y;
 	}
 
 	/* ---------------------------------------------------- CARGO ---------------------------------------------------- */
@@ -284,29 +537,196 @@ std::vector<double> DroneRopeCargoDynamics::calculateDerivativeStateVector(std::
 		xDot7 = stateVector[8];
 
 		// Calculate change in x-velocity cargo - ACCELERATION (x8*)
-		xDot8 = (1 / parametersList[6]) *	// Mass cargo
+		xDot8 = parameters.inverseMassCargo *	// Mass cargo
 				(
-				-calculateDragComponent(false, parametersList[7], stateVector[7], stateVector[8])					// Drag in x-cargo
+				-calculateDragComponent(false, parameters.dragConstantCargo, stateVector[7], stateVector[8])					// Drag in x-cargo
 				+ calculateRopeForceComponent(stateVector[0], stateVector[5], outputVector[0], outputVector[1],		// Rope force in x
-											  parametersList[3], parametersList[4], parametersList[5])				//     ... 
+											  parameters.ropeLengthInitial, parameters.ropeDamping, parameters.ropeStiffness)				//     ... 
 				);
 
 		// Calculate change in y-velocity cargo - ACCELERATION (x9*)
-		xDot9 = (1 / parametersList[6]) *	// Mass cargo
+		xDot9 = parameters.inverseMassCargo *	// Mass cargo
 				(
-				-calculateDragComponent(true, parametersList[7], stateVector[7], stateVector[8])					// Drag in y-cargo
+				-calculateDragComponent(true, parameters.dragConstantCargo, stateVector[7], stateVector[8])					// Drag in y-cargo
 				+ calculateRopeForceComponent(stateVector[1], stateVector[6], outputVector[0], outputVector[1],		// Rope force in y
-					parametersList[3], parametersList[4], parametersList[5])										//     ... 
+					parameters.ropeLengthInitial, parameters.ropeDamping, parameters.ropeStiffness)										//     ... 
 				)
-				- parametersList[0];																				// Gravity in y
+				- parameters.gravitationalConstant;																				// Gravity in y
 	}
 	/* ---------------------------------------------------------------------------------------------------------------- */
 
-	// Construct vector
+	// Construct array
 	dynamicsStateVector = { xDot1, xDot2, xDot3, xDot4, xDot5, xDot6, xDot7, xDot8, xDot9 };
+}
+
+/**
+ * Computes the derivative of the state vector of the drone + cargo system in a single pass, without allocating.
+ * Gives the same result as calculateDerivativeStateVector(), but every shared quantity (sine/cosine of the drone angle,
+ * velocity norms of drone and cargo, overall rope force) is computed once instead of once per component.
+ *
+ * @param	stateVector : the current state vector of the system
+ * @param	controlVector : the current control vector
+ * @param	outputVector : the current output vector of the system
+ * @param	parameters : parameter block of the system (see DynamicSystemParameters)
+ * @param	dynamics : specifies the dynamics type to be used of the system
+ * @param	dynamicsStateVector : array the derivative of the state vector is written to
+ */
+void DroneRopeCargoDynamics::calculateDerivativeStateVectorFused(const StateArray& stateVector, const ControlArray& controlVector, const OutputArray& outputVector, const DynamicSystemParameters& parameters, bool dynamicsType, StateArray& dynamicsStateVector) {
+	if (dynamicsType == false) { // Default case
+		calculateDerivativeStateVectorSpecialized<false>(stateVector, controlVector, outputVector, parameters, dynamicsStateVector);
+
+		// Cargo
+		dynamicsStateVector[5] = 0;
+		dynamicsStateVector[6] = 0;
+		dynamicsStateVector[7] = 0;
+		dynamicsStateVector[8] = 0;
+	}
+	else {
+		calculateDerivativeStateVectorSpecialized<true>(stateVector, controlVector, outputVector, parameters, dynamicsStateVector);
+	}
+}
+
+/**
+ * Computes the slow part of the derivative of the state vector: the forces acting on the drone only (thrust, drag drone,
+ * gravity) and the angular velocity. Together with calculateDerivativeStateVectorFast() it sums to calculateDerivativeStateVector().
+ * Used by multi-rate integration, where this part is held constant over a drone time step.
+ *
+ * @param	stateVector : the current state vector of the system
+ * @param	controlVector : the current control vector
+ * @param	outputVector : the current output vector of the system (not used)
+ * @param	parameters : parameter block of the system (see DynamicSystemParameters)
+ * @param	dynamics : specifies the dynamics type to be used of the system
+ * @param	dynamicsStateVector : array the slow part of the derivative of the state vector is written to
+ */
+void DroneRopeCargoDynamics::calculateDerivativeStateVectorSlow(const StateArray& stateVector, const ControlArray& controlVector, const OutputArray&, const DynamicSystemParameters& parameters, bool dynamicsType, StateArray& dynamicsStateVector) {
+	/* NOTATIONS AND PARAMETER LIST CONVENTION: see calculateDerivativeStateVector() */
+
+	// Initialize states
+	dynamicsStateVector = {};
+
+	/* ---------------------------------------------------- DRONE ---------------------------------------------------- */
+
+	// Calculate change in theta-position drone - ANGULAR VELOCITY (x3*)
+	dynamicsStateVector[2] = controlVector[1];
+
+	// Calculate change in x-velocity drone - ACCELERATION (x4*)
+	dynamicsStateVector[3] = parameters.inverseMassDrone *	// Mass drone
+							 (
+							 calculateThrustComponent(false, controlVector[0], stateVector[2])							// Thrust in x-drone
+							 - calculateDragComponent(false, parameters.dragConstantDrone, stateVector[3], stateVector[4])			// Drag in x-drone
+							 );
+
+	// Calculate change in y-velocity drone - ACCELERATION (x5*)
+	dynamicsStateVector[4] = parameters.inverseMassDrone *	// Mass drone
+							 (
+							 calculateThrustComponent(true, controlVector[0], stateVector[2])							// Thrust in y-drone
+							 - calculateDragComponent(true, parameters.dragConstantDrone, stateVector[3], stateVector[4])			// Drag in y-drone
+							 )
+							 - parameters.gravitationalConstant;																		// Gravity in y
+
+	/* ---------------------------------------------------- CARGO ---------------------------------------------------- */
+
+	if (dynamicsType == true) { // With cargo
+		// Calculate change in y-velocity cargo - ACCELERATION (x9*)
+		dynamicsStateVector[8] = -parameters.gravitationalConstant;																	// Gravity in y
+	}
+}
+
+/**
+ * Computes the fast part of the derivative of the state vector: the velocities and the forces that couple drone and cargo
+ * (rope force), plus the drag of the (light) cargo. Together with calculateDerivativeStateVectorSlow() it sums to
+ * calculateDerivativeStateVector(). Used by multi-rate integration, where this part is substepped.
+ *
+ * @param	stateVector : the current state vector of the system
+ * @param	controlVector : the current control vector (not used)
+ * @param	outputVector : the current output vector of the system
+ * @param	parameters : parameter block of the system (see DynamicSystemParameters)
+ * @param	dynamics : specifies the dynamics type to be used of the system
+ * @param	dynamicsStateVector : array the fast part of the derivative of the state vector is written to
+ */
+void DroneRopeCargoDynamics::calculateDerivativeStateVectorFast(const StateArray& stateVector, const ControlArray&, const OutputArray& outputVector, const DynamicSystemParameters& parameters, bool dynamicsType, StateArray& dynamicsStateVector) {
+	/* NOTATIONS AND PARAMETER LIST CONVENTION: see calculateDerivativeStateVector() */
+
+	// Initialize states
+	dynamicsStateVector = {};
+
+	/* ---------------------------------------------------- DRONE ---------------------------------------------------- */
 
-	// Save computed dynamics vector to object
-	return dynamicsStateVector;
+	// Calculate change in x/y-position drone - VELOCITY (x1*, x2*)
+	dynamicsStateVector[0] = stateVector[3];
+	dynamicsStateVector[1] = stateVector[4];
+
+	if (dynamicsType == false) { // Default case
+		return;
+	}
+
+	// Rope force in x/y (computed once)
+	double ropeForceX{}, ropeForceY{};
+
+	if (outputVector[0] != 0) {
+		const double ropeForce = calculateRopeForce(outputVector[0], outputVector[1], parameters.ropeLengthInitial, parameters.ropeDamping, parameters.ropeStiffness);
+		ropeForceX = ropeForce * ((stateVector[0] - stateVector[5]) / outputVector[0]);
+		ropeForceY = ropeForce * ((stateVector[1] - stateVector[6]) / outputVector[0]);
+	}
+
+	// Calculate change in x/y-velocity drone - ACCELERATION (x4*, x5*)
+	dynamicsStateVector[3] = -ropeForceX / parameters.massDrone;
+	dynamicsStateVector[4] = -ropeForceY / parameters.massDrone;
+
+	/* ---------------------------------------------------- CARGO ---------------------------------------------------- */
+
+	// Calculate change in x/y-position cargo - VELOCITY (x6*, x7*)
+	dynamicsStateVector[5] = stateVector[7];
+	dynamicsStateVector[6] = stateVector[8];
+
+	// Calculate change in x/y-velocity cargo - ACCELERATION (x8*, x9*)
+	dynamicsStateVector[7] = parameters.inverseMassCargo * (-calculateDragComponent(false, parameters.dragConstantCargo, stateVector[7], stateVector[8]) + ropeForceX);
+	dynamicsStateVector[8] = parameters.inverseMassCargo * (-calculateDragComponent(true, parameters.dragConstantCargo, stateVector[7], stateVector[8]) + ropeForceY);
+}
+
+/**
+ * Computes the time scale of the rope-cargo oscillation, being the inverse of the largest rate of the rope mode
+ * (undamped angular frequency plus damping rate, using the reduced mass of drone and cargo).
+ * RK4 is stable up to ~2.8 times this time scale, such that it is a safe (fast) time step.
+ *
+ * @param	parameters : parameter block of the system (see DynamicSystemParameters)
+ * @return	A type (double) which is the time scale of the rope [s]; zero if there is no rope stiffness or damping
+ */
+double DroneRopeCargoDynamics::calculateRopeTimeStep(const DynamicSystemParameters& parameters) {
+	// Reduced mass of drone and cargo
+	const double reducedMass = (parameters.massDrone * parameters.massCargo) / (parameters.massDrone + parameters.massCargo);
+
+	// Rates of the rope mode
+	const double angularFrequency = sqrt(parameters.ropeStiffness / reducedMass);
+	const double dampingRate = parameters.ropeDamping / reducedMass;
+
+	// Account for a rope without stiffness and damping
+	if (angularFrequency + dampingRate == 0) {
+		return 0;
+	}
+
+	// Return value
+	return 1 / (angularFrequency + dampingRate);
+}
+
+/**
+ * Computes the switching function of the rope, being the rope force before it is clipped in calculateRopeForce():
+ *
+ *		s = stiffness * (ropeLength - ropeInitialLength) + damping * ropeRateOfChange
+ *
+ * The rope is taut (pulls) for s > 0 and slack for s <= 0. The derivative equation has a kink where s crosses zero.
+ *
+ * @param	stateVector : the state vector of the system
+ * @param	parameters : parameter block of the system (see DynamicSystemParameters)
+ * @return	A type (double) which is the value of the switching function [N]
+ */
+double DroneRopeCargoDynamics::calculateRopeSwitchingFunction(const StateArray& stateVector, const DynamicSystemParameters& parameters) {
+	// Output vector (rope length and rope rate of change) of the state
+	OutputArray outputVector{};
+	calculateOutputArray(stateVector, outputVector);
+
+	// Return value
+	return parameters.ropeStiffness * (outputVector[0] - parameters.ropeLengthInitial) + parameters.ropeDamping * outputVector[1];
 }
 
 /**
@@ -435,4 +855,156 @@ double DroneRopeCargoDynamics::calculateRopeForce(double ropeLength, double rope
 
 	// Return value
 	return ropeForce;
+}
+
+
+// Calculate (jacobian of state derivative)
+/**
+ * Computes the Jacobians df/dx and df/du of the derivative equation calculateDerivativeStateVector() in closed form.
+ * The output vector is not an argument: it follows from the state vector as in calculateOutputArray(), so the
+ * derivatives of rope length and rope rate of change w.r.t. the state are included. When the rope is slack (rope force
+ * is zero), the rope terms vanish, matching the branch in calculateRopeForce().
+ *
+ * @param	stateVector : the state vector to linearize around
+ * @param	controlVector : the control vector to linearize around
+ * @param	parameters : parameter block of the system (see DynamicSystemParameters)
+ * @param	dynamicsType : specifies the dynamics type to be used of the system
+ * @param	stateJacobian : matrix (9x9, row-major) the Jacobian df/dx is written to
+ * @param	controlJacobian : matrix (9x2, row-major) the Jacobian df/du is written to
+ */
+void DroneRopeCargoDynamics::calculateJacobian(const StateArray& stateVector, const ControlArray& controlVector, const DynamicSystemParameters& parameters, bool dynamicsType,
+											   StateJacobianArray& stateJacobian, ControlJacobianArray& controlJacobian) {
+	/* HERE:
+		J(i, j) = d(xDot(i+1)) / d(x(j+1))		[stateJacobian]
+		B(i, j) = d(xDot(i+1)) / d(u(j+1))		[controlJacobian]
+	*/
+
+	// Initialize matrices
+	stateJacobian = {};
+	controlJacobian = {};
+
+	/* ---------------------------------------------------- DRONE ---------------------------------------------------- */
+
+	// Velocities (x1*, x2*) and angular velocity (x3*)
+	stateJacobian[0][3] = 1;
+	stateJacobian[1][4] = 1;
+	controlJacobian[2][1] = 1;
+
+	// Thrust (x4*, x5*)
+	const double sinTheta = sin(stateVector[2]);
+	const double cosTheta = cos(stateVector[2]);
+
+	stateJacobian[3][2] = -controlVector[0] * cosTheta / parameters.massDrone;
+	stateJacobian[4][2] = -controlVector[0] * sinTheta / parameters.massDrone;
+	controlJacobian[3][0] = -sinTheta / parameters.massDrone;
+	controlJacobian[4][0] = cosTheta / parameters.massDrone;
+
+	// Drag (x4*, x5*)
+	double dragXX{}, dragXY{}, dragYY{};
+	calculateDragJacobian(parameters.dragConstantDrone, stateVector[3], stateVector[4], dragXX, dragXY, dragYY);
+
+	stateJacobian[3][3] = -dragXX / parameters.massDrone;
+	stateJacobian[3][4] = -dragXY / parameters.massDrone;
+	stateJacobian[4][3] = -dragXY / parameters.massDrone;
+	stateJacobian[4][4] = -dragYY / parameters.massDrone;
+
+	if (dynamicsType == false) { // Default case
+		return;
+	}
+
+	/* ---------------------------------------------------- CARGO ---------------------------------------------------- */
+
+	// Velocities (x6*, x7*)
+	stateJacobian[5][7] = 1;
+	stateJacobian[6][8] = 1;
+
+	// Drag (x8*, x9*)
+	calculateDragJacobian(parameters.dragConstantCargo, stateVector[7], stateVector[8], dragXX, dragXY, dragYY);
+
+	stateJacobian[7][7] = -dragXX / parameters.massCargo;
+	stateJacobian[7][8] = -dragXY / parameters.massCargo;
+	stateJacobian[8][7] = -dragXY / parameters.massCargo;
+	stateJacobian[8][8] = -dragYY / parameters.massCargo;
+
+	/* ----------------------------------------------------- ROPE ----------------------------------------------------- */
+
+	// Output vector (rope length and rope rate of change) from state
+	OutputArray outputVector{};
+	calculateOutputArray(stateVector, outputVector);
+
+	const double ropeLength = outputVector[0];
+	const double ropeForce = calculateRopeForce(outputVector[0], outputVector[1], parameters.ropeLengthInitial, parameters.ropeDamping, parameters.ropeStiffness);
+
+	// No rope force component (see calculateRopeForceComponent()) and no change of it around a slack rope
+	if (ropeLength == 0) {
+		return;
+	}
+
+	// Unit vector from cargo to drone
+	const double unitX = (stateVector[0] - stateVector[5]) / ropeLength;
+	const double unitY = (stateVector[1] - stateVector[6]) / ropeLength;
+
+	// Derivatives of rope length (y1) and rope rate of change (y2) w.r.t. the state
+	StateArray ropeLengthGradient{}, ropeRateOfChangeGradient{};
+
+	ropeLengthGradient[0] = unitX;
+	ropeLengthGradient[1] = unitY;
+	ropeLengthGradient[5] = -unitX;
+	ropeLengthGradient[6] = -unitY;
+
+	const StateArray ropeRateOfChangeNumeratorGradient = { 1, 1, 0, 1, 1, -1, -1, -1, -1 };
+	for (std::size_t j = 0; j < stateVector.size(); j++) {
+		ropeRateOfChangeGradient[j] = (ropeRateOfChangeNumeratorGradient[j] - outputVector[1] * ropeLengthGradient[j]) / ropeLength;
+	}
+
+	// Derivatives of rope force components w.r.t. the state
+	for (std::size_t j = 0; j < stateVector.size(); j++) {
+		// Overall rope force (only when the rope pulls)
+		double ropeForceGradient{};
+		if (ropeForce > 0) {
+			ropeForceGradient = parameters.ropeStiffness * ropeLengthGradient[j] + parameters.ropeDamping * ropeRateOfChangeGradient[j];
+		}
+
+		// Direction of the rope
+		const double unitXGradient = (((j == 0) ? 1.0 : (j == 5) ? -1.0 : 0.0) - unitX * ropeLengthGradient[j]) / ropeLength;
+		const double unitYGradient = (((j == 1) ? 1.0 : (j == 6) ? -1.0 : 0.0) - unitY * ropeLengthGradient[j]) / ropeLength;
+
+		// Rope force components (product rule)
+		const double ropeForceXGradient = ropeForceGradient * unitX + ropeForce * unitXGradient;
+		const double ropeForceYGradient = ropeForceGradient * unitY + ropeForce * unitYGradient;
+
+		// Drone is pulled towards cargo, cargo is pulled towards drone
+		stateJacobian[3][j] -= ropeForceXGradient / parameters.massDrone;
+		stateJacobian[4][j] -= ropeForceYGradient / parameters.massDrone;
+		stateJacobian[7][j] += ropeForceXGradient / parameters.massCargo;
+		stateJacobian[8][j] += ropeForceYGradient / parameters.massCargo;
+	}
+}
+
+/**
+ * Computes the derivatives of the drag components of calculateDragComponent() w.r.t. the velocities
+ *
+ * @param	dragConstant : drag constant of an element
+ * @param	xVelocity : horizontal velocity of an element
+ * @param	yVelocity : vertical velocity of an element
+ * @param	dragXX : derivative of the x-drag w.r.t. the x-velocity
+ * @param	dragXY : derivative of the x-drag w.r.t. the y-velocity (equal to the y-drag w.r.t. the x-velocity)
+ * @param	dragYY : derivative of the y-drag w.r.t. the y-velocity
+ */
+void DroneRopeCargoDynamics::calculateDragJacobian(double dragConstant, double xVelocity, double yVelocity, double& dragXX, double& dragXY, double& dragYY) {
+	// Initialize variables
+	const double velocity = sqrt(pow(xVelocity, 2) + pow(yVelocity, 2));
+
+	// Drag is quadratic in velocity, so its derivative vanishes at rest (account for division by zero)
+	if (velocity == 0) {
+		dragXX = 0;
+		dragXY = 0;
+		dragYY = 0;
+		return;
+	}
+
+	// Compute
+	dragXX = dragConstant * (velocity + xVelocity * xVelocity / velocity);
+	dragXY = dragConstant * (xVelocity * yVelocity / velocity);
+	dragYY = dragConstant * (velocity + yVelocity * yVelocity / velocity);
 }
\ No newline at end of file
@@ -17,12 +17,15 @@
 #include "RopeProperties.h"
 #include "CargoDynamics.h"
 #include "GravitationalConstants.h"
+#include "DynamicSystemArrays.h"
+#include <cmath>
+#include <cstdint>
 
 // DroneRopeCargoDynamics-class
 class DroneRopeCargoDynamics : public DroneDynamics, public RopeProperties, public CargoDynamics, public GravitationalConstants {
 public:
 	// Constructor (default)
-	DroneRopeCargoDynamics() = default;
+	DroneRopeCargoDynamics();
 
 	// Constructor (with arguments)
 	DroneRopeCargoDynamics(double dynamicsType, double massDrone, double dragConstantDrone, double ropeLengthInitial, double ropeStiffness, double ropeDamping, double massCargo, double dragConstantCargo);
@@ -34,45 +37,168 @@ public:
 	// Getters (dynamics type)
 	bool getDynamicsType() const { return m_dynamicsType; }
 
+	// Getters (parameters)
+	const DynamicSystemParameters& getParameters() const { return m_parameters; }
+
 	// Getters (state vector)
 	std::vector<double> getStateVector();
+	StateArray getStateArray() const;
 
-	// Getters (output vector)
-	virtual std::vector<double> getOutputVector(); // Main
-	double getRopeLength();
-	double getRopeRateOfChange();
+	// Getters (output vector); read-only: served from the cache if it belongs to the current state vector, otherwise
+	// computed without caching (safe to call concurrently on a shared object)
+	virtual std::vector<double> getOutputVector() const; // Main
+	virtual OutputArray getOutputArray() const;
+	double getRopeLength() const;
+	double getRopeRateOfChange() const;
 
 	// Setters (dynamics type)
 	void setDynamicsType(bool);
 
-	// Setters (state vector)
+	// Setters (parameters); also update the parameter block
+	virtual void setConstantDroneParameters(double, double);
+	virtual void setConstantRopeParameters(double, double, double);
+	virtual void setConstantCargoParameters(double, double);
+	virtual void setParameters(const DynamicSystemParameters&); // Whole block, including the gravitational constant
+	void setMassDrone(double);
+	void setDragConstantDrone(double);
+	void setRopeLengthInitial(double);
+	void setRopeStiffness(double);
+	void setRopeDamping(double);
+	void setMassCargo(double);
+	void setDragConstantCargo(double);
+
+	// Setters (state vector); also cache the output vector of the new state vector
 	void setStateVector(std::vector<double>);
+	void setStateArray(const StateArray&);
+	void setStateArray(const StateArray&, const OutputArray&); // With the output vector saved for it (e.g. getOutputArray()), not computed
 
 	// Setters (output vector)
 	virtual void setOutputVector();
-	void setRopeLength(double);
-	void setRopeRateOfChange(double);
+	void setOutputArray(const OutputArray&); // Cached for the current state vector, without computing
+	void setRopeLength(double); // Overrides the cached value until the state vector changes
+	void setRopeRateOfChange(double); // Overrides the cached value until the state vector changes
+	void setRopeAngle(double); // Overrides the cached value until the state vector changes
+
+	// Calculate (output vector)
+	static void calculateOutputArray(const StateArray&, OutputArray&);
 
 	// Calculate (state derivative)
 	static std::vector<double> calculateDerivativeStateVector(std::vector<double>, std::vector<double>, std::vector<double>, std::vector<double>, bool);
+	static void calculateDerivativeStateVector(const StateArray&, const ControlArray&, const OutputArray&, const DynamicSystemParameters&, bool, StateArray&);
+	static void calculateDerivativeStateVectorFused(const StateArray&, const ControlArray&, const OutputArray&, const DynamicSystemParameters&, bool, StateArray&); // Single pass
+	template <bool WithCargo, typename State>
+	static void calculateDerivativeStateVectorSpecialized(const State&, const ControlArray&, const OutputArray&, const DynamicSystemParameters&, State&); // Dynamics type at compile time
+	static void calculateDerivativeStateVectorSlow(const StateArray&, const ControlArray&, const OutputArray&, const DynamicSystemParameters&, bool, StateArray&); // Thrust, drag drone, gravity
+	static void calculateDerivativeStateVectorFast(const StateArray&, const ControlArray&, const OutputArray&, const DynamicSystemParameters&, bool, StateArray&); // Velocities, rope, drag cargo
+	static double calculateRopeTimeStep(const DynamicSystemParameters&); // Time scale of the rope-cargo oscillation
+	static double calculateRopeSwitchingFunction(const StateArray&, const DynamicSystemParameters&); // > 0 --> taut rope
+
+	// Calculate (jacobian of state derivative)
+	static void calculateJacobian(const StateArray&, const ControlArray&, const DynamicSystemParameters&, bool, StateJacobianArray&, ControlJacobianArray&);
 
 private:
 	// Attributes (dynamics type)
-	bool m_dynamicsType;
+	bool m_dynamicsType = false;
 
-	// Attributes (output vector)
-	std::vector<double> m_outputVector = { 0, 0 };
+	// Attributes (parameters)
+	DynamicSystemParameters m_parameters;
 
-	// Calculate (output vector)
-	std::vector<double> calculateOutputVector();
+	// Attributes (output vector); cache of y1 - y3, valid for the state revisions it was computed at
+	OutputArray m_outputVector{};
+	std::size_t m_outputDroneStateRevision = SIZE_MAX;
+	std::size_t m_outputCargoStateRevision = SIZE_MAX;
+
+	// Helper functions for setStateArray()
+	void setStateArrayWithoutOutput(const StateArray&);
+
+	// Calculate (output vector); only the non-const paths write the cache
+	bool isOutputVectorCurrent() const;
+	OutputArray calculateCurrentOutputArray() const;
+	void updateOutputVector();
 
 	// Helper functions for calculateDerivativeStateVector()
 	static double calculateThrustComponent(bool, double, double);
 	static double calculateDragComponent(bool, double, double, double);
 	static double calculateRopeForceComponent(double, double, double, double, double, double, double);
 		static double calculateRopeForce(double, double, double, double, double); // Overall rope force
+
+	// Helper functions for calculateJacobian()
+	static void calculateDragJacobian(double, double, double, double&, double&, double&);
 };
 
 
+// Calculate (state derivative)
+/**
+ * Computes the derivative of the state vector in a single pass (see calculateDerivativeStateVectorFused()), with the
+ * dynamics type fixed at compile time. Without cargo only the drone states (x1 - x5) are read and written, such that a
+ * state vector of five elements suffices; the rope and cargo part is not compiled.
+ *
+ * @param	stateVector : the current state vector of the system (x1 - x5 without cargo, x1 - x9 with cargo)
+ * @param	controlVector : the current control vector
+ * @param	outputVector : the current output vector of the system (not used without cargo)
+ * @param	parameters : parameter block of the system (see DynamicSystemParameters)
+ * @param	dynamicsStateVector : array the derivative of the state vector is written to
+ */
+template <bool WithCargo, typename State>
+void DroneRopeCargoDynamics::calculateDerivativeStateVectorSpecialized(const State& stateVector, const ControlArray& controlVector, const OutputArray& outputVector,
+																	   const DynamicSystemParameters& parameters, State& dynamicsStateVector)
+{
+	/* NOTATIONS AND PARAMETER LIST CONVENTION: see calculateDerivativeStateVector() */
+
+	/* ---------------------------------------------- SHARED QUANTITIES ---------------------------------------------- */
+
+	// Thrust (sine and cosine of drone angle)
+	const double sinTheta = std::sin(stateVector[2]);
+	const double cosTheta = std::cos(stateVector[2]);
+	const double thrustX = -controlVector[0] * sinTheta;
+	const double thrustY = controlVector[0] * cosTheta;
+
+	// Drag drone (velocity norm)
+	const double dragDrone = parameters.dragConstantDrone * std::sqrt(stateVector[3] * stateVector[3] + stateVector[4] * stateVector[4]);
+	const double dragDroneX = dragDrone * stateVector[3];
+	const double dragDroneY = dragDrone * stateVector[4];
+
+	// Mass drone
+	const double inverseMassDrone = parameters.inverseMassDrone;
+
+	/* ---------------------------------------------------- DRONE ---------------------------------------------------- */
+
+	dynamicsStateVector[0] = stateVector[3];	// x1*
+	dynamicsStateVector[1] = stateVector[4];	// x2*
+	dynamicsStateVector[2] = controlVector[1];	// x3*
+
+	if constexpr (!WithCargo) {
+		static_cast<void>(outputVector);
+		dynamicsStateVector[3] = inverseMassDrone * (thrustX - dragDroneX);							// x4*
+		dynamicsStateVector[4] = inverseMassDrone * (thrustY - dragDroneY) - parameters.gravitationalConstant;		// x5*
+	}
+	else {
+		// Rope force (computed once, see calculateRopeForceComponent())
+		double ropeForceX{}, ropeForceY{};
+
+		if (outputVector[0] != 0) {
+			const double ropeForce = calculateRopeForce(outputVector[0], outputVector[1], parameters.ropeLengthInitial, parameters.ropeDamping, parameters.ropeStiffness);
+			ropeForceX = ropeForce * ((stateVector[0] - stateVector[5]) / outputVector[0]);
+			ropeForceY = ropeForce * ((stateVector[1] - stateVector[6]) / outputVector[0]);
+		}
+
+		// Drag cargo (velocity norm)
+		const double dragCargo = parameters.dragConstantCargo * std::sqrt(stateVector[7] * stateVector[7] + stateVector[8] * stateVector[8]);
+
+		dynamicsStateVector[3] = inverseMassDrone * (thrustX - dragDroneX - ropeForceX);						// x4*
+		dynamicsStateVector[4] = inverseMassDrone * (thrustY - dragDroneY - ropeForceY) - parameters.gravitationalConstant;	// x5*
+
+		/* -------------------------------------------------- CARGO -------------------------------------------------- */
+
+		const double inverseMassCargo = parameters.inverseMassCargo;
+
+		dynamicsStateVector[5] = stateVector[7];															// x6*
+		dynamicsStateVector[6] = stateVector[8];															// x7*
+		dynamicsStateVector[7] = inverseMassCargo * (-(dragCargo * stateVector[7]) + ropeForceX);						// x8*
+		dynamicsStateVector[8] = inverseMassCargo * (-(dragCargo * stateVector[8]) + ropeForceY) - parameters.gravitationalConstant;	// x9*
+	}
+}
+
+
 // [END]: Prevent multiple inclusions of header
 # endif
\ No newline at end of file
@@ -30,29 +30,11 @@ public:
 
 
 	// Getters (output vector)
-	virtual std::vector<double> getOutputVector();
+	virtual std::vector<double> getOutputVector() const;
 
 	// Getters (output vector: extended)
-	std::vector<double> getExtensionOutputVector();
-	double getRopeAngle() const { return m_extensionOutputVector[0]; }
-
-
-	// Setters (output vector)
-	virtual void setOutputVector();
-
-	// Setters (output vector: extended)
-	void setExtensionOutputVector();
-	void setRopeAngle(double);
-
-private:
-	// Attributes (output vector: extended)
-	std::vector<double> m_extensionOutputVector = {0};
-
-	// Calculate (output vector: extended)
-	std::vector<double> calculateExtensionOutputVector();
-
-	// Calculate (rope)
-	double calculateRopeAngle();
+	std::vector<double> getExtensionOutputVector() const;
+	double getRopeAngle() const { return getOutputArray()[2]; }
 };
 
 
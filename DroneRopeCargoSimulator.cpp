@@ -11,6 +11,7 @@
 // Libraries
 #include "DroneRopeCargoSimulator.h"
 #include <algorithm>
+#include <cmath>
 
 
 // Setters (implementation)
@@ -21,6 +22,22 @@
  *
  */
 void DroneRopeCargoSimulator::setImplementation(bool dynamicsType, bool integrationType) {
+	// Set implementation (false --> Euler, true --> RK4)
+	setImplementation(dynamicsType, integrationType ? IntegrationType::RungeKuttaFour : IntegrationType::Euler);
+}
+
+/**
+ * Sets the implementation of the simulator, being able to choose from 
+ * (i) Cargo;					(1) Euler-integration
+ * (ii) Drone-rope-cargo		(2) RK4-integration
+ *								(3) RK4-integration, output vector per stage
+ *								(4) Implicit RK-integration (stiff ropes)
+ *								(5) Multi-rate integration (rope-cargo substepped)
+ *								(6) Adams-Bashforth-Moulton integration
+ *								(7) Heun/RK3/RK4 (3/8-rule)/SSPRK3-integration (Butcher tableau)
+ *
+ */
+void DroneRopeCargoSimulator::setImplementation(bool dynamicsType, IntegrationType integrationType) {
 	// Set dynamics type
 	setDynamicsType(dynamicsType);
 
@@ -30,56 +47,417 @@ void DroneRopeCargoSimulator::setImplementation(bool dynamicsType, bool integrat
 	// Choose suitable time step based on chosen combination
 	double h{}; // Time-step
 
-	if ((dynamicsType == false)) {									 // Drone - Euler / RK4
+	if ((dynamicsType == false)) {																		// Drone - all integration types
 		h = 0.01;	 // h = 0.01 s
 	}
-	else if ((dynamicsType == true) && (integrationType == false)) { // Drone with cargo - Euler
-		h = 0.0005;  // h = 0.0005 s
+	else if ((dynamicsType == true) && visitExplicitRungeKuttaIntegrator(integrationType, [&h](auto integrator) { h = decltype(integrator)::timeStepWithCargo; })) {	// Drone with cargo - Euler/RK4/Heun/RK3/SSPRK3
+		// h = 0.0005 s (Euler), 0.005 s (Heun), 0.01 s (RK3/RK4); see ExplicitRungeKuttaIntegrator
 	}
-	else if ((dynamicsType == true) && (integrationType == true)) {  // Drone with cargo - RK4
+	else if ((dynamicsType == true) && (integrationType == IntegrationType::ImplicitRungeKutta)) {			// Drone with cargo - Implicit RK
 		h = 0.01;	 // h = 0.01 s
 	}
+	else if ((dynamicsType == true) && (integrationType == IntegrationType::MultiRate)) {					// Drone with cargo - Multi-rate
+		h = 0.01;	 // h = 0.01 s (drone); rope-cargo substeps follow from setSubsteps() or the rope time scale
+	}
+	else if ((dynamicsType == true) && (integrationType == IntegrationType::AdamsBashforthMoulton)) {		// Drone with cargo - Adams-Bashforth-Moulton
+		h = 0.005;	 // h = 0.005 s (smaller stability region than RK4)
+	}
 
 	// Set time step
 	setTimeStep(h);
+
+	// Set fast time step (multi-rate integration)
+	updateFastTimeStep();
+}
+
+
+// Setters (parameters)
+/**
+ * Sets the parameters of the drone (see DroneRopeCargoDynamics::setConstantDroneParameters()), and updates the fast
+ * time step of multi-rate integration
+ *
+ * @param	massDrone : mass of the drone [kg]
+ * @param	dragConstantDrone : drag constant of the drone [N s^2 / m^2]
+ */
+void DroneRopeCargoSimulator::setConstantDroneParameters(double massDrone, double dragConstantDrone) {
+	DroneRopeCargoDynamicsExtended::setConstantDroneParameters(massDrone, dragConstantDrone);
+	updateFastTimeStep();
+}
+
+/**
+ * Sets the parameters of the rope (see DroneRopeCargoDynamics::setConstantRopeParameters()), and updates the fast
+ * time step of multi-rate integration
+ *
+ * @param	ropeLengthInitial : initial (unstretched) length of the rope [m]
+ * @param	ropeStiffness : stiffness of the rope [N / m]
+ * @param	ropeDamping : damping of the rope [N s / m]
+ */
+void DroneRopeCargoSimulator::setConstantRopeParameters(double ropeLengthInitial, double ropeStiffness, double ropeDamping) {
+	DroneRopeCargoDynamicsExtended::setConstantRopeParameters(ropeLengthInitial, ropeStiffness, ropeDamping);
+	updateFastTimeStep();
+}
+
+/**
+ * Sets the parameters of the cargo (see DroneRopeCargoDynamics::setConstantCargoParameters()), and updates the fast
+ * time step of multi-rate integration
+ *
+ * @param	massCargo : mass of the cargo [kg]
+ * @param	dragConstantCargo : drag constant of the cargo [N s^2 / m^2]
+ */
+void DroneRopeCargoSimulator::setConstantCargoParameters(double massCargo, double dragConstantCargo) {
+	DroneRopeCargoDynamicsExtended::setConstantCargoParameters(massCargo, dragConstantCargo);
+	updateFastTimeStep();
+}
+
+/**
+ * Sets all parameters at once (see DroneRopeCargoDynamics::setParameters()), and updates the fast time step of
+ * multi-rate integration
+ *
+ * @param	parameters : the parameter block
+ */
+void DroneRopeCargoSimulator::setParameters(const DynamicSystemParameters& parameters) {
+	DroneRopeCargoDynamicsExtended::setParameters(parameters);
+	updateFastTimeStep();
+}
+
+
+// Helper functions for setImplementation() and the parameter setters
+/**
+ * Sets the fast time step of multi-rate integration to the time scale of the rope-cargo oscillation (see
+ * calculateRopeTimeStep()); zero without cargo (one substep). It only depends on the parameters and the dynamics type,
+ * such that it is not recomputed per step; a fast time step set afterwards (setFastTimeStep()) is kept.
+ */
+void DroneRopeCargoSimulator::updateFastTimeStep() {
+	setFastTimeStep(getDynamicsType() ? calculateRopeTimeStep(getParameters()) : 0);
+}
+
+
+// Getters (state vector: inside the last step)
+/**
+ * Retrieves the state vector at a time inside the last step (simulationStep() or simulateInterval()), without evaluating
+ * the derivative. The dense output of the integrator is used where it is available: Hermite interpolation for Euler, (Butcher-tableau) RK
+ * and Adams-Bashforth-Moulton, the continuous extension for Dormand-Prince (last internal step of the interval). Other
+ * integration types, and the part of a step before a rope event (see setEventDetection()), are interpolated linearly.
+ *
+ * @param	time : the simulation time [s]; clipped to the last step
+ * @return	A (StateArray) representing the state vector of drone (+ cargo) at the given time
+ */
+StateArray DroneRopeCargoSimulator::getInterpolatedStateArray(double time) const {
+	// Initialize variables
+	StateArray stateVector{};
+
+	// Outside of (or at the bounds of) the last step
+	if (time >= m_simulationTime) {
+		return getStateArray();
+	}
+	if (time <= m_stepStartTime) {
+		return m_stepStartStateVector;
+	}
+
+	// Dense output
+	if (m_denseOutput && time >= m_denseStartTime) {
+		calculateDenseOutput((time - m_denseStartTime) / getDenseTimeStep(), stateVector);
+		return stateVector;
+	}
+
+	// Linear, from the start of the step to the start of the dense output (or the end of the step)
+	StateArray endStateVector = getStateArray();
+	double endTime = m_simulationTime;
+	if (m_denseOutput) {
+		calculateDenseOutput(0.0, endStateVector);
+		endTime = m_denseStartTime;
+	}
+
+	const double timeFraction = (time - m_stepStartTime) / (endTime - m_stepStartTime);
+	for (std::size_t i = 0; i < stateVector.size(); i++) {
+		stateVector[i] = m_stepStartStateVector[i] + timeFraction * (endStateVector[i] - m_stepStartStateVector[i]);
+	}
+
+	return stateVector;
+}
+
+/**
+ * Retrieves the state vector at a time inside the last step, see getInterpolatedStateArray()
+ *
+ * @param	time : the simulation time [s]; clipped to the last step
+ * @return	A (std::vector<double>) representing the state vector of drone (+ cargo) at the given time
+ */
+std::vector<double> DroneRopeCargoSimulator::getInterpolatedStateVector(double time) const {
+	// Interpolate
+	const StateArray stateVector = getInterpolatedStateArray(time);
+
+	// Return vector
+	return std::vector<double>(stateVector.begin(), stateVector.end());
+}
+
+
+// Setters (simulation time)
+/**
+ *	Sets the simulation time, which is advanced by every simulation step; the last step is forgotten
+ *
+ *	@param	simulationTime : the simulation time [s]
+ */
+void DroneRopeCargoSimulator::setSimulationTime(double simulationTime) {
+	m_simulationTime = simulationTime;
+	m_stepStartTime = simulationTime;
+	m_denseOutput = false;
+}
+
+
+// Setters (events)
+/**
+ *	Clears the rope events located so far
+ */
+void DroneRopeCargoSimulator::clearRopeEvents() {
+	m_ropeEvents.clear();
+	m_numberOfRopeEvents = 0;
+}
+
+
+// Getters (snapshot)
+/**
+ * Saves everything the next steps of the simulator depend on to a snapshot: implementation, parameters, state,
+ * control and (cached) output vector, simulation time, the last step (for getInterpolatedStateArray()), the history
+ * of Adams-Bashforth-Moulton and the settings of the integrators. The snapshot is a fixed-size block of memory, such
+ * that saving it does not allocate. The rope events are not copied, only their number (see restore()).
+ *
+ * @param	snapshot : storage the snapshot is written to
+ */
+void DroneRopeCargoSimulator::snapshot(SimulatorSnapshot& snapshot) const {
+	// Implementation and parameters
+	snapshot.dynamicsType = getDynamicsType();
+	snapshot.integrationType = getIntegrationType();
+	snapshot.timeStep = getTimeStep();
+	snapshot.parameters = getParameters();
+
+	// State, control and output vector
+	snapshot.stateVector = getStateArray();
+	snapshot.controlVector = { getTauDrone(), getOmegaDrone() };
+	snapshot.outputVector = getOutputArray();
+
+	// Simulation time and last step
+	snapshot.simulationTime = m_simulationTime;
+	snapshot.stepStartTime = m_stepStartTime;
+	snapshot.stepStartStateVector = m_stepStartStateVector;
+	snapshot.denseStartTime = m_denseStartTime;
+	snapshot.denseOutput = m_denseOutput;
+	getDenseOutputHistory(snapshot.denseOutputHistory);
+
+	// Integrators
+	getHistory(snapshot.adamsBashforthMoultonHistory);
+	snapshot.restartTolerance = getRestartTolerance();
+	snapshot.absoluteTolerance = getAbsoluteTolerance();
+	snapshot.relativeTolerance = getRelativeTolerance();
+	snapshot.internalTimeStep = getInternalTimeStep();
+	snapshot.substeps = getSubsteps();
+	snapshot.fastTimeStep = getFastTimeStep();
+	snapshot.newtonTolerance = getNewtonTolerance();
+	snapshot.maximumNewtonIterations = getMaximumNewtonIterations();
+	snapshot.eventDetection = getEventDetection();
+	snapshot.eventTolerance = getEventTolerance();
+
+	// Events
+	snapshot.numberOfRopeEvents = m_numberOfRopeEvents;
+}
+
+/**
+ * Saves everything the next steps of the simulator depend on to a snapshot, see snapshot(SimulatorSnapshot&)
+ *
+ * @return	A (SimulatorSnapshot) of the simulator
+ */
+SimulatorSnapshot DroneRopeCargoSimulator::snapshot() const {
+	SimulatorSnapshot simulatorSnapshot;
+	snapshot(simulatorSnapshot);
+	return simulatorSnapshot;
+}
+
+
+// Setters (snapshot)
+/**
+ * Restores the simulator to a snapshot (see snapshot()), taken from this or another simulator; the steps taken
+ * afterwards equal those taken after the snapshot was saved, bit for bit. The fields are copied into the simulator as
+ * saved: the output vector and the fast time step are not recomputed, and the fixed-size histories of the integrators
+ * are plain copies, such that restoring does not allocate. The number of rope events is restored exactly; the rope
+ * events located after the snapshot are removed (events located before it are kept, as far as they were located in
+ * this simulator, see fork()).
+ *
+ * @param	snapshot : the snapshot to restore
+ */
+void DroneRopeCargoSimulator::restore(const SimulatorSnapshot& snapshot) {
+	// Implementation and parameters (the fast time step follows below, as saved)
+	setDynamicsType(snapshot.dynamicsType);
+	setIntegrationType(snapshot.integrationType);
+	setTimeStep(snapshot.timeStep);
+	DroneRopeCargoDynamicsExtended::setParameters(snapshot.parameters);
+
+	// State, control and output vector
+	setStateArray(snapshot.stateVector, snapshot.outputVector);
+	setTauDrone(snapshot.controlVector[0]);
+	setOmegaDrone(snapshot.controlVector[1]);
+
+	// Simulation time and last step
+	m_simulationTime = snapshot.simulationTime;
+	m_stepStartTime = snapshot.stepStartTime;
+	m_stepStartStateVector = snapshot.stepStartStateVector;
+	m_denseStartTime = snapshot.denseStartTime;
+	m_denseOutput = snapshot.denseOutput;
+	setDenseOutputHistory(snapshot.denseOutputHistory);
+
+	// Integrators
+	setHistory(snapshot.adamsBashforthMoultonHistory);
+	setRestartTolerance(snapshot.restartTolerance);
+	setTolerances(snapshot.absoluteTolerance, snapshot.relativeTolerance);
+	setInternalTimeStep(snapshot.internalTimeStep);
+	setSubsteps(snapshot.substeps);
+	setFastTimeStep(snapshot.fastTimeStep);
+	setNewtonTolerance(snapshot.newtonTolerance);
+	setMaximumNewtonIterations(snapshot.maximumNewtonIterations);
+	setEventDetection(snapshot.eventDetection);
+	setEventTolerance(snapshot.eventTolerance);
+
+	// Events
+	m_numberOfRopeEvents = snapshot.numberOfRopeEvents;
+	if (m_ropeEvents.size() > m_numberOfRopeEvents) {
+		m_ropeEvents.resize(m_numberOfRopeEvents);
+	}
 }
 
 // Other
 /**
  * After having specified a control vector for the drone, it computes the resulting dynamics and thus the next state,
  * saves this result to the object, and returns this "next" state vector.
+ * Thin wrapper around the fixed-size simulationStep()
  *
  * @return : A (std::vector<double>) representing the next state vector of drone (+ cargo)
  */
 std::vector<double> DroneRopeCargoSimulator::simulationStep(std::vector<double> droneControlVector) {
-	/* CONVENTION OF PARAMETER LIST
-		0 : gravitational constant
-		1 : mass drone
-		2 : drag constant drone
-		3 : rope initial length
-		4 : rope damping
-		5 : rope stiffness
-		6 : mass cargo 
-		7 : drag constant cargo
-	*/
+	// Initialize arrays
+	const ControlArray controlArray = { droneControlVector[0], droneControlVector[1] };
+	StateArray nextStateVector{};
 
+	// Step
+	simulationStep(controlArray, nextStateVector);
+
+	// Return next state vector
+	return std::vector<double>(nextStateVector.begin(), nextStateVector.end());
+}
+
+/**
+ * After having specified a control vector for the drone, it computes the resulting dynamics and thus the next state,
+ * saves this result to the object, and writes this "next" state vector to the given array.
+ * All data is kept in fixed-size arrays and the derivative is called without std::function, such that a step
+ * does not perform any heap allocations (apart from saving a located rope event).
+ *
+ * With event detection enabled (setEventDetection()) and cargo attached, the step is split at slack/taut transitions
+ * of the rope, where the rope force has a kink; the transitions are saved with their simulation time (getRopeEvents()).
+ *
+ * With implicit Runge-Kutta, a step whose Newton iterations did not converge is still taken; it is reported by the
+ * return value and counted (getNumberOfNewtonFailures()), e.g. to retry with a smaller time step or more iterations.
+ *
+ * @param	droneControlVector : the control vector to apply during this step
+ * @param	nextStateVector : array the "next" state vector of drone (+ cargo) is written to
+ * @return	A type (bool) which is false if the Newton iterations of the step (implicit Runge-Kutta) did not converge
+ */
+bool DroneRopeCargoSimulator::simulationStep(const ControlArray& droneControlVector, StateArray& nextStateVector) {
 	// Initialize variables
-	std::vector<double> nextStateVector{};
-	const std::vector<double> parameterList = {getGravitationalConstant("Earth"), getMassDrone(), getDragConstantCargo(), getRopeLengthInitial(), getRopeDamping(), getRopeStiffness(), getMassCargo(), getDragConstantCargo()};
-	
-	// Save the to-be-used derivative function as a parameter
-	static std::function<std::vector<double>(std::vector<double>, std::vector<double>, std::vector<double>, std::vector<double>, bool)> derivativeFunction = calculateDerivativeStateVector;
+	const DynamicSystemParameters& parameterList = getParameters(); // Built when the parameters are set
+
+	// Save the to-be-used derivative function (resolved at compile time, no std::function)
+	auto derivativeFunction = [](const StateArray& stateVector, const ControlArray& controlVector, const OutputArray& outputVector,
+								 const DynamicSystemParameters& parameters, bool dynamicsType, StateArray& dynamicsStateVector) {
+		calculateDerivativeStateVectorFused(stateVector, controlVector, outputVector, parameters, dynamicsType, dynamicsStateVector);
+	};
+
+	// Save the to-be-used output function (used by integration types that evaluate away from the current state)
+	auto outputFunction = [](const StateArray& stateVector) {
+		OutputArray outputVector{};
+		calculateOutputArray(stateVector, outputVector);
+		return outputVector;
+	};
+
+	// Save the to-be-used Jacobian function (closed form, used by implicit integration types)
+	auto jacobianFunction = [&droneControlVector, &parameterList, dynamicsType = getDynamicsType()](const StateArray& stateVector, const StateArray&, StateJacobianArray& stateJacobian) {
+		ControlJacobianArray controlJacobian{};
+		calculateJacobian(stateVector, droneControlVector, parameterList, dynamicsType, stateJacobian, controlJacobian);
+	};
+
+	// Save the to-be-used slow/fast parts of the derivative function (used by multi-rate integration)
+	auto slowFunction = [](const StateArray& stateVector, const ControlArray& controlVector, const OutputArray& outputVector,
+						   const DynamicSystemParameters& parameters, bool dynamicsType, StateArray& dynamicsStateVector) {
+		calculateDerivativeStateVectorSlow(stateVector, controlVector, outputVector, parameters, dynamicsType, dynamicsStateVector);
+	};
+	auto fastFunction = [](const StateArray& stateVector, const ControlArray& controlVector, const OutputArray& outputVector,
+						   const DynamicSystemParameters& parameters, bool dynamicsType, StateArray& dynamicsStateVector) {
+		calculateDerivativeStateVectorFast(stateVector, controlVector, outputVector, parameters, dynamicsType, dynamicsStateVector);
+	};
+
+	// Save the to-be-used step function (over getTimeStep(); the saved output vector belongs to the current state only)
+	const StateArray stateVector = getStateArray();
+	auto stepFunction = [&](const StateArray& stepStateVector, StateArray& stepNextStateVector) {
+		if (getIntegrationType() == IntegrationType::MultiRate) { // Drone forces once per step, rope-cargo substepped
+			MultiRateNumericalIntegration::calculateStep(slowFunction, fastFunction, outputFunction, stepStateVector, droneControlVector, parameterList, getDynamicsType(), stepNextStateVector);
+		}
+		else {
+			const OutputArray outputVector = (&stepStateVector == &stateVector) ? getOutputArray() : outputFunction(stepStateVector);
+			calculateNextState(derivativeFunction, outputFunction, jacobianFunction, stepStateVector, droneControlVector, outputVector, parameterList, getDynamicsType(), stepNextStateVector);
+		}
+	};
+
+	// Save the to-be-used trial step function (partial steps that locate a rope event); the derivative history and the
+	// number of Newton failures are restored afterwards, such that the bisection does not count as restarts or failures
+	auto trialStepFunction = [&](const StateArray& stepStateVector, StateArray& stepNextStateVector) {
+		AdamsBashforthMoultonHistory history;
+		const bool multistep = (getIntegrationType() == IntegrationType::AdamsBashforthMoulton);
+		const int trialNumberOfNewtonFailures = getNumberOfNewtonFailures();
+		if (multistep) { getHistory(history); }
+
+		stepFunction(stepStateVector, stepNextStateVector);
+
+		if (multistep) { setHistory(history); }
+		setNumberOfNewtonFailures(trialNumberOfNewtonFailures);
+	};
+
+	// Save the to-be-used switching function (rope force before clipping, > 0 --> taut)
+	auto switchingFunction = [&parameterList](const StateArray& switchingStateVector) {
+		return calculateRopeSwitchingFunction(switchingStateVector, parameterList);
+	};
+
+	// Steps that did not converge before this step
+	const int numberOfNewtonFailures = getNumberOfNewtonFailures();
 
 	/* ------------------------------------------------- ALGORITHM ------------------------------------------------- */ 
 
 	// 1. Use user-specified inputs and save this [control vector] to object
-	setDroneControlVector(droneControlVector);
+	setTauDrone(droneControlVector[0]);
+	setOmegaDrone(droneControlVector[1]);
 
 	// 2. Compute resulting dynamics (derivative) in [state vector] due to [control vector]; integrate (derivative) and obtain "next"[state vector]
-	nextStateVector = calculateNextState(derivativeFunction, getStateVector(), getDroneControlVector(), getOutputVector(), parameterList, getDynamicsType());
+	double denseStartTime = 0; // Relative to the start of the step
+
+	if (getEventDetection() && getDynamicsType()) { // Split the step at slack/taut transitions of the rope
+		EventDetectionNumericalIntegration::calculateStep(stepFunction, trialStepFunction, switchingFunction, stateVector, nextStateVector);
+
+		for (std::size_t i = 0; i < getNumberOfStepEvents(); i++) {
+			m_ropeEvents.push_back({ m_simulationTime + getStepEvent(i).time, getStepEvent(i).rising });
+		}
+		m_numberOfRopeEvents += getNumberOfStepEvents();
+
+		// Dense output belongs to the remainder of the step after the last event
+		if (getNumberOfStepEvents() > 0) {
+			denseStartTime = getStepEvent(getNumberOfStepEvents() - 1).time;
+		}
+	}
+	else {
+		stepFunction(stateVector, nextStateVector);
+	}
 
-	// 3. Save computed "next" [state-vector] back to object
-	setStateVector(nextStateVector);
+	// 3. Save computed "next" [state-vector] back to object and advance simulation time
+	setStateArray(nextStateVector);
+	m_stepStartStateVector = stateVector;
+	m_stepStartTime = m_simulationTime;
+	m_denseOutput = hasStepDenseOutput() && (denseStartTime < getTimeStep());
+	m_denseStartTime = m_simulationTime + denseStartTime;
+	m_simulationTime += getTimeStep();
 
 	// 4. Compute resulting [output vector] and save to object
 	setOutputVector();
@@ -88,5 +466,424 @@ std::vector<double> DroneRopeCargoSimulator::simulationStep(std::vector<double>
 
 	/* ------------------------------------------------------------------------------------------------------------- */
 
-	return nextStateVector;
+	return getNumberOfNewtonFailures() == numberOfNewtonFailures;
+}
+
+/**
+ * Advances the simulation over a requested interval with the adaptive Dormand-Prince (RK45) integrator,
+ * holding the control vector constant. The internal step is chosen by the integrator based on the tolerances
+ * set with setTolerances(), instead of the fixed time step of simulationStep(). If the integrator aborts (error
+ * estimate not finite), the simulation time only advances over the integrated part of the interval.
+ *
+ * @param	droneControlVector : the control vector to apply during the interval
+ * @param	interval : the length of the interval to advance [s]; nothing is simulated unless positive
+ * @param	nextStateVector : array the state vector of drone (+ cargo) at the end of the interval is written to
+ * @return	A (IntegrationStatistics) containing the number of derivative evaluations, accepted/rejected steps and the integrated part
+ */
+IntegrationStatistics DroneRopeCargoSimulator::simulateInterval(const ControlArray& droneControlVector, double interval, StateArray& nextStateVector) {
+	// Initialize variables
+	IntegrationStatistics statistics{};
+	const DynamicSystemParameters& parameterList = getParameters(); // Built when the parameters are set
+
+	// Account for an interval that is not positive (or NaN): the simulation time would not advance (or move backwards)
+	if (!(interval > 0)) {
+		nextStateVector = getStateArray();
+		return statistics;
+	}
+
+	// Save the to-be-used derivative function
+	auto derivativeFunction = [](const StateArray& stateVector, const ControlArray& controlVector, const OutputArray& outputVector,
+								 const DynamicSystemParameters& parameters, bool dynamicsType, StateArray& dynamicsStateVector) {
+		calculateDerivativeStateVectorFused(stateVector, controlVector, outputVector, parameters, dynamicsType, dynamicsStateVector);
+	};
+
+	// Save the to-be-used output function (the rope geometry changes within the interval)
+	auto outputFunction = [](const StateArray& stateVector) {
+		OutputArray outputVector{};
+		calculateOutputArray(stateVector, outputVector);
+		return outputVector;
+	};
+
+	/* ------------------------------------------------- ALGORITHM ------------------------------------------------- */
+
+	// 1. Use user-specified inputs and save this [control vector] to object
+	setTauDrone(droneControlVector[0]);
+	setOmegaDrone(droneControlVector[1]);
+
+	// 2. Integrate over the interval with adaptive internal steps
+	statistics = calculateInterval(derivativeFunction, outputFunction, getStateArray(), droneControlVector, parameterList, getDynamicsType(), interval, nextStateVector);
+
+	// 3. Save computed "next" [state-vector] back to object and advance simulation time
+	m_stepStartStateVector = getStateArray();
+	setStateArray(nextStateVector);
+	m_stepStartTime = m_simulationTime;
+	m_simulationTime += statistics.integratedInterval;
+
+	// Dense output belongs to the last internal step
+	m_denseOutput = (statistics.acceptedSteps > 0);
+	m_denseStartTime = m_simulationTime - getDenseTimeStep();
+
+	// 4. Compute resulting [output vector] and save to object
+	setOutputVector();
+
+	/* ------------------------------------------------------------------------------------------------------------- */
+
+	return statistics;
+}
+
+/**
+ * Advances the simulation over a duration with the control vector held constant, by repeated simulation steps of the
+ * fixed time step (see simulationStep()). The steps are taken internally, without allocating per step.
+ *
+ * @param	duration : the duration to simulate [s]; rounded to a whole number of time steps
+ * @param	droneControlVector : the control vector to apply during the duration
+ * @return	A (StateArray) representing the state vector of drone (+ cargo) at the end of the duration
+ */
+StateArray DroneRopeCargoSimulator::simulate(double duration, const ControlArray& droneControlVector) {
+	// Initialize variables
+	StateArray stateVector = getStateArray();
+	std::size_t stepIndex = 0;
+
+	// Step
+	simulateSteps(duration, droneControlVector, nullptr, stepIndex, stateVector);
+
+	return stateVector;
+}
+
+/**
+ * Advances the simulation over a duration with the control vector held constant (see simulate()), saving every
+ * [decimation]-th state vector to the trajectory buffer of the caller
+ *
+ * @param	duration : the duration to simulate [s]; rounded to a whole number of time steps
+ * @param	droneControlVector : the control vector to apply during the duration
+ * @param	trajectoryBuffer : storage the decimated trajectory is written to; its number of samples is set
+ * @return	A (StateArray) representing the state vector of drone (+ cargo) at the end of the duration
+ */
+StateArray DroneRopeCargoSimulator::simulate(double duration, const ControlArray& droneControlVector, TrajectoryBuffer& trajectoryBuffer) {
+	// Initialize variables
+	StateArray stateVector = getStateArray();
+	std::size_t stepIndex = 0;
+	trajectoryBuffer.numberOfSamples = 0;
+
+	// Step
+	simulateSteps(duration, droneControlVector, &trajectoryBuffer, stepIndex, stateVector);
+
+	return stateVector;
+}
+
+/**
+ * Advances the simulation over a control schedule: the control vector of every entry is held for its duration
+ * (see simulate())
+ *
+ * @param	controlSchedule : the entries of the schedule, in order
+ * @return	A (StateArray) representing the state vector of drone (+ cargo) at the end of the schedule
+ */
+StateArray DroneRopeCargoSimulator::simulate(const std::vector<ControlScheduleEntry>& controlSchedule) {
+	// Initialize variables
+	StateArray stateVector = getStateArray();
+	std::size_t stepIndex = 0;
+
+	// Step through the schedule
+	for (const ControlScheduleEntry& entry : controlSchedule) {
+		simulateSteps(entry.duration, entry.controlVector, nullptr, stepIndex, stateVector);
+	}
+
+	return stateVector;
+}
+
+/**
+ * Advances the simulation over a control schedule (see simulate()), saving every [decimation]-th state vector to the
+ * trajectory buffer of the caller; the decimation counts the steps of the whole schedule
+ *
+ * @param	controlSchedule : the entries of the schedule, in order
+ * @param	trajectoryBuffer : storage the decimated trajectory is written to; its number of samples is set
+ * @return	A (StateArray) representing the state vector of drone (+ cargo) at the end of the schedule
+ */
+StateArray DroneRopeCargoSimulator::simulate(const std::vector<ControlScheduleEntry>& controlSchedule, TrajectoryBuffer& trajectoryBuffer) {
+	// Initialize variables
+	StateArray stateVector = getStateArray();
+	std::size_t stepIndex = 0;
+	trajectoryBuffer.numberOfSamples = 0;
+
+	// Step through the schedule
+	for (const ControlScheduleEntry& entry : controlSchedule) {
+		simulateSteps(entry.duration, entry.controlVector, &trajectoryBuffer, stepIndex, stateVector);
+	}
+
+	return stateVector;
+}
+
+/**
+ * Sets another simulator to continue from this one (e.g. to branch off a what-if run), by copying the fields of a
+ * snapshot (see snapshot() and restore()) straight from this simulator into the branch, instead of copying the whole
+ * object or going through a snapshot. The rope events located so far are copied as well. The simulators are
+ * independent afterwards.
+ *
+ * @param	branch : the simulator that continues from this one
+ */
+void DroneRopeCargoSimulator::fork(DroneRopeCargoSimulator& branch) const {
+	// Same simulator
+	if (&branch == this) {
+		return;
+	}
+
+	// Implementation and parameters
+	branch.setDynamicsType(getDynamicsType());
+	branch.setIntegrationType(getIntegrationType());
+	branch.setTimeStep(getTimeStep());
+	branch.DroneRopeCargoDynamicsExtended::setParameters(getParameters());
+
+	// State, control and output vector
+	branch.setStateArray(getStateArray(), getOutputArray());
+	branch.setTauDrone(getTauDrone());
+	branch.setOmegaDrone(getOmegaDrone());
+
+	// Simulation time and last step
+	branch.m_simulationTime = m_simulationTime;
+	branch.m_stepStartTime = m_stepStartTime;
+	branch.m_stepStartStateVector = m_stepStartStateVector;
+	branch.m_denseStartTime = m_denseStartTime;
+	branch.m_denseOutput = m_denseOutput;
+	branch.setDenseOutputHistory(getDenseOutputHistory());
+
+	// Integrators
+	branch.setHistory(getHistory());
+	branch.setRestartTolerance(getRestartTolerance());
+	branch.setTolerances(getAbsoluteTolerance(), getRelativeTolerance());
+	branch.setInternalTimeStep(getInternalTimeStep());
+	branch.setSubsteps(getSubsteps());
+	branch.setFastTimeStep(getFastTimeStep());
+	branch.setNewtonTolerance(getNewtonTolerance());
+	branch.setMaximumNewtonIterations(getMaximumNewtonIterations());
+	branch.setEventDetection(getEventDetection());
+	branch.setEventTolerance(getEventTolerance());
+
+	// Events
+	branch.m_ropeEvents.assign(m_ropeEvents.begin(), m_ropeEvents.end());
+	branch.m_numberOfRopeEvents = m_numberOfRopeEvents;
+}
+
+
+// Other (checkpoint)
+/**
+ * Writes a snapshot to a binary stream, for checkpointing long runs. The stream holds a header (identifier, version,
+ * size) followed by every field of the snapshot, field by field: floating-point numbers as 8-byte doubles, all other
+ * fields as 8-byte integers, in the byte order of the machine (see readSnapshot()).
+ *
+ * @param	stream : the stream to write to (opened in binary mode)
+ * @param	snapshot : the snapshot to write
+ */
+void DroneRopeCargoSimulator::writeSnapshot(std::ostream& stream, const SimulatorSnapshot& snapshot) {
+	// Count fields
+	std::uint64_t numberOfFields = 0;
+	forEachSnapshotField(snapshot, [&numberOfFields](const auto&) { numberOfFields++; });
+
+	// Header
+	const std::uint32_t identifier = snapshotIdentifier;
+	const std::uint32_t version = snapshotVersion;
+	const std::uint64_t size = 8 * numberOfFields;
+	stream.write(reinterpret_cast<const char*>(&identifier), sizeof(identifier));
+	stream.write(reinterpret_cast<const char*>(&version), sizeof(version));
+	stream.write(reinterpret_cast<const char*>(&size), sizeof(size));
+
+	// Fields
+	forEachSnapshotField(snapshot, [&stream](const auto& field) {
+		using Field = std::decay_t<decltype(field)>;
+		if constexpr (std::is_floating_point<Field>::value) {
+			const double value = field;
+			stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+		}
+		else {
+			const std::int64_t value = static_cast<std::int64_t>(field);
+			stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+		}
+	});
+}
+
+/**
+ * Reads a snapshot written with writeSnapshot() from a binary stream. The snapshot is only changed if the stream
+ * holds a complete snapshot of the same version (and byte order) whose sizes, ring positions and integration type
+ * are within range (see isSnapshotValid()).
+ *
+ * @param	stream : the stream to read from (opened in binary mode)
+ * @param	snapshot : storage the snapshot is written to
+ * @return	A type (bool) which is true if a snapshot was read
+ */
+bool DroneRopeCargoSimulator::readSnapshot(std::istream& stream, SimulatorSnapshot& snapshot) {
+	// Count fields
+	SimulatorSnapshot readSimulatorSnapshot;
+	std::uint64_t numberOfFields = 0;
+	forEachSnapshotField(readSimulatorSnapshot, [&numberOfFields](const auto&) { numberOfFields++; });
+
+	// Header
+	std::uint32_t identifier = 0, version = 0;
+	std::uint64_t size = 0;
+	stream.read(reinterpret_cast<char*>(&identifier), sizeof(identifier));
+	stream.read(reinterpret_cast<char*>(&version), sizeof(version));
+	stream.read(reinterpret_cast<char*>(&size), sizeof(size));
+	if (!stream || (identifier != snapshotIdentifier) || (version != snapshotVersion) || (size != 8 * numberOfFields)) {
+		return false;
+	}
+
+	// Fields
+	forEachSnapshotField(readSimulatorSnapshot, [&stream](auto& field) {
+		using Field = std::decay_t<decltype(field)>;
+		if constexpr (std::is_floating_point<Field>::value) {
+			double value = 0;
+			stream.read(reinterpret_cast<char*>(&value), sizeof(value));
+			field = value;
+		}
+		else {
+			std::int64_t value = 0;
+			stream.read(reinterpret_cast<char*>(&value), sizeof(value));
+			field = static_cast<Field>(value);
+		}
+	});
+	if (!stream || !isSnapshotValid(readSimulatorSnapshot)) {
+		return false;
+	}
+
+	snapshot = readSimulatorSnapshot;
+	return true;
+}
+
+
+// Helper functions for simulationStep()
+/**
+ * Checks whether the chosen integration type saves dense output of its steps
+ *
+ * @return	A type (bool) which is true for Euler, RK4, Adams-Bashforth-Moulton and the Butcher-tableau methods
+ */
+bool DroneRopeCargoSimulator::hasStepDenseOutput() const {
+	return (getIntegrationType() == IntegrationType::AdamsBashforthMoulton) || visitExplicitRungeKuttaIntegrator(getIntegrationType(), [](auto) {});
+}
+
+
+// Helper functions for simulate()
+/**
+ * Takes the simulation steps covering a duration with a constant control vector
+ *
+ * @param	duration : the duration to simulate [s]; rounded to a whole number of time steps; no steps unless positive
+ * @param	droneControlVector : the control vector to apply
+ * @param	trajectoryBuffer : storage for the decimated trajectory (nullptr --> none)
+ * @param	stepIndex : number of steps taken so far by the calling simulate(); advanced
+ * @param	stateVector : array the state vector after the last step is written to
+ */
+void DroneRopeCargoSimulator::simulateSteps(double duration, const ControlArray& droneControlVector, TrajectoryBuffer* trajectoryBuffer, std::size_t& stepIndex, StateArray& stateVector) {
+	// Account for a duration or time step that is not positive (or NaN): std::lround() of the ratio is undefined or negative
+	if (!(duration > 0) || !(getTimeStep() > 0)) {
+		return;
+	}
+
+	// Number of steps
+	const long numberOfSteps = std::lround(duration / getTimeStep());
+
+	for (long step = 0; step < numberOfSteps; step++) {
+		// Step
+		simulationStep(droneControlVector, stateVector);
+		stepIndex++;
+
+		// Save sample
+		if (trajectoryBuffer != nullptr && (stepIndex % std::max<std::size_t>(trajectoryBuffer->decimation, 1) == 0)
+			&& trajectoryBuffer->numberOfSamples < trajectoryBuffer->capacity) {
+			trajectoryBuffer->samples[trajectoryBuffer->numberOfSamples++] = { m_simulationTime, stateVector };
+		}
+	}
+}
+
+
+// Helper functions for writeSnapshot() and readSnapshot()
+/**
+ * Calls a function on every field of a snapshot, in the order of the binary format (see writeSnapshot()); arrays
+ * element by element, the dense output and derivative history in full (also the unused part)
+ *
+ * @param	snapshot : the snapshot (const for writing)
+ * @param	function : called with a reference to every field
+ */
+template <typename Snapshot, typename Function>
+void DroneRopeCargoSimulator::forEachSnapshotField(Snapshot& snapshot, Function&& function) {
+	// Implementation and parameters
+	function(snapshot.dynamicsType);
+	function(snapshot.integrationType);
+	function(snapshot.timeStep);
+	function(snapshot.parameters.gravitationalConstant);
+	function(snapshot.parameters.massDrone);
+	function(snapshot.parameters.dragConstantDrone);
+	function(snapshot.parameters.ropeLengthInitial);
+	function(snapshot.parameters.ropeDamping);
+	function(snapshot.parameters.ropeStiffness);
+	function(snapshot.parameters.massCargo);
+	function(snapshot.parameters.dragConstantCargo);
+	function(snapshot.parameters.inverseMassDrone);
+	function(snapshot.parameters.inverseMassCargo);
+
+	// State, control and output vector
+	for (auto& element : snapshot.stateVector) { function(element); }
+	for (auto& element : snapshot.controlVector) { function(element); }
+	for (auto& element : snapshot.outputVector) { function(element); }
+
+	// Simulation time and last step
+	function(snapshot.simulationTime);
+	function(snapshot.stepStartTime);
+	for (auto& element : snapshot.stepStartStateVector) { function(element); }
+	function(snapshot.denseStartTime);
+	function(snapshot.denseOutput);
+	for (auto& element : snapshot.denseOutputHistory.coefficients) { function(element); }
+	function(snapshot.denseOutputHistory.stateSize);
+	function(snapshot.denseOutputHistory.timeStep);
+
+	// Integrators
+	for (auto& element : snapshot.adamsBashforthMoultonHistory.derivativeHistory) { function(element); }
+	for (auto& element : snapshot.adamsBashforthMoultonHistory.lastStateVector) { function(element); }
+	for (auto& element : snapshot.adamsBashforthMoultonHistory.lastControlVector) { function(element); }
+	function(snapshot.adamsBashforthMoultonHistory.stateSize);
+	function(snapshot.adamsBashforthMoultonHistory.controlSize);
+	function(snapshot.adamsBashforthMoultonHistory.historyLength);
+	function(snapshot.adamsBashforthMoultonHistory.historyIndex);
+	function(snapshot.adamsBashforthMoultonHistory.lastDerivativeValid);
+	function(snapshot.adamsBashforthMoultonHistory.lastDynamicsType);
+	function(snapshot.adamsBashforthMoultonHistory.lastTimeStep);
+	function(snapshot.adamsBashforthMoultonHistory.numberOfRestarts);
+	function(snapshot.restartTolerance);
+	function(snapshot.absoluteTolerance);
+	function(snapshot.relativeTolerance);
+	function(snapshot.internalTimeStep);
+	function(snapshot.substeps);
+	function(snapshot.fastTimeStep);
+	function(snapshot.newtonTolerance);
+	function(snapshot.maximumNewtonIterations);
+	function(snapshot.eventDetection);
+	function(snapshot.eventTolerance);
+
+	// Events
+	function(snapshot.numberOfRopeEvents);
+}
+
+/**
+ * Checks the fields of a read snapshot that index fixed-size storage or select code: the sizes of the dense output
+ * and derivative history (empty, or those of the state and control array), the length and position of the ring of
+ * derivatives, and the integration type
+ *
+ * @param	snapshot : the snapshot to check
+ * @return	A type (bool) which is true if the snapshot can be restored
+ */
+bool DroneRopeCargoSimulator::isSnapshotValid(const SimulatorSnapshot& snapshot) {
+	// Sizes
+	const std::size_t stateSize = std::tuple_size<StateArray>::value;
+	const std::size_t controlSize = std::tuple_size<ControlArray>::value;
+	const AdamsBashforthMoultonHistory& history = snapshot.adamsBashforthMoultonHistory;
+	if (((snapshot.denseOutputHistory.stateSize != 0) && (snapshot.denseOutputHistory.stateSize != stateSize))
+		|| ((history.stateSize != 0) && (history.stateSize != stateSize)) || ((history.controlSize != 0) && (history.controlSize != controlSize))) {
+		return false;
+	}
+
+	// Ring of derivatives
+	if ((history.historyLength < 0) || (history.historyLength > 4) || (history.historyIndex < 0) || (history.historyIndex > 3)) {
+		return false;
+	}
+
+	// Integration type
+	const IntegrationType integrationType = snapshot.integrationType;
+	return (integrationType == IntegrationType::ImplicitRungeKutta) || (integrationType == IntegrationType::MultiRate)
+		   || (integrationType == IntegrationType::AdamsBashforthMoulton) || visitExplicitRungeKuttaIntegrator(integrationType, [](auto) {});
 }
\ No newline at end of file
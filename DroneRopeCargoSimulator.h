@@ -16,6 +16,79 @@
 // Libraries
 #include "DroneRopeCargoDynamicsExtended.h"
 #include "NumericalIntegrationMethods.h"
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <type_traits>
+#include <vector>
+
+// Slack/taut transition of the rope
+struct RopeEvent {
+	double time = 0;	// Simulation time of the transition [s]
+	bool taut = false;	// true --> slack to taut, false --> taut to slack
+};
+
+// Segment of a control schedule: the control vector is held for the duration
+struct ControlScheduleEntry {
+	double duration = 0;				// [s]; rounded to a whole number of time steps
+	ControlArray controlVector{};
+};
+
+// Sample of a simulated trajectory
+struct TrajectorySample {
+	double time = 0;					// Simulation time [s]
+	StateArray stateVector{};
+};
+
+// Caller-provided storage for a decimated trajectory (see simulate())
+struct TrajectoryBuffer {
+	TrajectorySample* samples = nullptr;	// Storage of the caller (not owned)
+	std::size_t capacity = 0;				// Number of samples the storage holds; further samples are dropped
+	std::size_t decimation = 1;				// A sample is saved every [decimation] steps
+	std::size_t numberOfSamples = 0;		// Number of samples saved by the last simulate()
+};
+
+// Snapshot of a simulator: everything its next steps depend on, in fixed-size storage (see snapshot() and restore())
+struct SimulatorSnapshot {
+	// Implementation
+	bool dynamicsType = false;
+	IntegrationType integrationType = IntegrationType::Euler;
+	double timeStep = 0;
+
+	// Parameters
+	DynamicSystemParameters parameters;
+
+	// State, control and output vector
+	StateArray stateVector{};
+	ControlArray controlVector{};
+	OutputArray outputVector{};					// Cached output vector (keeps values overwritten with setRopeLength(), ...)
+
+	// Simulation time and last step
+	double simulationTime = 0;
+	double stepStartTime = 0;
+	StateArray stepStartStateVector{};
+	double denseStartTime = 0;
+	bool denseOutput = false;
+	DenseOutputHistory denseOutputHistory;
+
+	// Integrators (history and settings)
+	AdamsBashforthMoultonHistory adamsBashforthMoultonHistory;
+	double restartTolerance = 0;
+	double absoluteTolerance = 0;
+	double relativeTolerance = 0;
+	double internalTimeStep = 0;
+	int substeps = 0;
+	double fastTimeStep = 0;
+	double newtonTolerance = 0;
+	int maximumNewtonIterations = 0;
+	bool eventDetection = false;
+	double eventTolerance = 0;
+
+	// Events
+	std::size_t numberOfRopeEvents = 0;			// Rope events located up to the snapshot
+};
+static_assert(std::is_trivially_copyable<SimulatorSnapshot>::value, "SimulatorSnapshot is copied as a block of memory");
 
 // DroneDynamicsPlusIntegration-class
 class DroneRopeCargoSimulator : public DroneRopeCargoDynamicsExtended, public NumericalIntegrationMethods {
@@ -23,15 +96,91 @@ public:
 	// Constructor (default)
 	DroneRopeCargoSimulator() = default;
 	
+
+	// Getters (simulation time)
+	double getSimulationTime() const { return m_simulationTime; }
+	double getStepStartTime() const { return m_stepStartTime; } // Start of the last step
+
+	// Getters (state vector: inside the last step)
+	StateArray getInterpolatedStateArray(double) const;
+	std::vector<double> getInterpolatedStateVector(double) const;
+
+	// Getters (events)
+	const std::vector<RopeEvent>& getRopeEvents() const { return m_ropeEvents; } // Located in this simulator (see restore())
+	std::size_t getNumberOfRopeEvents() const { return m_numberOfRopeEvents; } // Up to the current time, also those before a restored snapshot
+
+	// Getters (snapshot)
+	void snapshot(SimulatorSnapshot&) const;
+	SimulatorSnapshot snapshot() const;
+
+
+	// Setters (simulation time)
+	void setSimulationTime(double);
+
+	// Setters (events)
+	void clearRopeEvents();
+
+	// Setters (snapshot)
+	void restore(const SimulatorSnapshot&);
+
 	// Setters (implementation)
 	void setImplementation(bool dynamicsType, bool integrationType);
+	void setImplementation(bool dynamicsType, IntegrationType integrationType);
+
+	// Setters (parameters); also update the fast time step of multi-rate integration (the setters of single parameters call these)
+	void setConstantDroneParameters(double, double) override;
+	void setConstantRopeParameters(double, double, double) override;
+	void setConstantCargoParameters(double, double) override;
+	void setParameters(const DynamicSystemParameters&) override;
 
 	// Other 
 	std::vector<double> simulationStep(std::vector<double>);
+	bool simulationStep(const ControlArray&, StateArray&); // Allocation-free; false --> implicit stages did not converge
+	IntegrationStatistics simulateInterval(const ControlArray&, double, StateArray&); // Adaptive (Dormand-Prince)
+	StateArray simulate(double, const ControlArray&); // Many steps, control held
+	StateArray simulate(double, const ControlArray&, TrajectoryBuffer&);
+	StateArray simulate(const std::vector<ControlScheduleEntry>&); // Many steps, control schedule
+	StateArray simulate(const std::vector<ControlScheduleEntry>&, TrajectoryBuffer&);
+	void fork(DroneRopeCargoSimulator&) const; // Continues from this simulator in another one
+
+	// Other (checkpoint); binary, in the byte order of the machine
+	static void writeSnapshot(std::ostream&, const SimulatorSnapshot&);
+	static bool readSnapshot(std::istream&, SimulatorSnapshot&);
 
 private:
 	// Attributes (implementation)	
 	int m_implementationType;
+
+	// Attributes (simulation time)
+	double m_simulationTime = 0;
+	double m_stepStartTime = 0;
+
+	// Attributes (last step); used for the state inside the last step
+	StateArray m_stepStartStateVector{};
+	double m_denseStartTime = 0;	// Start of the part of the last step covered by the dense output of the integrator
+	bool m_denseOutput = false;		// Whether the dense output of the integrator belongs to the last step
+
+	// Helper functions for simulationStep()
+	bool hasStepDenseOutput() const; // Integration type saves dense output
+
+	// Helper functions for setImplementation() and the parameter setters
+	void updateFastTimeStep(); // Time scale of the rope-cargo oscillation (see setFastTimeStep())
+
+	// Helper functions for simulate()
+	void simulateSteps(double, const ControlArray&, TrajectoryBuffer*, std::size_t&, StateArray&);
+
+	// Attributes (events)
+	std::vector<RopeEvent> m_ropeEvents; // Located with event detection enabled (see setEventDetection())
+	std::size_t m_numberOfRopeEvents = 0;
+
+	// Attributes (checkpoint); header of the binary format of a snapshot
+	static constexpr std::uint32_t snapshotIdentifier = 0x53435244; // "DRCS"
+	static constexpr std::uint32_t snapshotVersion = 1;
+
+	// Helper functions for writeSnapshot() and readSnapshot()
+	template <typename Snapshot, typename Function>
+	static void forEachSnapshotField(Snapshot&, Function&&);
+	static bool isSnapshotValid(const SimulatorSnapshot&); // Sizes, ring positions and integration type within range
 };
 
 
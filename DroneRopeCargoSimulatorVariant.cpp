@@ -0,0 +1,198 @@
+//==============================================================
+// Filename : DroneRopeCargoSimulatorVariant.cpp
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class to select a compile-time specialized
+//				 simulator at runtime, with the interface of
+//				 DroneRopeCargoSimulator used by the nodes - source
+//==============================================================
+
+// Libraries
+#include "DroneRopeCargoSimulatorVariant.h"
+#include <type_traits>
+
+
+// Getters (implementation)
+/**
+ * Retrieves whether the selected implementation is a compile-time specialized simulator
+ *
+ * @return	A (bool); false --> the integration type is not available at compile time and DroneRopeCargoSimulator is used
+ */
+bool DroneRopeCargoSimulatorVariant::isSpecialized() const {
+	return !std::holds_alternative<DroneRopeCargoSimulator>(m_simulator);
+}
+
+double DroneRopeCargoSimulatorVariant::getTimeStep() const {
+	return std::visit([](const auto& simulator) { return simulator.getTimeStep(); }, m_simulator);
+}
+
+
+// Getters (simulation time)
+double DroneRopeCargoSimulatorVariant::getSimulationTime() const {
+	return std::visit([](const auto& simulator) { return simulator.getSimulationTime(); }, m_simulator);
+}
+
+
+// Getters (state vector)
+std::vector<double> DroneRopeCargoSimulatorVariant::getStateVector() const {
+	const StateArray stateVector = getStateArray();
+	return std::vector<double>(stateVector.begin(), stateVector.end());
+}
+
+StateArray DroneRopeCargoSimulatorVariant::getStateArray() const {
+	return std::visit([](const auto& simulator) { return simulator.getStateArray(); }, m_simulator);
+}
+
+
+// Getters (output vector)
+OutputArray DroneRopeCargoSimulatorVariant::getOutputArray() {
+	return std::visit([](auto& simulator) -> OutputArray { return simulator.getOutputArray(); }, m_simulator);
+}
+
+
+// Setters (implementation)
+/**
+ * Sets the implementation of the simulator, being able to choose from
+ * (i) Cargo;					(1) Euler-integration
+ * (ii) Drone-rope-cargo		(2) RK4-integration
+ *
+ */
+void DroneRopeCargoSimulatorVariant::setImplementation(bool dynamicsType, bool integrationType) {
+	// Set implementation (false --> Euler, true --> RK4)
+	setImplementation(dynamicsType, integrationType ? IntegrationType::RungeKuttaFour : IntegrationType::Euler);
+}
+
+/**
+ * Sets the implementation of the simulator (see DroneRopeCargoSimulator::setImplementation()). Explicit Runge-Kutta
+ * integration types select the simulator specialized for the model and integration method; implicit RK, multi-rate
+ * and Adams-Bashforth-Moulton integration select DroneRopeCargoSimulator. The state vector and the parameters set
+ * earlier are carried over; the simulation time starts at zero.
+ *
+ * @param	dynamicsType : false --> drone, true --> drone with cargo
+ * @param	integrationType : the integration method
+ */
+void DroneRopeCargoSimulatorVariant::setImplementation(bool dynamicsType, IntegrationType integrationType) {
+	// Save state vector of the current simulator
+	const StateArray stateVector = getStateArray();
+
+	// Save implementation
+	m_dynamicsType = dynamicsType;
+	m_integrationType = integrationType;
+
+	// Select simulator
+	if (dynamicsType == false) {
+		setSpecializedImplementation<DroneModel>(integrationType);
+	}
+	else {
+		setSpecializedImplementation<DroneRopeCargoModel>(integrationType);
+	}
+
+	// Apply parameters and state vector
+	setConstantDroneParameters(m_massDrone, m_dragConstantDrone);
+	setConstantRopeParameters(m_ropeLengthInitial, m_ropeStiffness, m_ropeDamping);
+	setConstantCargoParameters(m_massCargo, m_dragConstantCargo);
+	setStateArray(stateVector);
+}
+
+
+// Setters (parameters)
+void DroneRopeCargoSimulatorVariant::setConstantDroneParameters(double massDrone, double dragConstantDrone) {
+	m_massDrone = massDrone;
+	m_dragConstantDrone = dragConstantDrone;
+	std::visit([&](auto& simulator) { simulator.setConstantDroneParameters(massDrone, dragConstantDrone); }, m_simulator);
+}
+
+void DroneRopeCargoSimulatorVariant::setConstantRopeParameters(double ropeLengthInitial, double ropeStiffness, double ropeDamping) {
+	m_ropeLengthInitial = ropeLengthInitial;
+	m_ropeStiffness = ropeStiffness;
+	m_ropeDamping = ropeDamping;
+	std::visit([&](auto& simulator) { simulator.setConstantRopeParameters(ropeLengthInitial, ropeStiffness, ropeDamping); }, m_simulator);
+}
+
+void DroneRopeCargoSimulatorVariant::setConstantCargoParameters(double massCargo, double dragConstantCargo) {
+	m_massCargo = massCargo;
+	m_dragConstantCargo = dragConstantCargo;
+	std::visit([&](auto& simulator) { simulator.setConstantCargoParameters(massCargo, dragConstantCargo); }, m_simulator);
+}
+
+
+// Setters (state vector)
+void DroneRopeCargoSimulatorVariant::setStateVector(std::vector<double> stateVector) {
+	StateArray stateArray{};
+	for (std::size_t i = 0; i < stateArray.size() && i < stateVector.size(); i++) {
+		stateArray[i] = stateVector[i];
+	}
+	setStateArray(stateArray);
+}
+
+void DroneRopeCargoSimulatorVariant::setStateArray(const StateArray& stateVector) {
+	std::visit([&stateVector](auto& simulator) {
+		simulator.setStateArray(stateVector);
+		if constexpr (std::is_same_v<std::decay_t<decltype(simulator)>, DroneRopeCargoSimulator>) {
+			simulator.setOutputVector(); // Output vector belongs to the new state vector
+		}
+	}, m_simulator);
+}
+
+
+// Other
+/**
+ * After having specified a control vector for the drone, it computes the resulting dynamics and thus the next state
+ * with the selected simulator (see DroneRopeCargoSimulator::simulationStep())
+ *
+ * @param	droneControlVector : the control vector to apply during this step
+ * @return	A (std::vector<double>) representing the "next" state vector of drone (+ cargo)
+ */
+std::vector<double> DroneRopeCargoSimulatorVariant::simulationStep(std::vector<double> droneControlVector) {
+	// Initialize variables
+	ControlArray controlVector{};
+	StateArray nextStateVector{};
+
+	for (std::size_t i = 0; i < controlVector.size() && i < droneControlVector.size(); i++) {
+		controlVector[i] = droneControlVector[i];
+	}
+
+	// Step
+	simulationStep(controlVector, nextStateVector);
+
+	// Return vector
+	return std::vector<double>(nextStateVector.begin(), nextStateVector.end());
+}
+
+/**
+ * Computes the next state with the selected simulator, see DroneRopeCargoSimulator::simulationStep()
+ *
+ * @param	droneControlVector : the control vector to apply during this step
+ * @param	nextStateVector : array the "next" state vector of drone (+ cargo) is written to
+ * @return	A type (bool) which is false if the Newton iterations of the step (implicit Runge-Kutta) did not converge
+ */
+bool DroneRopeCargoSimulatorVariant::simulationStep(const ControlArray& droneControlVector, StateArray& nextStateVector) {
+	return std::visit([&](auto& simulator) {
+		if constexpr (std::is_same_v<std::decay_t<decltype(simulator)>, DroneRopeCargoSimulator>) {
+			return simulator.simulationStep(droneControlVector, nextStateVector);
+		}
+		else { // Explicit methods: nothing to converge
+			simulator.simulationStep(droneControlVector, nextStateVector);
+			return true;
+		}
+	}, m_simulator);
+}
+
+
+// Helper functions for setImplementation()
+/**
+ * Selects the simulator specialized for the given model and integration method
+ *
+ * @param	integrationType : the integration method; non-explicit Runge-Kutta methods select DroneRopeCargoSimulator
+ */
+template <typename Dynamics>
+void DroneRopeCargoSimulatorVariant::setSpecializedImplementation(IntegrationType integrationType) {
+	const bool specialized = NumericalIntegrationMethods::visitExplicitRungeKuttaIntegrator(integrationType, [this](auto integrator) {
+		m_simulator.emplace<SpecializedDroneRopeCargoSimulator<Dynamics, decltype(integrator)>>();
+	});
+
+	if (!specialized) {	// Not available at compile time
+		m_simulator.emplace<DroneRopeCargoSimulator>().setImplementation(Dynamics::withCargo, integrationType);
+	}
+}
\ No newline at end of file
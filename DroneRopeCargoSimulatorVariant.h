@@ -0,0 +1,100 @@
+//==============================================================
+// Filename : DroneRopeCargoSimulatorVariant.h
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class to select a compile-time specialized
+//				 simulator at runtime, with the interface of
+//				 DroneRopeCargoSimulator used by the nodes - header
+//==============================================================
+
+// [BEGIN]: Prevent multiple inclusions of header
+#ifndef DRONEROPECARGOSIMULATORVARIANT_H
+#define DRONEROPECARGOSIMULATORVARIANT_H
+
+
+// Libraries
+#include "SpecializedDroneRopeCargoSimulator.h"
+#include "DroneRopeCargoSimulator.h"
+#include <variant>
+#include <vector>
+
+// DroneRopeCargoSimulatorVariant-class
+class DroneRopeCargoSimulatorVariant {
+public:
+	// Constructor (default)
+	DroneRopeCargoSimulatorVariant() = default;
+
+
+	// Getters (implementation)
+	bool getDynamicsType() const { return m_dynamicsType; }
+	IntegrationType getIntegrationType() const { return m_integrationType; }
+	bool isSpecialized() const; // false --> not available at compile time, DroneRopeCargoSimulator is used
+	double getTimeStep() const;
+
+	// Getters (simulation time)
+	double getSimulationTime() const;
+
+	// Getters (state vector)
+	std::vector<double> getStateVector() const;
+	StateArray getStateArray() const;
+
+	// Getters (output vector)
+	OutputArray getOutputArray();
+
+
+	// Setters (implementation)
+	void setImplementation(bool dynamicsType, bool integrationType);
+	void setImplementation(bool dynamicsType, IntegrationType integrationType);
+
+	// Setters (parameters)
+	void setConstantDroneParameters(double, double);
+	void setConstantRopeParameters(double, double, double);
+	void setConstantCargoParameters(double, double);
+
+	// Setters (state vector)
+	void setStateVector(std::vector<double>);
+	void setStateArray(const StateArray&);
+
+
+	// Other
+	std::vector<double> simulationStep(std::vector<double>);
+	bool simulationStep(const ControlArray&, StateArray&); // false --> implicit stages did not converge
+
+private:
+	// Simulators that can be selected
+	using Simulator = std::variant<
+		SpecializedDroneRopeCargoSimulator<DroneModel, EulerIntegrator>,
+		SpecializedDroneRopeCargoSimulator<DroneModel, RungeKuttaFourIntegrator>,
+		SpecializedDroneRopeCargoSimulator<DroneModel, RungeKuttaFourStageOutputIntegrator>,
+		SpecializedDroneRopeCargoSimulator<DroneModel, HeunIntegrator>,
+		SpecializedDroneRopeCargoSimulator<DroneModel, RungeKuttaThreeIntegrator>,
+		SpecializedDroneRopeCargoSimulator<DroneModel, RungeKuttaFourThreeEighthsIntegrator>,
+		SpecializedDroneRopeCargoSimulator<DroneModel, StrongStabilityPreservingRungeKuttaThreeIntegrator>,
+		SpecializedDroneRopeCargoSimulator<DroneRopeCargoModel, EulerIntegrator>,
+		SpecializedDroneRopeCargoSimulator<DroneRopeCargoModel, RungeKuttaFourIntegrator>,
+		SpecializedDroneRopeCargoSimulator<DroneRopeCargoModel, RungeKuttaFourStageOutputIntegrator>,
+		SpecializedDroneRopeCargoSimulator<DroneRopeCargoModel, HeunIntegrator>,
+		SpecializedDroneRopeCargoSimulator<DroneRopeCargoModel, RungeKuttaThreeIntegrator>,
+		SpecializedDroneRopeCargoSimulator<DroneRopeCargoModel, RungeKuttaFourThreeEighthsIntegrator>,
+		SpecializedDroneRopeCargoSimulator<DroneRopeCargoModel, StrongStabilityPreservingRungeKuttaThreeIntegrator>,
+		DroneRopeCargoSimulator>; // Implicit RK, multi-rate, Adams-Bashforth-Moulton
+
+	// Attributes (implementation)
+	bool m_dynamicsType = false;
+	IntegrationType m_integrationType = IntegrationType::Euler;
+	Simulator m_simulator;
+
+	// Attributes (parameters); applied to the simulator on setImplementation()
+	double m_massDrone = 0, m_dragConstantDrone = 0;
+	double m_ropeLengthInitial = 0, m_ropeStiffness = 0, m_ropeDamping = 0;
+	double m_massCargo = 0, m_dragConstantCargo = 0;
+
+	// Helper functions for setImplementation()
+	template <typename Dynamics>
+	void setSpecializedImplementation(IntegrationType);
+};
+
+
+// [END]: Prevent multiple inclusions of header
+#endif
\ No newline at end of file
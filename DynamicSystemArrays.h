@@ -0,0 +1,79 @@
+//==============================================================
+// Filename : DynamicSystemArrays.h
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Fixed-size vector types and parameter block of
+//				 the drone (+ cargo) system, used by the
+//				 allocation-free step path
+//==============================================================
+
+// [BEGIN]: Prevent multiple inclusions of header
+#ifndef DYNAMICSYSTEMARRAYS_H
+#define DYNAMICSYSTEMARRAYS_H
+
+
+// Libraries
+#include <array>
+
+/* NOTATIONS:
+	x1 : xDrone			u1 : tauDrone			y1 : rope length
+	x2 : yDrone			u2 : omegaDrone			y2 : rope rate of change
+	x3 : thetaDrone									y3 : rope angle
+	x4 : xDotDrone
+	x5 : yDotDrone
+	x6 : xCargo
+	x7 : yCargo
+	x8 : xDotCargo
+	x9 : yDotCargo
+*/
+
+/* PARAMETER LIST CONVENTION
+	0 : gravitational constant
+	1 : mass drone
+	2 : drag constant drone
+	3 : rope initial length
+	4 : rope damping
+	5 : rope stiffness
+	6 : mass cargo
+	7 : drag constant cargo
+*/
+
+// Fixed-size vectors
+using StateArray = std::array<double, 9>;		// x1 - x9
+using ControlArray = std::array<double, 2>;		// u1 - u2
+using OutputArray = std::array<double, 3>;		// y1 - y3
+using ParameterArray = std::array<double, 8>;	// See parameter list convention
+
+// Parameter block, built once when the parameters are set and passed by reference (see DroneRopeCargoDynamics::getParameters())
+struct DynamicSystemParameters {
+	double gravitationalConstant = 0;		// 0 : gravitational constant
+	double massDrone = 0;					// 1 : mass drone
+	double dragConstantDrone = 0;			// 2 : drag constant drone
+	double ropeLengthInitial = 0;			// 3 : rope initial length
+	double ropeDamping = 0;					// 4 : rope damping
+	double ropeStiffness = 0;				// 5 : rope stiffness
+	double massCargo = 0;					// 6 : mass cargo
+	double dragConstantCargo = 0;			// 7 : drag constant cargo
+
+	// Reciprocals (precomputed)
+	double inverseMassDrone = 0;			// 1 / mass drone
+	double inverseMassCargo = 0;			// 1 / mass cargo
+
+	// Constructor (default)
+	DynamicSystemParameters() = default;
+
+	// Constructor (from parameter list); not explicit, such that a ParameterArray can be passed where a block is expected
+	DynamicSystemParameters(const ParameterArray& parametersList)
+		: gravitationalConstant(parametersList[0]), massDrone(parametersList[1]), dragConstantDrone(parametersList[2]), ropeLengthInitial(parametersList[3]),
+		  ropeDamping(parametersList[4]), ropeStiffness(parametersList[5]), massCargo(parametersList[6]), dragConstantCargo(parametersList[7]),
+		  inverseMassDrone(1 / parametersList[1]), inverseMassCargo(1 / parametersList[6]) {}
+};
+
+// Fixed-size matrices (row-major; row i holds the derivatives of xDot(i+1))
+using StateJacobianArray = std::array<StateArray, 9>;		// df/dx (9x9)
+using ControlJacobianArray = std::array<ControlArray, 9>;	// df/du (9x2)
+
+
+// [END]: Prevent multiple inclusions of header
+#endif
\ No newline at end of file
@@ -13,11 +13,12 @@
 
 // Libraries
 #include "NumericalIntegrationProperties.h"
+#include "DenseOutputNumericalIntegration.h"
 #include <functional>
 #include <vector>
 
 // EulerIntegration-class
-class EulerNumericalIntegration : public virtual NumericalIntegrationProperties {
+class EulerNumericalIntegration : public virtual NumericalIntegrationProperties, public virtual DenseOutputNumericalIntegration {
 public:
 	// Constructor (default)
 	EulerNumericalIntegration() = default;
@@ -33,8 +34,53 @@ public:
 	std::vector<double> calculateStep(std::function<std::vector<double>(std::vector<double>, std::vector<double>, std::vector<double>, std::vector<double>, bool)>, 
 									  std::vector<double>, std::vector<double>, std::vector<double>, 
 									  std::vector<double>, bool);
+
+	// Calculate (step: fixed-size, allocation-free)
+	template <typename Function, typename State, typename Control, typename Output, typename Parameters>
+	void calculateStep(Function&&, const State&, const Control&, const Output&, const Parameters&, bool, State&);
 };
 
 
+// Calculate (step: fixed-size, allocation-free)
+/**
+ * Computes the integration of the derivative function using the Euler-approach with some timestep.
+ * Works on fixed-size arrays passed by reference and calls the derivative function directly (no std::function),
+ * such that a step does not allocate. The dense output of the step (linear) is saved, see DenseOutputNumericalIntegration.
+ *
+ * @param	function : the derivative function --> this function must adhere a [ f(x,u,y,P,n,xDot) ] format
+ * @param	stateVector : the current state vector of the system
+ * @param	controlVector : the current control vector
+ * @param	outputVector : the current output vector of the system
+ * @param	parametersList : array containing all necessary parameters to compute the derivative equation
+ * @param	dynamicsType : specifies the dynamics type to be used of the system
+ * @param	nextStateVector : array the integrated result of the derivative function is written to (may alias stateVector)
+ */
+template <typename Function, typename State, typename Control, typename Output, typename Parameters>
+void EulerNumericalIntegration::calculateStep(Function&& function, const State& stateVector, const Control& controlVector, const Output& outputVector,
+											  const Parameters& parameterList, bool dynamicsType, State& nextStateVector)
+{
+	// Initialize variables
+	State currentDynamicsVector{};
+	State x{};
+
+	// Compute dynamics
+	function(stateVector, controlVector, outputVector, parameterList, dynamicsType, currentDynamicsVector);
+
+	// Get time step
+	const double timeStep = getTimeStep();
+
+	// Add [h * f()] to current state vector
+	for (std::size_t i = 0; i < stateVector.size(); i++) {
+		x[i] = stateVector[i] + currentDynamicsVector[i] * timeStep;
+	}
+
+	// Save dense output (derivative is constant over the step)
+	setDenseOutput(stateVector, currentDynamicsVector, x, currentDynamicsVector, timeStep);
+
+	// Construct final state vector
+	nextStateVector = x;
+}
+
+
 // [END]: Prevent multiple inclusions of header
 #endif
\ No newline at end of file
@@ -0,0 +1,41 @@
+//==============================================================
+// Filename : EventDetectionNumericalIntegration.cpp
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class for detecting zero-crossings of a
+//				 switching function within an integration step,
+//				 splitting the step there - source
+//==============================================================
+
+// Libraries
+#include "EventDetectionNumericalIntegration.h"
+
+// Constructor
+EventDetectionNumericalIntegration::EventDetectionNumericalIntegration(double timeStep, double eventTolerance) : NumericalIntegrationProperties(timeStep) {
+	// Set attributes
+	setEventDetection(true);
+	setEventTolerance(eventTolerance);
+}
+
+
+// Setters (settings)
+/**
+ *	Enables or disables the detection of zero-crossings within a step
+ *
+ *	@param	eventDetection : true --> steps are split at zero-crossings of the switching function
+ */
+void EventDetectionNumericalIntegration::setEventDetection(bool eventDetection) {
+	m_eventDetection = eventDetection;
+}
+
+/**
+ *	Sets the accuracy with which the time of a zero-crossing is located
+ *
+ *	@param	eventTolerance : width of the bracket around an event [s]; must be larger than zero
+ */
+void EventDetectionNumericalIntegration::setEventTolerance(double eventTolerance) {
+	if (eventTolerance > 0) {
+		m_eventTolerance = eventTolerance;
+	}
+}
\ No newline at end of file
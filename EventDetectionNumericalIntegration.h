@@ -0,0 +1,155 @@
+//==============================================================
+// Filename : EventDetectionNumericalIntegration.h
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class for detecting zero-crossings of a
+//				 switching function within an integration step,
+//				 splitting the step there - header
+//==============================================================
+
+// [BEGIN]: Prevent multiple inclusions of header
+#ifndef EVENTDETECTIONNUMERICALINTEGRATION_H
+#define EVENTDETECTIONNUMERICALINTEGRATION_H
+
+
+// Libraries
+#include "NumericalIntegrationProperties.h"
+#include <array>
+#include <cstddef>
+
+// Zero-crossing of a switching function within a step
+struct IntegrationEvent {
+	double time = 0;		// Time of the crossing, relative to the start of the step [s]
+	bool rising = false;	// Switching function went from (<= 0) to (> 0)
+};
+
+// EventDetectionNumericalIntegration-class
+class EventDetectionNumericalIntegration : public virtual NumericalIntegrationProperties {
+public:
+	// Constructor (default)
+	EventDetectionNumericalIntegration() = default;
+
+	// Constructor (with arguments)
+	EventDetectionNumericalIntegration(double timeStep, double eventTolerance);
+
+
+	// Getters (settings)
+	bool getEventDetection() const { return m_eventDetection; }
+	double getEventTolerance() const { return m_eventTolerance; }
+
+	// Getters (events of the last step)
+	std::size_t getNumberOfStepEvents() const { return m_numberOfStepEvents; }
+	const IntegrationEvent& getStepEvent(std::size_t index) const { return m_stepEvents[index]; }
+
+
+	// Setters (settings)
+	void setEventDetection(bool);
+	void setEventTolerance(double);
+
+
+	// Calculate (step)
+	template <typename StepFunction, typename TrialStepFunction, typename SwitchingFunction, typename State>
+	void calculateStep(StepFunction&&, TrialStepFunction&&, SwitchingFunction&&, const State&, State&);
+
+	// Maximum number of events located within one step (further crossings are stepped over)
+	static constexpr std::size_t maximumStepEvents = 4;
+
+private:
+	// Attributes (settings)
+	bool m_eventDetection = false;
+	double m_eventTolerance = 1e-8; // Width of the bracket around an event [s]
+
+	// Attributes (events of the last step)
+	std::array<IntegrationEvent, maximumStepEvents> m_stepEvents{};
+	std::size_t m_numberOfStepEvents = 0;
+};
+
+
+// Calculate (step)
+/**
+ * Integrates a step of getTimeStep() with the given step function, locating zero-crossings of the switching function.
+ * The full step is taken first; if the sign of the switching function (> 0 or <= 0) differs between its start and end,
+ * the crossing is bracketed by bisection on the length of the step from the start state, until the bracket is smaller
+ * than the event tolerance. The step is then split there: the state just past the crossing is kept, and the remainder
+ * of the step is integrated from it (and checked for further crossings). A derivative with a kink at the crossing is
+ * therefore never integrated across it by more than the event tolerance.
+ *
+ * The partial steps of the bisection are taken with the trial step function, which has to leave the integrator as it
+ * was (e.g. its derivative history and counters), such that locating an event does not count as many restarts or
+ * failures as there are bisection steps. Without a crossing the result equals a single call of the step function.
+ * The located events are available through getStepEvent() until the next step.
+ *
+ * @param	stepFunction : integrates over getTimeStep() --> [ step(x,next) ] format; it is called with stateVector itself
+ *						   (same reference) for the (partial) steps that start at the start of the step
+ * @param	trialStepFunction : as the step function, for the partial steps of the bisection; leaves the integrator unchanged
+ * @param	switchingFunction : the switching function of a state --> [ s = g(x) ] format
+ * @param	stateVector : the current state vector of the system
+ * @param	nextStateVector : array the state at the end of the step is written to (may not alias stateVector)
+ */
+template <typename StepFunction, typename TrialStepFunction, typename SwitchingFunction, typename State>
+void EventDetectionNumericalIntegration::calculateStep(StepFunction&& stepFunction, TrialStepFunction&& trialStepFunction, SwitchingFunction&& switchingFunction,
+													   const State& stateVector, State& nextStateVector)
+{
+	// Initialize variables
+	const double timeStep = getTimeStep();
+	State stepStartStateVector = stateVector;		// Start of the (remaining) step, once an event was located
+	State trialStateVector{};						// End of a trial (partial) step
+	double stepStartTime = 0;						// Start of the (remaining) step, relative to the start of the step
+	m_numberOfStepEvents = 0;
+
+	// Integrates from the start of the remaining step over a given length
+	auto step = [&](double length, State& endStateVector) {
+		setTimeStep(length);
+		if (stepStartTime == 0) { stepFunction(stateVector, endStateVector); }
+		else { stepFunction(stepStartStateVector, endStateVector); }
+	};
+	auto trialStep = [&](double length, State& endStateVector) {
+		setTimeStep(length);
+		if (stepStartTime == 0) { trialStepFunction(stateVector, endStateVector); }
+		else { trialStepFunction(stepStartStateVector, endStateVector); }
+	};
+
+	// Full (remaining) step
+	bool startSide = (switchingFunction(stateVector) > 0);
+	step(timeStep, nextStateVector);
+
+	while (m_numberOfStepEvents < maximumStepEvents && ((switchingFunction(nextStateVector) > 0) != startSide)) {
+		// Bisect the length of the partial step: [lower] has not crossed yet, [upper] has
+		double lower = 0, upper = timeStep - stepStartTime;
+		State upperStateVector = nextStateVector;
+		while (upper - lower > m_eventTolerance) {
+			const double middle = 0.5 * (lower + upper);
+			if (middle <= lower || middle >= upper) { break; } // Bracket at round-off level
+
+			trialStep(middle, trialStateVector);
+			if ((switchingFunction(trialStateVector) > 0) == startSide) {
+				lower = middle;
+			}
+			else {
+				upper = middle;
+				upperStateVector = trialStateVector;
+			}
+		}
+
+		// Save event (just past the crossing)
+		stepStartTime += upper;
+		m_stepEvents[m_numberOfStepEvents++] = { stepStartTime, !startSide };
+
+		// Continue from the event with the remainder of the step
+		stepStartStateVector = upperStateVector;
+		startSide = !startSide;
+		if (timeStep - stepStartTime <= 0) {
+			nextStateVector = stepStartStateVector;
+			break;
+		}
+		step(timeStep - stepStartTime, nextStateVector);
+	}
+
+	// Restore time step
+	setTimeStep(timeStep);
+}
+
+
+// [END]: Prevent multiple inclusions of header
+#endif
\ No newline at end of file
@@ -0,0 +1,15 @@
+//==============================================================
+// Filename : ExplicitRungeKuttaNumericalIntegration.cpp
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class for explicit Runge-Kutta numerical 
+//				 integration with a compile-time Butcher 
+//				 tableau - source
+//==============================================================
+
+// Libraries
+#include "ExplicitRungeKuttaNumericalIntegration.h"
+
+// Constructor
+ExplicitRungeKuttaNumericalIntegration::ExplicitRungeKuttaNumericalIntegration(double timeStep) : NumericalIntegrationProperties(timeStep) {}
\ No newline at end of file
@@ -0,0 +1,253 @@
+//==============================================================
+// Filename : ExplicitRungeKuttaNumericalIntegration.h
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class for explicit Runge-Kutta numerical
+//				 integration with a compile-time Butcher
+//				 tableau - header
+//==============================================================
+
+// [BEGIN]: Prevent multiple inclusions of header
+#ifndef EXPLICITRUNGEKUTTANUMERICALINTEGRATION_H
+#define EXPLICITRUNGEKUTTANUMERICALINTEGRATION_H
+
+
+// Libraries
+#include "NumericalIntegrationProperties.h"
+#include "DenseOutputNumericalIntegration.h"
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+// Coefficient of a Butcher tableau, stored as a fraction such that (h * numerator / denominator) is rounded as in
+// hand-written code (e.g. h / 6 instead of h * 0.1666...)
+struct ButcherCoefficient {
+	double numerator = 0;
+	double denominator = 1;
+
+	constexpr bool isZero() const { return numerator == 0; }
+	constexpr double getValue() const { return numerator / denominator; }
+};
+
+// Butcher tableau of an explicit Runge-Kutta method (a: strictly lower triangular)
+template <std::size_t NumberOfStages>
+struct ButcherTableau {
+	static constexpr std::size_t numberOfStages = NumberOfStages;
+
+	ButcherCoefficient a[NumberOfStages][NumberOfStages];	// Stage coefficients
+	ButcherCoefficient b[NumberOfStages];					// Weights
+	ButcherCoefficient c[NumberOfStages];					// Nodes
+
+	// Checks consistency: weights sum to one, rows of a sum to the nodes, a is strictly lower triangular
+	constexpr bool isConsistent() const {
+		double weightSum = 0;
+		for (std::size_t i = 0; i < NumberOfStages; i++) {
+			double rowSum = 0;
+			for (std::size_t j = 0; j < NumberOfStages; j++) {
+				if ((j >= i) && !a[i][j].isZero()) { return false; }
+				rowSum += a[i][j].getValue();
+			}
+			if ((rowSum - c[i].getValue() > 1e-12) || (c[i].getValue() - rowSum > 1e-12)) { return false; }
+			weightSum += b[i].getValue();
+		}
+		return (weightSum - 1 < 1e-12) && (1 - weightSum < 1e-12);
+	}
+
+	// Last stage evaluated at the end of the step (node one); its derivative is used for the dense output
+	constexpr std::size_t getEndStage() const {
+		std::size_t endStage = 0;
+		for (std::size_t i = 0; i < NumberOfStages; i++) {
+			if (c[i].numerator == c[i].denominator) { endStage = i; }
+		}
+		return endStage;
+	}
+};
+
+// Available Butcher tableaux
+struct ButcherTableaux {
+	// Forward Euler, first order
+	static constexpr ButcherTableau<1> euler = {
+		{ { {} } },
+		{ {1, 1} },
+		{ {0, 1} }
+	};
+
+	// Heun (explicit trapezoidal rule), second order
+	static constexpr ButcherTableau<2> heun = {
+		{ { {},		{} },
+		  { {1, 1},	{} } },
+		{ {1, 2}, {1, 2} },
+		{ {0, 1}, {1, 1} }
+	};
+
+	// Kutta's third order method
+	static constexpr ButcherTableau<3> rungeKuttaThree = {
+		{ { {},			{},		{} },
+		  { {1, 2},		{},		{} },
+		  { {-1, 1},	{2, 1},	{} } },
+		{ {1, 6}, {2, 3}, {1, 6} },
+		{ {0, 1}, {1, 2}, {1, 1} }
+	};
+
+	// Classic Runge-Kutta 4, fourth order
+	static constexpr ButcherTableau<4> rungeKuttaFour = {
+		{ { {},		{},		{},		{} },
+		  { {1, 2},	{},		{},		{} },
+		  { {},		{1, 2},	{},		{} },
+		  { {},		{},		{1, 1},	{} } },
+		{ {1, 6}, {1, 3}, {1, 3}, {1, 6} },
+		{ {0, 1}, {1, 2}, {1, 2}, {1, 1} }
+	};
+
+	// Runge-Kutta 4, 3/8-rule, fourth order
+	static constexpr ButcherTableau<4> rungeKuttaFourThreeEighths = {
+		{ { {},			{},			{},		{} },
+		  { {1, 3},		{},			{},		{} },
+		  { {-1, 3},	{1, 1},		{},		{} },
+		  { {1, 1},		{-1, 1},	{1, 1},	{} } },
+		{ {1, 8}, {3, 8}, {3, 8}, {1, 8} },
+		{ {0, 1}, {1, 3}, {2, 3}, {1, 1} }
+	};
+
+	// Strong stability preserving Runge-Kutta 3 (Shu-Osher), third order
+	static constexpr ButcherTableau<3> strongStabilityPreservingRungeKuttaThree = {
+		{ { {},		{},		{} },
+		  { {1, 1},	{},		{} },
+		  { {1, 4},	{1, 4},	{} } },
+		{ {1, 6}, {1, 6}, {2, 3} },
+		{ {0, 1}, {1, 1}, {1, 2} }
+	};
+};
+
+// Checked at compile time
+static_assert(ButcherTableaux::euler.isConsistent(), "Inconsistent Butcher tableau (Euler)");
+static_assert(ButcherTableaux::heun.isConsistent(), "Inconsistent Butcher tableau (Heun)");
+static_assert(ButcherTableaux::rungeKuttaThree.isConsistent(), "Inconsistent Butcher tableau (RK3)");
+static_assert(ButcherTableaux::rungeKuttaFour.isConsistent(), "Inconsistent Butcher tableau (RK4)");
+static_assert(ButcherTableaux::rungeKuttaFourThreeEighths.isConsistent(), "Inconsistent Butcher tableau (RK4, 3/8-rule)");
+static_assert(ButcherTableaux::strongStabilityPreservingRungeKuttaThree.isConsistent(), "Inconsistent Butcher tableau (SSPRK3)");
+
+// ExplicitRungeKuttaNumericalIntegration-class
+class ExplicitRungeKuttaNumericalIntegration : public virtual NumericalIntegrationProperties, public virtual DenseOutputNumericalIntegration {
+public:
+	// Constructor (default)
+	ExplicitRungeKuttaNumericalIntegration() = default;
+
+	// Constructor (with arguments)
+	ExplicitRungeKuttaNumericalIntegration(double timeStep);
+
+
+	// Calculate (step)
+	template <const auto& Tableau, typename Function, typename State, typename Control, typename Output, typename Parameters>
+	void calculateStep(Function&&, const State&, const Control&, const Output&, const Parameters&, bool, State&);
+	template <const auto& Tableau, typename Function, typename OutputFunction, typename State, typename Control, typename Parameters>
+	void calculateStep(Function&&, OutputFunction&&, const State&, const Control&, const Parameters&, bool, State&); // Output vector per stage
+
+private:
+	// Helper functions for calculateStep(); calls body(std::integral_constant<std::size_t, i>) for i = 0, 1, ... (unrolled)
+	template <typename Body, std::size_t... Indices>
+	static void unroll(Body&& body, std::index_sequence<Indices...>) { (body(std::integral_constant<std::size_t, Indices>{}), ...); }
+};
+
+
+// Calculate (step)
+/**
+ * Computes the integration of the derivative function using the explicit Runge-Kutta method of the given Butcher tableau,
+ * with the output vector held constant over the step.
+ *
+ * @param	function : the derivative function --> this function must adhere a [ f(x,u,y,P,n,xDot) ] format
+ * @param	stateVector : the current state vector of the system
+ * @param	controlVector : the current control vector
+ * @param	outputVector : the current output vector of the system
+ * @param	parametersList : array containing all necessary parameters to compute the derivative equation
+ * @param	dynamicsType : specifies the dynamics type to be used of the system
+ * @param	nextStateVector : array the integrated result of the derivative function is written to (may alias stateVector)
+ */
+template <const auto& Tableau, typename Function, typename State, typename Control, typename Output, typename Parameters>
+void ExplicitRungeKuttaNumericalIntegration::calculateStep(Function&& function, const State& stateVector, const Control& controlVector, const Output& outputVector,
+														   const Parameters& parameterList, bool dynamicsType, State& nextStateVector)
+{
+	// Output vector is constant over the step
+	auto outputFunction = [&outputVector](const State&) -> const Output& { return outputVector; };
+
+	// Integrate
+	calculateStep<Tableau>(function, outputFunction, stateVector, controlVector, parameterList, dynamicsType, nextStateVector);
+}
+
+/**
+ * Computes the integration of the derivative function using the explicit Runge-Kutta method of the given Butcher tableau:
+ *
+ *		K_i = f(x + h * sum_j(a_ij * K_j)),		x_next = x + h * sum_i(b_i * K_i)
+ *
+ * with the output vector recomputed from every stage state with the output function. The tableau is a compile-time
+ * constant: the stage loops are unrolled and zero coefficients are skipped, such that the generated code equals a
+ * hand-written implementation of the method (for the classic RK4-tableau, RungeKuttaFourNumericalIntegration, bit for bit).
+ * The dense output of the step (cubic Hermite with the derivatives of the first stage and of the last stage at the end of
+ * the step) is saved, see DenseOutputNumericalIntegration.
+ *
+ * @param	function : the derivative function --> this function must adhere a [ f(x,u,y,P,n,xDot) ] format
+ * @param	outputFunction : computes the output vector from a state vector --> [ y = g(x) ] format
+ * @param	stateVector : the current state vector of the system
+ * @param	controlVector : the current control vector
+ * @param	parametersList : array containing all necessary parameters to compute the derivative equation
+ * @param	dynamicsType : specifies the dynamics type to be used of the system
+ * @param	nextStateVector : array the integrated result of the derivative function is written to (may alias stateVector)
+ */
+template <const auto& Tableau, typename Function, typename OutputFunction, typename State, typename Control, typename Parameters>
+void ExplicitRungeKuttaNumericalIntegration::calculateStep(Function&& function, OutputFunction&& outputFunction, const State& stateVector, const Control& controlVector,
+														   const Parameters& parameterList, bool dynamicsType, State& nextStateVector)
+{
+	// Initialize variables
+	constexpr std::size_t numberOfStages = std::decay_t<decltype(Tableau)>::numberOfStages;
+	std::array<State, numberOfStages> K{};	// K's of the method
+	State stateVectorK{};					// Used for f(x + K)
+	State x{};								// Next state
+	const double timeStep = getTimeStep();
+
+	// Compute K's --> K_i = f(x + h * sum_j(a_ij * K_j))
+	unroll([&](auto stage) {
+		constexpr std::size_t i = decltype(stage)::value;
+
+		if constexpr (i == 0) { // First stage at the current state
+			function(stateVector, controlVector, outputFunction(stateVector), parameterList, dynamicsType, K[0]);
+		}
+		else {
+			for (std::size_t k = 0; k < stateVector.size(); k++) {
+				double value = stateVector[k];
+				unroll([&](auto previousStage) {
+					constexpr std::size_t j = decltype(previousStage)::value;
+					if constexpr (!Tableau.a[i][j].isZero()) {
+						value = value + K[j][k] * (timeStep * Tableau.a[i][j].numerator / Tableau.a[i][j].denominator);
+					}
+				}, std::make_index_sequence<i>{});
+				stateVectorK[k] = value;
+			}
+			function(stateVectorK, controlVector, outputFunction(stateVectorK), parameterList, dynamicsType, K[i]);
+		}
+	}, std::make_index_sequence<numberOfStages>{});
+
+	// Sum to construct final state vector
+	//		EQUATION: x_next = x_current + h * sum_i(b_i * K_i)
+	for (std::size_t k = 0; k < stateVector.size(); k++) {
+		double value = stateVector[k];
+		unroll([&](auto stage) {
+			constexpr std::size_t i = decltype(stage)::value;
+			if constexpr (!Tableau.b[i].isZero()) {
+				value = value + K[i][k] * (timeStep * Tableau.b[i].numerator / Tableau.b[i].denominator);
+			}
+		}, std::make_index_sequence<numberOfStages>{});
+		x[k] = value;
+	}
+
+	// Save dense output
+	setDenseOutput(stateVector, K[0], x, K[Tableau.getEndStage()], timeStep);
+
+	// Construct final state vector
+	nextStateVector = x;
+}
+
+
+// [END]: Prevent multiple inclusions of header
+#endif
\ No newline at end of file
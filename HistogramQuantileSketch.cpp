@@ -0,0 +1,99 @@
+//==============================================================
+// Filename : HistogramQuantileSketch.cpp
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class for estimating quantiles of a stream of
+//				 values from a fixed-range histogram - source
+//==============================================================
+
+// Libraries
+#include "HistogramQuantileSketch.h"
+#include <algorithm>
+
+
+// Constructor
+/**
+ * Creates an empty histogram of equal bins between the bounds. Quantiles are exact up to the bin width for values
+ * between the bounds; values outside the bounds are counted but only located at the bound.
+ *
+ * @param	lowerBound : lower bound of the first bin
+ * @param	upperBound : upper bound of the last bin
+ * @param	numberOfBins : number of bins (at least one)
+ */
+HistogramQuantileSketch::HistogramQuantileSketch(double lowerBound, double upperBound, std::size_t numberOfBins)
+	: m_lowerBound(lowerBound), m_upperBound(upperBound), m_counts(std::max<std::size_t>(numberOfBins, 1) + 2, 0) {}
+
+
+// Getters (histogram)
+double HistogramQuantileSketch::getBinWidth() const {
+	return (m_upperBound - m_lowerBound) / double(getNumberOfBins());
+}
+
+
+// Getters (quantiles)
+/**
+ * Estimates a quantile by locating its rank in the histogram and interpolating linearly inside the bin
+ *
+ * @param	probability : the probability of the quantile, in [0, 1] (0.5 --> median)
+ * @return	A (double) which is the estimated quantile; zero for an empty histogram
+ */
+double HistogramQuantileSketch::getQuantile(double probability) const {
+	if (m_count == 0) {
+		return 0;
+	}
+
+	// Rank of the quantile
+	const double rank = std::clamp(probability, 0.0, 1.0) * double(m_count);
+
+	// Underflow
+	double cumulativeCount = double(m_counts.front());
+	if (rank <= cumulativeCount && m_counts.front() > 0) {
+		return m_lowerBound;
+	}
+
+	// Bins
+	for (std::size_t bin = 0; bin < getNumberOfBins(); bin++) {
+		const double binCount = double(m_counts[bin + 1]);
+		if (binCount > 0 && rank <= cumulativeCount + binCount) {
+			return m_lowerBound + (double(bin) + (rank - cumulativeCount) / binCount) * getBinWidth();
+		}
+		cumulativeCount += binCount;
+	}
+
+	// Overflow
+	return m_upperBound;
+}
+
+
+// Other
+/**
+ * Adds a value to its bin
+ *
+ * @param	value : the value to add
+ */
+void HistogramQuantileSketch::add(double value) {
+	std::size_t index = 0; // Underflow
+	if (value >= m_upperBound) {
+		index = m_counts.size() - 1; // Overflow
+	}
+	else if (value >= m_lowerBound) {
+		index = 1 + std::min(std::size_t((value - m_lowerBound) / getBinWidth()), getNumberOfBins() - 1);
+	}
+
+	m_counts[index]++;
+	m_count++;
+}
+
+/**
+ * Adds the counts of another histogram with the same bounds and number of bins. Counts are integers, such that the
+ * result does not depend on the order of merging.
+ *
+ * @param	other : the histogram to add
+ */
+void HistogramQuantileSketch::merge(const HistogramQuantileSketch& other) {
+	for (std::size_t index = 0; index < m_counts.size() && index < other.m_counts.size(); index++) {
+		m_counts[index] += other.m_counts[index];
+	}
+	m_count += other.m_count;
+}
\ No newline at end of file
@@ -0,0 +1,57 @@
+//==============================================================
+// Filename : HistogramQuantileSketch.h
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class for estimating quantiles of a stream of
+//				 values from a fixed-range histogram - header
+//==============================================================
+
+// [BEGIN]: Prevent multiple inclusions of header
+#ifndef HISTOGRAMQUANTILESKETCH_H
+#define HISTOGRAMQUANTILESKETCH_H
+
+
+// Libraries
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// HistogramQuantileSketch-class
+class HistogramQuantileSketch {
+public:
+	// Constructor (default)
+	HistogramQuantileSketch() = default;
+
+	// Constructor (with arguments)
+	HistogramQuantileSketch(double lowerBound, double upperBound, std::size_t numberOfBins);
+
+
+	// Getters (histogram)
+	double getLowerBound() const { return m_lowerBound; }
+	double getUpperBound() const { return m_upperBound; }
+	double getBinWidth() const;
+	std::size_t getNumberOfBins() const { return m_counts.size() - 2; }
+	std::uint64_t getCount() const { return m_count; }
+	std::uint64_t getUnderflowCount() const { return m_counts.front(); } // Values below the lower bound
+	std::uint64_t getOverflowCount() const { return m_counts.back(); } // Values at or above the upper bound
+
+	// Getters (quantiles)
+	double getQuantile(double) const;
+
+
+	// Other
+	void add(double);
+	void merge(const HistogramQuantileSketch&); // Same bounds and number of bins
+
+private:
+	// Attributes (histogram)
+	double m_lowerBound = 0;
+	double m_upperBound = 1;
+	std::vector<std::uint64_t> m_counts = std::vector<std::uint64_t>(3, 0); // Underflow, bins, overflow
+	std::uint64_t m_count = 0;
+};
+
+
+// [END]: Prevent multiple inclusions of header
+#endif
\ No newline at end of file
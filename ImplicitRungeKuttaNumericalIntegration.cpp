@@ -0,0 +1,41 @@
+//==============================================================
+// Filename : ImplicitRungeKuttaNumericalIntegration.cpp
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class for (diagonally) implicit Runge-Kutta
+//				 numerical integration of stiff systems - source
+//==============================================================
+
+// Libraries
+#include "ImplicitRungeKuttaNumericalIntegration.h"
+
+// Constructor
+ImplicitRungeKuttaNumericalIntegration::ImplicitRungeKuttaNumericalIntegration(double timeStep) : NumericalIntegrationProperties(timeStep) {}
+
+
+// Setters (Newton iterations)
+/**
+ *	Sets the tolerance at which the Newton iterations of a stage are considered converged:
+ *	max|increment| <= newtonTolerance * (1 + max|stage|)
+ *
+ *	@param	newtonTolerance : relative tolerance on the Newton increment
+ */
+void ImplicitRungeKuttaNumericalIntegration::setNewtonTolerance(double newtonTolerance) {
+	m_newtonTolerance = newtonTolerance;
+}
+
+void ImplicitRungeKuttaNumericalIntegration::setMaximumNewtonIterations(int maximumNewtonIterations) {
+	m_maximumNewtonIterations = maximumNewtonIterations;
+}
+
+/**
+ *	Resets the number of steps in which a stage did not converge (see getNumberOfNewtonFailures())
+ */
+void ImplicitRungeKuttaNumericalIntegration::resetNumberOfNewtonFailures() {
+	m_numberOfNewtonFailures = 0;
+}
+
+void ImplicitRungeKuttaNumericalIntegration::setNumberOfNewtonFailures(int numberOfNewtonFailures) {
+	m_numberOfNewtonFailures = numberOfNewtonFailures;
+}
\ No newline at end of file
@@ -0,0 +1,325 @@
+//==============================================================
+// Filename : ImplicitRungeKuttaNumericalIntegration.h
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class for (diagonally) implicit Runge-Kutta
+//				 numerical integration of stiff systems - header
+//==============================================================
+
+// [BEGIN]: Prevent multiple inclusions of header
+#ifndef IMPLICITRUNGEKUTTANUMERICALINTEGRATION_H
+#define IMPLICITRUNGEKUTTANUMERICALINTEGRATION_H
+
+
+// Libraries
+#include "NumericalIntegrationProperties.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <utility>
+
+// ImplicitRungeKuttaNumericalIntegration-class
+class ImplicitRungeKuttaNumericalIntegration : public virtual NumericalIntegrationProperties {
+public:
+	// Constructor (default)
+	ImplicitRungeKuttaNumericalIntegration() = default;
+
+	// Constructor (with arguments)
+	ImplicitRungeKuttaNumericalIntegration(double timeStep);
+
+
+	// Getters (Newton iterations)
+	double getNewtonTolerance() const { return m_newtonTolerance; }
+	int getMaximumNewtonIterations() const { return m_maximumNewtonIterations; }
+	int getNewtonIterations() const { return m_newtonIterations; } // Of the last step
+	bool getNewtonConverged() const { return m_newtonConverged; } // Of the last step
+	int getNumberOfNewtonFailures() const { return m_numberOfNewtonFailures; } // Steps with a stage that did not converge
+
+
+	// Setters (Newton iterations)
+	void setNewtonTolerance(double);
+	void setMaximumNewtonIterations(int);
+	void resetNumberOfNewtonFailures();
+	void setNumberOfNewtonFailures(int); // E.g. to undo trial steps
+
+
+	// Calculate (step)
+	template <typename Function, typename OutputFunction, typename State, typename Control, typename Parameters>
+	void calculateStep(Function&&, OutputFunction&&, const State&, const Control&, const Parameters&, bool, State&);
+	template <typename Function, typename OutputFunction, typename JacobianFunction, typename State, typename Control, typename Parameters>
+	void calculateStep(Function&&, OutputFunction&&, JacobianFunction&&, const State&, const Control&, const Parameters&, bool, State&);
+
+	// Calculate (jacobian)
+	template <typename Function, typename OutputFunction, typename State, typename Control, typename Parameters>
+	static void calculateJacobianFiniteDifference(Function&&, OutputFunction&&, const State&, const State&, const Control&, const Parameters&, bool,
+												  std::array<State, std::tuple_size<State>::value>&);
+
+private:
+	// Attributes (Newton iterations)
+	double m_newtonTolerance = 1e-10;
+	int m_maximumNewtonIterations = 10;
+	int m_newtonIterations = 0;
+	bool m_newtonConverged = true;
+	int m_numberOfNewtonFailures = 0;
+
+	// Helper functions for calculateStep()
+	template <typename Function, typename OutputFunction, typename JacobianFunction, typename State, typename Control, typename Parameters>
+	bool calculateStage(Function&&, OutputFunction&&, JacobianFunction&&, const State&, double, const Control&, const Parameters&, bool, State&);
+	template <typename State>
+	static void calculateLUDecomposition(std::array<State, std::tuple_size<State>::value>&, std::array<std::size_t, std::tuple_size<State>::value>&);
+	template <typename State>
+	static void calculateLUSolution(const std::array<State, std::tuple_size<State>::value>&, const std::array<std::size_t, std::tuple_size<State>::value>&, State&);
+};
+
+
+// Calculate (step)
+/**
+ * Computes the integration of the derivative function with the implicit method, using a finite-difference Jacobian
+ *
+ * @param	function : the derivative function --> this function must adhere a [ f(x,u,y,P,n,xDot) ] format
+ * @param	outputFunction : computes the output vector from a state vector --> [ y = g(x) ] format
+ * @param	stateVector : the current state vector of the system
+ * @param	controlVector : the current control vector
+ * @param	parametersList : array containing all necessary parameters to compute the derivative equation
+ * @param	dynamicsType : specifies the dynamics type to be used of the system
+ * @param	nextStateVector : array the integrated result of the derivative function is written to (may alias stateVector)
+ */
+template <typename Function, typename OutputFunction, typename State, typename Control, typename Parameters>
+void ImplicitRungeKuttaNumericalIntegration::calculateStep(Function&& function, OutputFunction&& outputFunction, const State& stateVector, const Control& controlVector,
+														   const Parameters& parameterList, bool dynamicsType, State& nextStateVector)
+{
+	// Jacobian by finite differences
+	auto jacobianFunction = [&](const State& x, const State& xDot, std::array<State, std::tuple_size<State>::value>& jacobian) {
+		calculateJacobianFiniteDifference(function, outputFunction, x, xDot, controlVector, parameterList, dynamicsType, jacobian);
+	};
+
+	// Integrate
+	calculateStep(function, outputFunction, jacobianFunction, stateVector, controlVector, parameterList, dynamicsType, nextStateVector);
+}
+
+/**
+ * Computes the integration of the derivative function using the two-stage, L-stable, second order
+ * singly diagonally implicit Runge-Kutta method (SDIRK2):
+ *
+ *		Z1 = x + gamma*h*f(Z1)
+ *		Z2 = x + (1 - gamma)*h*f(Z1) + gamma*h*f(Z2),		gamma = 1 - 1/sqrt(2)
+ *		x_next = Z2
+ *
+ * Each stage is solved with Newton iterations, in which the Jacobian is re-evaluated at every iterate. This keeps
+ * the method stable at large time steps for stiff ropes, also when the rope switches between slack and taut within
+ * a step (a single linearization, as in Rosenbrock methods, is not sufficient there). A stage that has not converged
+ * within the maximum number of iterations is kept as it is; the step is then flagged (getNewtonConverged()) and
+ * counted (getNumberOfNewtonFailures()).
+ *
+ * @param	function : the derivative function --> this function must adhere a [ f(x,u,y,P,n,xDot) ] format
+ * @param	outputFunction : computes the output vector from a state vector --> [ y = g(x) ] format
+ * @param	jacobianFunction : computes the Jacobian df/dx at a state --> [ J(x,xDot,jacobian) ] format
+ * @param	stateVector : the current state vector of the system
+ * @param	controlVector : the current control vector
+ * @param	parametersList : array containing all necessary parameters to compute the derivative equation
+ * @param	dynamicsType : specifies the dynamics type to be used of the system
+ * @param	nextStateVector : array the integrated result of the derivative function is written to (may alias stateVector)
+ */
+template <typename Function, typename OutputFunction, typename JacobianFunction, typename State, typename Control, typename Parameters>
+void ImplicitRungeKuttaNumericalIntegration::calculateStep(Function&& function, OutputFunction&& outputFunction, JacobianFunction&& jacobianFunction, const State& stateVector,
+														   const Control& controlVector, const Parameters& parameterList, bool dynamicsType, State& nextStateVector)
+{
+	// Initialize variables
+	constexpr std::size_t n = std::tuple_size<State>::value;
+	const double gamma = 1 - 1 / std::sqrt(2.0);
+	const double timeStep = getTimeStep();
+	State Z1 = stateVector, Z2{}, stageOffset{};
+
+	// Reset iteration counter
+	m_newtonIterations = 0;
+
+	// Stage 1 --> Z1 = x + gamma*h*f(Z1)
+	bool converged = calculateStage(function, outputFunction, jacobianFunction, stateVector, gamma * timeStep, controlVector, parameterList, dynamicsType, Z1);
+
+	// Stage 2 --> Z2 = [x + (1 - gamma)*h*f(Z1)] + gamma*h*f(Z2); f(Z1) follows from the stage equation
+	for (std::size_t i = 0; i < n; i++) {
+		stageOffset[i] = stateVector[i] + ((1 - gamma) / gamma) * (Z1[i] - stateVector[i]);
+	}
+	Z2 = Z1;
+	converged = calculateStage(function, outputFunction, jacobianFunction, stageOffset, gamma * timeStep, controlVector, parameterList, dynamicsType, Z2) && converged;
+
+	// Flag and count a step that did not converge
+	m_newtonConverged = converged;
+	if (!converged) {
+		m_numberOfNewtonFailures++;
+	}
+
+	// Construct final state vector
+	nextStateVector = Z2;
+}
+
+
+// Calculate (jacobian)
+/**
+ * Computes the Jacobian of the derivative function w.r.t. the state vector by forward finite differences,
+ * including the dependency of the output vector on the state vector
+ *
+ * @param	function : the derivative function --> this function must adhere a [ f(x,u,y,P,n,xDot) ] format
+ * @param	outputFunction : computes the output vector from a state vector --> [ y = g(x) ] format
+ * @param	stateVector : the state vector to linearize around
+ * @param	dynamicsStateVector : the derivative f(x) at the state vector
+ * @param	controlVector : the current control vector
+ * @param	parametersList : array containing all necessary parameters to compute the derivative equation
+ * @param	dynamicsType : specifies the dynamics type to be used of the system
+ * @param	jacobian : matrix (row-major) the Jacobian df/dx is written to
+ */
+template <typename Function, typename OutputFunction, typename State, typename Control, typename Parameters>
+void ImplicitRungeKuttaNumericalIntegration::calculateJacobianFiniteDifference(Function&& function, OutputFunction&& outputFunction, const State& stateVector, const State& dynamicsStateVector,
+																			   const Control& controlVector, const Parameters& parameterList, bool dynamicsType,
+																			   std::array<State, std::tuple_size<State>::value>& jacobian)
+{
+	// Initialize variables
+	constexpr std::size_t n = std::tuple_size<State>::value;
+	const double epsilon = std::sqrt(std::numeric_limits<double>::epsilon());
+	State perturbedStateVector = stateVector;
+	State perturbedDynamicsStateVector{};
+
+	// Perturb one state at a time
+	for (std::size_t j = 0; j < n; j++) {
+		const double delta = epsilon * std::max(std::fabs(stateVector[j]), 1.0);
+		perturbedStateVector[j] = stateVector[j] + delta;
+		function(perturbedStateVector, controlVector, outputFunction(perturbedStateVector), parameterList, dynamicsType, perturbedDynamicsStateVector);
+		for (std::size_t i = 0; i < n; i++) {
+			jacobian[i][j] = (perturbedDynamicsStateVector[i] - dynamicsStateVector[i]) / delta;
+		}
+		perturbedStateVector[j] = stateVector[j];
+	}
+}
+
+
+// Helper functions for calculateStep()
+/**
+ * Solves the stage equation Z = offset + hGamma*f(Z) with Newton iterations
+ *
+ * @param	stageOffset : the explicit part of the stage equation
+ * @param	hGamma : the implicit weight (gamma * h) of the stage equation
+ * @param	stageStateVector : initial guess of the stage; overwritten by the solution
+ * @return	A type (bool) which is true if the iterations converged within the maximum number of iterations
+ */
+template <typename Function, typename OutputFunction, typename JacobianFunction, typename State, typename Control, typename Parameters>
+bool ImplicitRungeKuttaNumericalIntegration::calculateStage(Function&& function, OutputFunction&& outputFunction, JacobianFunction&& jacobianFunction, const State& stageOffset,
+															double hGamma, const Control& controlVector, const Parameters& parameterList, bool dynamicsType, State& stageStateVector)
+{
+	// Initialize variables
+	constexpr std::size_t n = std::tuple_size<State>::value;
+	std::array<State, n> matrix{};			// Jacobian, then (I - hGamma*J) and its LU decomposition
+	std::array<std::size_t, n> pivots{};	// Row permutation of LU decomposition
+	State dynamicsStateVector{}, increment{};
+
+	for (int iteration = 0; iteration < m_maximumNewtonIterations; iteration++) {
+		m_newtonIterations++;
+
+		// Residual --> -(Z - offset - hGamma*f(Z))
+		function(stageStateVector, controlVector, outputFunction(stageStateVector), parameterList, dynamicsType, dynamicsStateVector);
+		for (std::size_t i = 0; i < n; i++) {
+			increment[i] = -(stageStateVector[i] - stageOffset[i] - hGamma * dynamicsStateVector[i]);
+		}
+
+		// Newton matrix --> I - hGamma*J(Z)
+		jacobianFunction(stageStateVector, dynamicsStateVector, matrix);
+		for (std::size_t i = 0; i < n; i++) {
+			for (std::size_t j = 0; j < n; j++) {
+				matrix[i][j] = ((i == j) ? 1.0 : 0.0) - hGamma * matrix[i][j];
+			}
+		}
+
+		// Solve for and apply increment
+		calculateLUDecomposition<State>(matrix, pivots);
+		calculateLUSolution<State>(matrix, pivots, increment);
+
+		double incrementNorm = 0, stateNorm = 0;
+		for (std::size_t i = 0; i < n; i++) {
+			stageStateVector[i] += increment[i];
+			incrementNorm = std::max(incrementNorm, std::fabs(increment[i]));
+			stateNorm = std::max(stateNorm, std::fabs(stageStateVector[i]));
+		}
+
+		// Converged
+		if (incrementNorm <= m_newtonTolerance * (1 + stateNorm)) {
+			return true;
+		}
+	}
+
+	// Not converged (or no iterations allowed)
+	return false;
+}
+
+/**
+ * Decomposes a square matrix in-place into LU-form using Gaussian elimination with partial pivoting
+ *
+ * @param	matrix : matrix (row-major) to decompose; overwritten by its L (below diagonal) and U factors
+ * @param	pivots : the row swaps that were applied
+ */
+template <typename State>
+void ImplicitRungeKuttaNumericalIntegration::calculateLUDecomposition(std::array<State, std::tuple_size<State>::value>& matrix, std::array<std::size_t, std::tuple_size<State>::value>& pivots) {
+	// Initialize variables
+	constexpr std::size_t n = std::tuple_size<State>::value;
+
+	for (std::size_t k = 0; k < n; k++) {
+		// Find pivot
+		std::size_t pivot = k;
+		for (std::size_t i = k + 1; i < n; i++) {
+			if (std::fabs(matrix[i][k]) > std::fabs(matrix[pivot][k])) { pivot = i; }
+		}
+		pivots[k] = pivot;
+		if (pivot != k) { std::swap(matrix[pivot], matrix[k]); }
+
+		// Skip singular column
+		if (matrix[k][k] == 0) {
+			continue;
+		}
+
+		// Eliminate
+		for (std::size_t i = k + 1; i < n; i++) {
+			matrix[i][k] /= matrix[k][k];
+			for (std::size_t j = k + 1; j < n; j++) {
+				matrix[i][j] -= matrix[i][k] * matrix[k][j];
+			}
+		}
+	}
+}
+
+/**
+ * Solves LU * x = b in-place for a decomposition made by calculateLUDecomposition()
+ *
+ * @param	matrix : LU decomposition
+ * @param	pivots : the row swaps of the decomposition
+ * @param	vector : right-hand side b; overwritten by the solution x
+ */
+template <typename State>
+void ImplicitRungeKuttaNumericalIntegration::calculateLUSolution(const std::array<State, std::tuple_size<State>::value>& matrix, const std::array<std::size_t, std::tuple_size<State>::value>& pivots, State& vector) {
+	// Initialize variables
+	constexpr std::size_t n = std::tuple_size<State>::value;
+
+	// Apply row swaps
+	for (std::size_t k = 0; k < n; k++) {
+		if (pivots[k] != k) { std::swap(vector[k], vector[pivots[k]]); }
+	}
+
+	// Forward substitution (L has unit diagonal)
+	for (std::size_t k = 0; k < n; k++) {
+		for (std::size_t i = k + 1; i < n; i++) {
+			vector[i] -= matrix[i][k] * vector[k];
+		}
+	}
+
+	// Backward substitution
+	for (std::size_t k = n; k-- > 0; ) {
+		for (std::size_t j = k + 1; j < n; j++) {
+			vector[k] -= matrix[k][j] * vector[j];
+		}
+		if (matrix[k][k] != 0) { vector[k] /= matrix[k][k]; }
+	}
+}
+
+
+// [END]: Prevent multiple inclusions of header
+#endif
\ No newline at end of file
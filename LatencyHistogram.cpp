@@ -0,0 +1,149 @@
+//==============================================================
+// Filename : LatencyHistogram.cpp
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class for a lock-free histogram of latencies
+//				 in [ns] with logarithmic bins, recorded from
+//				 several threads while being read - source
+//==============================================================
+
+// Libraries
+#include "LatencyHistogram.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+
+// Getters (histogram)
+std::uint64_t LatencyHistogram::getMinimum() const {
+	return (getCount() == 0) ? 0 : m_minimum.load(std::memory_order_relaxed);
+}
+
+double LatencyHistogram::getMean() const {
+	const std::uint64_t count = getCount();
+	return (count == 0) ? 0 : double(m_sum.load(std::memory_order_relaxed)) / double(count);
+}
+
+
+// Getters (quantiles)
+/**
+ * Estimates a quantile as the middle of the bin holding its rank (exact below 32 ns, within 1 / 32 of the value
+ * above). Read while other threads add, the estimate reflects the values added so far, give or take the ones in flight.
+ *
+ * @param	probability : the probability of the quantile, in [0, 1] (0.5 --> median, 1 --> maximum)
+ * @return	A (std::uint64_t) which is the estimated quantile, between the minimum and the maximum; zero for an empty histogram
+ */
+std::uint64_t LatencyHistogram::getQuantile(double probability) const {
+	// Initialize variables
+	const std::uint64_t count = getCount();
+	if (count == 0) {
+		return 0;
+	}
+	const std::uint64_t rank = std::max<std::uint64_t>(1, std::uint64_t(std::ceil(std::clamp(probability, 0.0, 1.0) * double(count))));
+	const std::uint64_t maximum = getMaximum();
+	if (rank >= count) {
+		return maximum;
+	}
+
+	// Bin holding the rank
+	std::uint64_t cumulativeCount = 0;
+	for (std::size_t bin = 0; bin < numberOfBins; bin++) {
+		cumulativeCount += m_counts[bin].load(std::memory_order_relaxed);
+		if (cumulativeCount >= rank) {
+			return std::clamp(getBinLowerBound(bin) + getBinWidth(bin) / 2, std::min(getMinimum(), maximum), maximum);
+		}
+	}
+
+	// Rank counted, but its bin not yet (add() in flight)
+	return maximum;
+}
+
+/**
+ * Formats the quantiles in [us], for reports
+ *
+ * @return	A (std::string) which is "p50 .., p99 .., p99.9 .., max .." followed by a newline; "-" for an empty histogram
+ */
+std::string LatencyHistogram::formatQuantiles() const {
+	if (getCount() == 0) {
+		return "-\n";
+	}
+
+	char line[128];
+	std::snprintf(line, sizeof(line), "p50 %.1f, p99 %.1f, p99.9 %.1f, max %.1f\n", double(getQuantile(0.5)) / 1e3,
+				  double(getQuantile(0.99)) / 1e3, double(getQuantile(0.999)) / 1e3, double(getMaximum()) / 1e3);
+	return line;
+}
+
+
+// Other
+/**
+ * Adds a value to its bin; wait-free apart from the minimum and maximum, which are updated with a compare-and-swap
+ * only when the value is a new extreme
+ *
+ * @param	value : the value to add, e.g. a latency in [ns]
+ */
+void LatencyHistogram::add(std::uint64_t value) {
+	m_counts[toBin(value)].fetch_add(1, std::memory_order_relaxed);
+	m_sum.fetch_add(value, std::memory_order_relaxed);
+
+	std::uint64_t extreme = m_minimum.load(std::memory_order_relaxed);
+	while (value < extreme && !m_minimum.compare_exchange_weak(extreme, value, std::memory_order_relaxed)) {}
+	extreme = m_maximum.load(std::memory_order_relaxed);
+	while (value > extreme && !m_maximum.compare_exchange_weak(extreme, value, std::memory_order_relaxed)) {}
+
+	m_count.fetch_add(1, std::memory_order_relaxed); // Last, such that a reader never sees more values than binned
+}
+
+/**
+ * Adds the values of another histogram, e.g. to combine the histograms of several hops or runs
+ *
+ * @param	other : the histogram to add
+ */
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+	for (std::size_t bin = 0; bin < numberOfBins; bin++) {
+		const std::uint64_t count = other.m_counts[bin].load(std::memory_order_relaxed);
+		if (count > 0) {
+			m_counts[bin].fetch_add(count, std::memory_order_relaxed);
+		}
+	}
+	m_sum.fetch_add(other.m_sum.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+	const std::uint64_t minimum = other.m_minimum.load(std::memory_order_relaxed);
+	std::uint64_t extreme = m_minimum.load(std::memory_order_relaxed);
+	while (minimum < extreme && !m_minimum.compare_exchange_weak(extreme, minimum, std::memory_order_relaxed)) {}
+	const std::uint64_t maximum = other.m_maximum.load(std::memory_order_relaxed);
+	extreme = m_maximum.load(std::memory_order_relaxed);
+	while (maximum > extreme && !m_maximum.compare_exchange_weak(extreme, maximum, std::memory_order_relaxed)) {}
+
+	m_count.fetch_add(other.getCount(), std::memory_order_relaxed);
+}
+
+
+// Bins
+/**
+ * Retrieves the bin of a value: values below 2 * numberOfSubBins have a bin each; above, every power of two is split
+ * into numberOfSubBins bins by the bits following the leading one
+ *
+ * @param	value : the value
+ * @return	A (std::size_t) which is the index of the bin
+ */
+std::size_t LatencyHistogram::toBin(std::uint64_t value) {
+	if (value < 2 * numberOfSubBins) {
+		return std::size_t(value);
+	}
+	const unsigned exponent = 63 - unsigned(__builtin_clzll(value)); // At least 5
+	return (exponent - 3) * numberOfSubBins + std::size_t((value >> (exponent - 4)) & (numberOfSubBins - 1));
+}
+
+std::uint64_t LatencyHistogram::getBinLowerBound(std::size_t bin) {
+	if (bin < 2 * numberOfSubBins) {
+		return bin;
+	}
+	const unsigned exponent = unsigned(bin / numberOfSubBins) + 3;
+	return (numberOfSubBins + bin % numberOfSubBins) << (exponent - 4);
+}
+
+std::uint64_t LatencyHistogram::getBinWidth(std::size_t bin) {
+	return (bin < 2 * numberOfSubBins) ? 1 : std::uint64_t(1) << (bin / numberOfSubBins - 1);
+}
\ No newline at end of file
@@ -0,0 +1,67 @@
+//==============================================================
+// Filename : LatencyHistogram.h
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class for a lock-free histogram of latencies
+//				 in [ns] with logarithmic bins, recorded from
+//				 several threads while being read - header
+//==============================================================
+
+// [BEGIN]: Prevent multiple inclusions of header
+#ifndef LATENCYHISTOGRAM_H
+#define LATENCYHISTOGRAM_H
+
+
+// Libraries
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// LatencyHistogram-class
+class LatencyHistogram {
+public:
+	// Constructor (default)
+	LatencyHistogram() = default;
+
+	// Not copyable (atomic counters)
+	LatencyHistogram(const LatencyHistogram&) = delete;
+	LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+
+	// Getters (histogram)
+	std::uint64_t getCount() const { return m_count.load(std::memory_order_relaxed); }
+	std::uint64_t getMinimum() const; // 0 for an empty histogram
+	std::uint64_t getMaximum() const { return m_maximum.load(std::memory_order_relaxed); }
+	double getMean() const;
+
+	// Getters (quantiles)
+	std::uint64_t getQuantile(double) const;
+	std::string formatQuantiles() const;
+
+
+	// Other
+	void add(std::uint64_t);
+	void merge(const LatencyHistogram&);
+
+	// Bins (public for testing): exact below 2 * numberOfSubBins, then numberOfSubBins bins per power of two
+	static constexpr std::size_t numberOfSubBins = 16; // Bin width at most 1 / 16 of the value
+	static constexpr std::size_t numberOfBins = (64 - 3) * numberOfSubBins;
+	static std::size_t toBin(std::uint64_t);
+	static std::uint64_t getBinLowerBound(std::size_t);
+	static std::uint64_t getBinWidth(std::size_t);
+
+private:
+	// Attributes (histogram); only updated with atomic operations, such that add() never blocks
+	std::array<std::atomic<std::uint64_t>, numberOfBins> m_counts{};
+	std::atomic<std::uint64_t> m_count{ 0 };
+	std::atomic<std::uint64_t> m_sum{ 0 };
+	std::atomic<std::uint64_t> m_minimum{ UINT64_MAX };
+	std::atomic<std::uint64_t> m_maximum{ 0 };
+};
+
+
+// [END]: Prevent multiple inclusions of header
+#endif
\ No newline at end of file
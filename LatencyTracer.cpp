@@ -0,0 +1,153 @@
+//==============================================================
+// Filename : LatencyTracer.cpp
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class to trace the latency of the messages
+//				 arriving at a node over one hop of the loop
+//				 (simulator, buffers, controller), with a report
+//				 per hop - source
+//==============================================================
+
+// Libraries
+#include "LatencyTracer.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+
+// Constructor
+/**
+ * Creates a tracer without records
+ *
+ * @param	hopName : name of the hop in the report, e.g. "buffer_hrt_srt --> controller (state)"
+ * @param	deadline : maximum duration of a callback in [s] (e.g. the period of its timer); 0 --> no deadline
+ */
+LatencyTracer::LatencyTracer(const std::string& hopName, double deadline)
+	: m_hopName(hopName), m_deadline(std::int64_t(deadline * 1e9)) {}
+
+
+// Other (recording)
+/**
+ * Retrieves the time the stamps are expressed in
+ *
+ * @return	A (std::int64_t) which is the time of the steady clock in [ns]
+ */
+std::int64_t LatencyTracer::now() {
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * Records the arrival of a message: its transit over the hop, its age, and the samples lost before it (a gap in the
+ * sequence of the publisher). Calls for one input are expected from one thread at a time, as from one subscription.
+ *
+ * @param	stamp : stamp of the message; zero fields are skipped (e.g. an unstamped input)
+ * @param	receiveTime : time of arrival in [ns] (see now())
+ */
+void LatencyTracer::recordReceive(const MessageStamp& stamp, std::int64_t receiveTime) {
+	m_numberOfMessages.fetch_add(1, std::memory_order_relaxed);
+
+	if (stamp.publishTime != 0) {
+		m_transit.add(std::uint64_t(std::max<std::int64_t>(receiveTime - stamp.publishTime, 0)));
+	}
+	if (stamp.originTime != 0) {
+		m_age.add(std::uint64_t(std::max<std::int64_t>(receiveTime - stamp.originTime, 0)));
+	}
+
+	// Lost samples; a lower sequence is a restarted publisher
+	if (stamp.sequence != 0) {
+		const std::uint64_t lastSequence = m_lastSequence.exchange(stamp.sequence, std::memory_order_relaxed);
+		if (lastSequence != 0 && stamp.sequence > lastSequence + 1) {
+			m_numberOfLostSamples.fetch_add(stamp.sequence - lastSequence - 1, std::memory_order_relaxed);
+		}
+	}
+}
+
+/**
+ * Records that a received message left the node (forwarded by a buffer, or used for an output of the node)
+ *
+ * @param	receiveTime : time of arrival of the message in [ns]
+ * @param	publishTime : time of publishing in [ns]
+ */
+void LatencyTracer::recordPublish(std::int64_t receiveTime, std::int64_t publishTime) {
+	m_residence.add(std::uint64_t(std::max<std::int64_t>(publishTime - receiveTime, 0)));
+}
+
+/**
+ * Records the duration of a callback; longer than the deadline counts as an overrun
+ *
+ * @param	startTime : start of the callback in [ns]
+ * @param	endTime : end of the callback in [ns]
+ */
+void LatencyTracer::recordProcess(std::int64_t startTime, std::int64_t endTime) {
+	const std::int64_t duration = std::max<std::int64_t>(endTime - startTime, 0);
+	m_process.add(std::uint64_t(duration));
+	if (m_deadline > 0 && duration > m_deadline) {
+		m_numberOfDeadlineOverruns.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+/**
+ * Records samples discarded by the node itself, e.g. on a full buffer
+ *
+ * @param	numberOfSamples : number of samples discarded
+ */
+void LatencyTracer::recordDrop(std::uint64_t numberOfSamples) {
+	m_numberOfDroppedSamples.fetch_add(numberOfSamples, std::memory_order_relaxed);
+}
+
+
+// Other (report)
+/**
+ * Formats the counters and the latency quantiles of the hop, e.g.
+ *   buffer_hrt_srt --> controller (state): 1000 messages, 0 lost, 0 dropped, 0 deadline overruns
+ *     transit [us]   : p50 12.1, p99 40.3, p99.9 75.2, max 81.0
+ *     ...
+ *
+ * @return	A (std::string) which is the report of the hop, ending with a newline
+ */
+std::string LatencyTracer::formatReport() const {
+	char line[256];
+	std::snprintf(line, sizeof(line), "%s: %llu messages, %llu lost, %llu dropped, %llu deadline overruns\n", m_hopName.c_str(),
+				  (unsigned long long)getNumberOfMessages(), (unsigned long long)getNumberOfLostSamples(),
+				  (unsigned long long)getNumberOfDroppedSamples(), (unsigned long long)getNumberOfDeadlineOverruns());
+
+	return std::string(line)
+		+ "  transit [us]   : " + m_transit.formatQuantiles()
+		+ "  residence [us] : " + m_residence.formatQuantiles()
+		+ "  process [us]   : " + m_process.formatQuantiles()
+		+ "  age [us]       : " + m_age.formatQuantiles();
+}
+
+/**
+ * Formats the report of the hops of a loop in order (e.g. simulator --> buffer_hrt_srt --> controller -->
+ * buffer_srt_hrt --> simulator), followed by the breakdown of the loop latency: the median transit and residence
+ * of each hop, and the age at the last hop (origin of the loop --> its end)
+ *
+ * @param	hops : tracers of the hops, in the order of the loop
+ * @return	A (std::string) which is the report, ending with a newline
+ */
+std::string LatencyTracer::formatReport(const std::vector<const LatencyTracer*>& hops) {
+	// Initialize variables
+	std::string report;
+	std::string breakdown = "loop [us]        :";
+	std::uint64_t sumOfMedians = 0;
+	char part[64];
+
+	// Hops
+	for (const LatencyTracer* hop : hops) {
+		report += hop->formatReport();
+
+		const std::uint64_t median = hop->m_transit.getQuantile(0.5) + hop->m_residence.getQuantile(0.5);
+		std::snprintf(part, sizeof(part), " %s%.1f", (hop == hops.front()) ? "" : "+ ", double(median) / 1e3);
+		breakdown += part;
+		sumOfMedians += median;
+	}
+
+	// Loop
+	if (!hops.empty()) {
+		std::snprintf(part, sizeof(part), " = %.1f (sum of medians)\n", double(sumOfMedians) / 1e3);
+		report += breakdown + part + "loop age [us]    : " + hops.back()->m_age.formatQuantiles();
+	}
+	return report;
+}
\ No newline at end of file
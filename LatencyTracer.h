@@ -0,0 +1,92 @@
+//==============================================================
+// Filename : LatencyTracer.h
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class to trace the latency of the messages
+//				 arriving at a node over one hop of the loop
+//				 (simulator, buffers, controller), with a report
+//				 per hop - header
+//==============================================================
+
+// [BEGIN]: Prevent multiple inclusions of header
+#ifndef LATENCYTRACER_H
+#define LATENCYTRACER_H
+
+
+// Libraries
+#include "LatencyHistogram.h"
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Stamp of a message, with the fields of the stamped messages of dynamic_system_vectors (e.g. StateStamped.msg);
+// times in [ns] of the steady clock, which is shared by the processes of one host. Zero fields are not traced.
+struct MessageStamp {
+	std::uint64_t sequence = 0;		// Per publisher, counting from 1; a gap is a lost sample
+	std::int64_t originTime = 0;	// Time the data of the message originated (for the loop: the state of the simulator)
+	std::int64_t publishTime = 0;	// Time the last hop published the message
+};
+
+// LatencyTracer-class; one per input of a node, recorded by its callbacks from any thread
+class LatencyTracer {
+public:
+	// Constructor (with arguments)
+	explicit LatencyTracer(const std::string& hopName = "", double deadline = 0);
+
+	// Not copyable (atomic counters)
+	LatencyTracer(const LatencyTracer&) = delete;
+	LatencyTracer& operator=(const LatencyTracer&) = delete;
+
+
+	// Getters (settings)
+	const std::string& getHopName() const { return m_hopName; }
+	double getDeadline() const { return m_deadline; }
+
+	// Getters (histograms); latencies in [ns]
+	const LatencyHistogram& getTransitHistogram() const { return m_transit; }		// Publish of the previous hop --> receive
+	const LatencyHistogram& getResidenceHistogram() const { return m_residence; }	// Receive --> publish by this node
+	const LatencyHistogram& getProcessHistogram() const { return m_process; }		// Duration of the callback
+	const LatencyHistogram& getAgeHistogram() const { return m_age; }				// Origin --> receive
+
+	// Getters (counters)
+	std::uint64_t getNumberOfMessages() const { return m_numberOfMessages.load(std::memory_order_relaxed); }
+	std::uint64_t getNumberOfLostSamples() const { return m_numberOfLostSamples.load(std::memory_order_relaxed); }
+	std::uint64_t getNumberOfDroppedSamples() const { return m_numberOfDroppedSamples.load(std::memory_order_relaxed); }
+	std::uint64_t getNumberOfDeadlineOverruns() const { return m_numberOfDeadlineOverruns.load(std::memory_order_relaxed); }
+
+
+	// Other (recording)
+	static std::int64_t now();
+	void recordReceive(const MessageStamp&, std::int64_t);
+	void recordPublish(std::int64_t, std::int64_t);
+	void recordProcess(std::int64_t, std::int64_t);
+	void recordDrop(std::uint64_t = 1);
+
+	// Other (report)
+	std::string formatReport() const;
+	static std::string formatReport(const std::vector<const LatencyTracer*>&);
+
+private:
+	// Attributes (settings)
+	std::string m_hopName;
+	std::int64_t m_deadline;	// [ns]; 0 --> no deadline
+
+	// Attributes (histograms)
+	LatencyHistogram m_transit;
+	LatencyHistogram m_residence;
+	LatencyHistogram m_process;
+	LatencyHistogram m_age;
+
+	// Attributes (counters)
+	std::atomic<std::uint64_t> m_lastSequence{ 0 };
+	std::atomic<std::uint64_t> m_numberOfMessages{ 0 };
+	std::atomic<std::uint64_t> m_numberOfLostSamples{ 0 };
+	std::atomic<std::uint64_t> m_numberOfDroppedSamples{ 0 };
+	std::atomic<std::uint64_t> m_numberOfDeadlineOverruns{ 0 };
+};
+
+
+// [END]: Prevent multiple inclusions of header
+#endif
\ No newline at end of file
@@ -0,0 +1,292 @@
+//==============================================================
+// Filename : MonteCarloRunner.cpp
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class to run many closed-loop simulations of
+//				 the drone with cargo for randomly drawn
+//				 parameters, and aggregate their metrics - source
+//==============================================================
+
+// Libraries
+#include "MonteCarloRunner.h"
+#include "DroneRopeCargoSimulator.h"
+#include "DroneControllerControlVector.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+
+// Constructor
+MonteCarloRunner::MonteCarloRunner(const MonteCarloScenario& scenario, const MonteCarloParameterDistributions& distributions)
+	: m_scenario(scenario) {
+	// Set attributes
+	setDistributions(distributions);
+}
+
+
+// Setters (settings)
+void MonteCarloRunner::setScenario(const MonteCarloScenario& scenario) {
+	m_scenario = scenario;
+}
+
+/**
+ * Sets the distributions of the parameters drawn per run. Masses, stiffness, damping, drag constants and time
+ * constants have to be positive, so the distributions are ignored if any of them can draw a value that is not (see
+ * isPositive()).
+ *
+ * @param	distributions : the distributions of the parameters
+ * @return	A type (bool) which is true if the distributions are set
+ */
+bool MonteCarloRunner::setDistributions(const MonteCarloParameterDistributions& distributions) {
+	// Check distributions
+	const ParameterDistribution* parameterDistributions[] = { &distributions.massCargo, &distributions.ropeStiffness, &distributions.ropeDamping,
+															  &distributions.dragConstantDrone, &distributions.dragConstantCargo,
+															  &distributions.timeConstantX, &distributions.timeConstantY, &distributions.timeConstantTheta };
+	for (const ParameterDistribution* distribution : parameterDistributions) {
+		if (!isPositive(*distribution)) {
+			return false;
+		}
+	}
+
+	// Set distributions
+	m_distributions = distributions;
+	return true;
+}
+
+/**
+ * Sets the upper bounds of the histograms the quantiles are estimated from (see HistogramQuantileSketch). The
+ * settling time is binned up to the duration of the scenario.
+ *
+ * @param	peakSwingAngle : upper bound of the peak swing angle [rad]
+ * @param	peakRopeForce : upper bound of the peak rope force [N]
+ */
+void MonteCarloRunner::setQuantileUpperBounds(double peakSwingAngle, double peakRopeForce) {
+	m_peakSwingAngleUpperBound = peakSwingAngle;
+	m_peakRopeForceUpperBound = peakRopeForce;
+}
+
+void MonteCarloRunner::setNumberOfBins(std::size_t numberOfBins) {
+	m_numberOfBins = numberOfBins;
+}
+
+
+// Other
+/**
+ * Simulates the runs 0 to numberOfRuns - 1 on the workers of the thread pool and aggregates their metrics without
+ * storing them. The runs are grouped in blocks of a fixed size; the statistics of a block are updated in the order
+ * of its runs and the blocks are merged in their order, while the histograms hold integer counts. The result is
+ * therefore bitwise identical for any number of workers.
+ *
+ * @param	numberOfRuns : number of runs to simulate
+ * @param	seed : seed of the Monte-Carlo run; the parameters of a run follow from the seed and its index
+ * @param	threadPool : the workers to simulate on
+ * @return	A (MonteCarloResult) with the statistics and quantile estimates of the metrics of the (non-diverged) runs
+ */
+MonteCarloResult MonteCarloRunner::run(std::size_t numberOfRuns, std::uint64_t seed, WorkStealingThreadPool& threadPool) const {
+	// Statistics per block
+	struct BlockStatistics {
+		RunningStatistics peakSwingAngle, settlingTime, peakRopeForce;
+		std::size_t numberOfDivergedRuns = 0;
+	};
+	const std::size_t numberOfBlocks = (numberOfRuns + runsPerBlock - 1) / runsPerBlock;
+	std::vector<BlockStatistics> blockStatistics(numberOfBlocks);
+
+	// Histograms per worker
+	std::vector<MonteCarloResult> workerResults(threadPool.getNumberOfWorkers(), createEmptyResult());
+
+	// Simulate
+	threadPool.parallelFor(numberOfBlocks, [&](std::size_t block, std::size_t worker) {
+		BlockStatistics& statistics = blockStatistics[block];
+		MonteCarloResult& workerResult = workerResults[worker];
+
+		for (std::size_t runIndex = block * runsPerBlock; runIndex < std::min((block + 1) * runsPerBlock, numberOfRuns); runIndex++) {
+			const MonteCarloRunMetrics metrics = simulateRun(runIndex, seed);
+			if (metrics.diverged) {
+				statistics.numberOfDivergedRuns++;
+				continue;
+			}
+
+			statistics.peakSwingAngle.add(metrics.peakSwingAngle);
+			statistics.settlingTime.add(metrics.settlingTime);
+			statistics.peakRopeForce.add(metrics.peakRopeForce);
+			workerResult.peakSwingAngle.quantiles.add(metrics.peakSwingAngle);
+			workerResult.settlingTime.quantiles.add(metrics.settlingTime);
+			workerResult.peakRopeForce.quantiles.add(metrics.peakRopeForce);
+		}
+	});
+
+	// Merge (blocks in order)
+	MonteCarloResult result = createEmptyResult();
+	result.numberOfRuns = numberOfRuns;
+	for (const BlockStatistics& statistics : blockStatistics) {
+		result.numberOfDivergedRuns += statistics.numberOfDivergedRuns;
+		result.peakSwingAngle.statistics.merge(statistics.peakSwingAngle);
+		result.settlingTime.statistics.merge(statistics.settlingTime);
+		result.peakRopeForce.statistics.merge(statistics.peakRopeForce);
+	}
+	for (const MonteCarloResult& workerResult : workerResults) {
+		result.peakSwingAngle.quantiles.merge(workerResult.peakSwingAngle.quantiles);
+		result.settlingTime.quantiles.merge(workerResult.settlingTime.quantiles);
+		result.peakRopeForce.quantiles.merge(workerResult.peakRopeForce.quantiles);
+	}
+
+	return result;
+}
+
+/**
+ * Simulates a single run: draws its parameters, lets the drone with cargo hover at rest and flies the scenario in
+ * closed loop with DroneControllerControlVector (one control vector per time step). The metrics are updated per
+ * step; the trajectory is not stored.
+ *
+ * @param	runIndex : index of the run
+ * @param	seed : seed of the Monte-Carlo run
+ * @return	A (MonteCarloRunMetrics) with the metrics of the run
+ */
+MonteCarloRunMetrics MonteCarloRunner::simulateRun(std::size_t runIndex, std::uint64_t seed) const {
+	// Draw parameters (fixed order)
+	SplitMix64 generator{ calculateRunSeed(seed, runIndex) };
+	const double massCargo = drawParameter(m_distributions.massCargo, generator);
+	const double ropeStiffness = drawParameter(m_distributions.ropeStiffness, generator);
+	const double ropeDamping = drawParameter(m_distributions.ropeDamping, generator);
+	const double dragConstantDrone = drawParameter(m_distributions.dragConstantDrone, generator);
+	const double dragConstantCargo = drawParameter(m_distributions.dragConstantCargo, generator);
+	const double timeConstantX = drawParameter(m_distributions.timeConstantX, generator);
+	const double timeConstantY = drawParameter(m_distributions.timeConstantY, generator);
+	const double timeConstantTheta = drawParameter(m_distributions.timeConstantTheta, generator);
+
+	// Simulator
+	DroneRopeCargoSimulator simulator;
+	simulator.setConstantDroneParameters(m_scenario.massDrone, dragConstantDrone);
+	simulator.setConstantRopeParameters(m_scenario.ropeLengthInitial, ropeStiffness, ropeDamping);
+	simulator.setConstantCargoParameters(massCargo, dragConstantCargo);
+	simulator.setImplementation(true, m_scenario.integrationType);
+
+	const DynamicSystemParameters& parameters = simulator.getParameters();
+	const double gravitationalConstant = parameters.gravitationalConstant;
+
+	// Hover with the cargo hanging at rest (rope stretched by the weight of the cargo)
+	StateArray stateVector = { 0, 0, 0, 0, 0, 0, -(m_scenario.ropeLengthInitial + massCargo * gravitationalConstant / ropeStiffness), 0, 0 };
+	simulator.setStateArray(stateVector);
+
+	// Controller
+	DroneControllerControlVector controller(timeConstantX, timeConstantY, timeConstantTheta, m_scenario.oscillationDampingConstant);
+	controller.setVelocityVector({ m_scenario.referenceVelocity[0], m_scenario.referenceVelocity[1] });
+
+	// Simulate
+	MonteCarloRunMetrics metrics;
+	const long numberOfSteps = std::lround(m_scenario.duration / simulator.getTimeStep());
+	const long numberOfManeuverSteps = std::lround(m_scenario.maneuverDuration / simulator.getTimeStep());
+
+	for (long step = 0; step < numberOfSteps; step++) {
+		// Stop after the maneuver
+		if (step == numberOfManeuverSteps) {
+			controller.setVelocityVector({ 0, 0 });
+		}
+
+		// Control vector and step
+		const std::vector<double> controlVector = controller.calculateReferenceControlVector(true, gravitationalConstant,
+																							  m_scenario.massDrone, stateVector[0], stateVector[3], stateVector[1], stateVector[4], stateVector[2],
+																							  massCargo, stateVector[5], stateVector[6]);
+		simulator.simulationStep(ControlArray{ controlVector[0], controlVector[1] }, stateVector);
+
+		// Diverged
+		double sum = 0;
+		for (double state : stateVector) {
+			sum += state;
+		}
+		if (!std::isfinite(sum)) {
+			metrics.diverged = true;
+			break;
+		}
+
+		// Metrics
+		const double swingAngle = std::abs(std::atan2(stateVector[5] - stateVector[0], stateVector[1] - stateVector[6])); // Zero hanging straight down
+		metrics.peakSwingAngle = std::max(metrics.peakSwingAngle, swingAngle);
+		if (swingAngle > m_scenario.settlingAngle) {
+			metrics.settlingTime = simulator.getSimulationTime();
+		}
+		metrics.peakRopeForce = std::max(metrics.peakRopeForce, DroneRopeCargoDynamics::calculateRopeSwitchingFunction(stateVector, parameters)); // Slack --> zero
+	}
+
+	return metrics;
+}
+
+/**
+ * Computes the seed of a run (see SplitMix64::calculateStreamSeed()); it only depends on the seed and the index of the
+ * run, not on the worker that simulates it
+ *
+ * @param	seed : seed of the Monte-Carlo run
+ * @param	runIndex : index of the run
+ * @return	A (std::uint64_t) which is the seed of the run
+ */
+std::uint64_t MonteCarloRunner::calculateRunSeed(std::uint64_t seed, std::size_t runIndex) {
+	return SplitMix64::calculateStreamSeed(seed, runIndex);
+}
+
+/**
+ * Checks whether a distribution only draws positive values: a positive constant, bounds 0 < first <= second for the
+ * (log-)uniform distribution and a positive mean with a non-negative standard deviation for the normal distribution,
+ * whose draws are truncated to positive values
+ *
+ * @param	distribution : the distribution of a parameter
+ * @return	A type (bool) which is true if every drawn value is positive
+ */
+bool MonteCarloRunner::isPositive(const ParameterDistribution& distribution) {
+	switch (distribution.type) {
+	case DistributionType::Uniform:
+	case DistributionType::LogUniform:
+		return (distribution.first > 0) && (distribution.second >= distribution.first) && std::isfinite(distribution.second);
+	case DistributionType::Normal:
+		return (distribution.first > 0) && std::isfinite(distribution.first) && (distribution.second >= 0) && std::isfinite(distribution.second);
+	default: // Constant
+		return (distribution.first > 0) && std::isfinite(distribution.first);
+	}
+}
+
+
+/**
+ * Draws a parameter from its distribution; computed here (Box-Muller for the normal distribution) rather than with
+ * the standard library distributions, whose results differ between implementations. Normal draws that are not
+ * positive are redrawn (truncated normal distribution), as the parameters are physical magnitudes.
+ *
+ * @param	distribution : the distribution of the parameter
+ * @param	generator : random number generator of the run
+ * @return	A (double) which is the drawn value
+ */
+double MonteCarloRunner::drawParameter(const ParameterDistribution& distribution, SplitMix64& generator) {
+	switch (distribution.type) {
+	case DistributionType::Uniform:
+		return distribution.first + (distribution.second - distribution.first) * generator.nextUniform();
+	case DistributionType::LogUniform:
+		return distribution.first * std::exp(generator.nextUniform() * std::log(distribution.second / distribution.first));
+	case DistributionType::Normal: {
+		for (int draw = 0; draw < maximumNumberOfRedraws; draw++) {
+			const double uniformFirst = 1 - generator.nextUniform(); // In (0, 1]
+			const double uniformSecond = generator.nextUniform();
+			const double value = distribution.first + distribution.second * std::sqrt(-2 * std::log(uniformFirst)) * std::cos(6.283185307179586 * uniformSecond);
+			if (value > 0) {
+				return value;
+			}
+		}
+		return distribution.first; // Positive mean (see isPositive())
+	}
+	default: // Constant
+		return distribution.first;
+	}
+}
+
+
+// Helper functions for run()
+/**
+ * Creates a result without runs, with the histograms of the metrics set up
+ *
+ * @return	A (MonteCarloResult) with empty statistics and histograms
+ */
+MonteCarloResult MonteCarloRunner::createEmptyResult() const {
+	MonteCarloResult result;
+	result.peakSwingAngle.quantiles = HistogramQuantileSketch(0, m_peakSwingAngleUpperBound, m_numberOfBins);
+	result.settlingTime.quantiles = HistogramQuantileSketch(0, m_scenario.duration, m_numberOfBins);
+	result.peakRopeForce.quantiles = HistogramQuantileSketch(0, m_peakRopeForceUpperBound, m_numberOfBins);
+	return result;
+}
\ No newline at end of file
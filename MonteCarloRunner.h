@@ -0,0 +1,138 @@
+//==============================================================
+// Filename : MonteCarloRunner.h
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class to run many closed-loop simulations of
+//				 the drone with cargo for randomly drawn
+//				 parameters, and aggregate their metrics - header
+//==============================================================
+
+// [BEGIN]: Prevent multiple inclusions of header
+#ifndef MONTECARLORUNNER_H
+#define MONTECARLORUNNER_H
+
+
+// Libraries
+#include "WorkStealingThreadPool.h"
+#include "RunningStatistics.h"
+#include "HistogramQuantileSketch.h"
+#include "SplitMix64.h"
+#include "NumericalIntegrationMethods.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// Distribution of a parameter over the runs
+enum class DistributionType {
+	Constant,	// first
+	Uniform,	// Between first and second
+	LogUniform,	// Between first and second (> 0), uniform in the logarithm
+	Normal		// Mean first, standard deviation second; truncated to positive values (redrawn)
+};
+
+struct ParameterDistribution {
+	DistributionType type = DistributionType::Constant;
+	double first = 0;
+	double second = 0;
+};
+
+// Parameters drawn per run; all of them have to be positive
+struct MonteCarloParameterDistributions {
+	ParameterDistribution massCargo{ DistributionType::Constant, 2 };			// [kg]
+	ParameterDistribution ropeStiffness{ DistributionType::Constant, 1000 };	// [N / m]
+	ParameterDistribution ropeDamping{ DistributionType::Constant, 10 };		// [N s / m]
+	ParameterDistribution dragConstantDrone{ DistributionType::Constant, 0.1 };	// [N s^2 / m^2]
+	ParameterDistribution dragConstantCargo{ DistributionType::Constant, 0.1 };	// [N s^2 / m^2]
+	ParameterDistribution timeConstantX{ DistributionType::Constant, 0.5 };		// [s]
+	ParameterDistribution timeConstantY{ DistributionType::Constant, 0.5 };		// [s]
+	ParameterDistribution timeConstantTheta{ DistributionType::Constant, 0.1 };	// [s]
+};
+
+// Closed-loop scenario, equal for all runs: the drone hovers with the cargo hanging at rest, follows the reference
+// velocity during the maneuver and is commanded to stop afterwards
+struct MonteCarloScenario {
+	IntegrationType integrationType = IntegrationType::RungeKuttaFourStageOutput;
+	double massDrone = 3;						// [kg]
+	double ropeLengthInitial = 1.5;				// [m]
+	double oscillationDampingConstant = 20;		// [N / m] (see DroneControllerForce)
+	std::array<double, 2> referenceVelocity{ 1, 0 };	// [m / s]
+	double maneuverDuration = 2;				// [s]
+	double duration = 10;						// [s]
+	double settlingAngle = 0.05;				// [rad]; swing angle the cargo has to stay below to be settled
+};
+
+// Metrics of a run
+struct MonteCarloRunMetrics {
+	double peakSwingAngle = 0;		// Largest angle of the rope w.r.t. the vertical [rad]
+	double settlingTime = 0;		// Time after which the swing angle stays below the settling angle [s]
+	double peakRopeForce = 0;		// [N]
+	bool diverged = false;			// Non-finite state; the run is not part of the statistics
+};
+
+// Aggregate of a metric over the runs
+struct MonteCarloMetricStatistics {
+	RunningStatistics statistics;
+	HistogramQuantileSketch quantiles;
+};
+
+// Result of a Monte-Carlo run
+struct MonteCarloResult {
+	std::size_t numberOfRuns = 0;
+	std::size_t numberOfDivergedRuns = 0;
+	MonteCarloMetricStatistics peakSwingAngle;
+	MonteCarloMetricStatistics settlingTime;
+	MonteCarloMetricStatistics peakRopeForce;
+};
+
+// MonteCarloRunner-class
+class MonteCarloRunner {
+public:
+	// Constructor (default)
+	MonteCarloRunner() = default;
+
+	// Constructor (with arguments)
+	MonteCarloRunner(const MonteCarloScenario& scenario, const MonteCarloParameterDistributions& distributions);
+
+
+	// Getters (settings)
+	const MonteCarloScenario& getScenario() const { return m_scenario; }
+	const MonteCarloParameterDistributions& getDistributions() const { return m_distributions; }
+	std::size_t getNumberOfBins() const { return m_numberOfBins; }
+
+
+	// Setters (settings)
+	void setScenario(const MonteCarloScenario&);
+	bool setDistributions(const MonteCarloParameterDistributions&); // Ignored if a distribution can draw a non-positive value
+	void setQuantileUpperBounds(double peakSwingAngle, double peakRopeForce); // Lower bounds zero, settling time up to the duration
+	void setNumberOfBins(std::size_t);
+
+
+	// Other
+	MonteCarloResult run(std::size_t, std::uint64_t, WorkStealingThreadPool&) const;
+	MonteCarloRunMetrics simulateRun(std::size_t, std::uint64_t) const; // A single run, reproducible from its index
+	static std::uint64_t calculateRunSeed(std::uint64_t, std::size_t);
+	static bool isPositive(const ParameterDistribution&); // Only draws positive values
+	static double drawParameter(const ParameterDistribution&, SplitMix64&);
+
+private:
+	// Runs per task; fixes the order of merging the statistics independently of the number of workers
+	static constexpr std::size_t runsPerBlock = 64;
+
+	// Redraws of a truncated normal distribution before falling back to its mean (at least half of the draws are positive)
+	static constexpr int maximumNumberOfRedraws = 64;
+
+	// Attributes (settings)
+	MonteCarloScenario m_scenario;
+	MonteCarloParameterDistributions m_distributions;
+	double m_peakSwingAngleUpperBound = 1.5707963267948966;	// [rad]
+	double m_peakRopeForceUpperBound = 1000;					// [N]
+	std::size_t m_numberOfBins = 1000;
+
+	// Helper functions for run()
+	MonteCarloResult createEmptyResult() const;
+};
+
+
+// [END]: Prevent multiple inclusions of header
+#endif
\ No newline at end of file
@@ -0,0 +1,59 @@
+//==============================================================
+// Filename : MultiRateNumericalIntegration.cpp
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class for multi-rate numerical integration, 
+//				 substepping the fast part of a system - source
+//==============================================================
+
+// Libraries
+#include "MultiRateNumericalIntegration.h"
+
+// Constructor
+MultiRateNumericalIntegration::MultiRateNumericalIntegration(double timeStep, int substeps) : NumericalIntegrationProperties(timeStep) {
+	// Set attributes
+	setSubsteps(substeps);
+}
+
+
+// Getters (substeps)
+/**
+ * Retrieves the number of substeps the next step is divided into: either the fixed number set by the user,
+ * or (automatic) the smallest number of substeps that keeps the substep within the fast time step
+ *
+ * @return	A type (int) which is the number of substeps (at least one)
+ */
+int MultiRateNumericalIntegration::getNumberOfSubsteps() const {
+	// Fixed number of substeps
+	if (m_substeps > 0) {
+		return m_substeps;
+	}
+
+	// Automatic (one substep if the fast time step is not known)
+	if (m_fastTimeStep <= 0) {
+		return 1;
+	}
+	return std::max(1, int(std::ceil(getTimeStep() / m_fastTimeStep)));
+}
+
+
+// Setters (substeps)
+/**
+ *	Sets the number of substeps per step
+ *
+ *	@param	substeps : number of substeps; zero --> chosen automatically from the fast time step
+ */
+void MultiRateNumericalIntegration::setSubsteps(int substeps) {
+	m_substeps = std::max(0, substeps);
+}
+
+/**
+ *	Sets the largest substep at which the fast part is integrated accurately and stably;
+ *	used when the number of substeps is chosen automatically
+ *
+ *	@param	fastTimeStep : the fast time step [s]
+ */
+void MultiRateNumericalIntegration::setFastTimeStep(double fastTimeStep) {
+	m_fastTimeStep = fastTimeStep;
+}
\ No newline at end of file
@@ -0,0 +1,121 @@
+//==============================================================
+// Filename : MultiRateNumericalIntegration.h
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class for multi-rate numerical integration, 
+//				 substepping the fast part of a system - header
+//==============================================================
+
+// [BEGIN]: Prevent multiple inclusions of header
+#ifndef MULTIRATENUMERICALINTEGRATION_H
+#define MULTIRATENUMERICALINTEGRATION_H
+
+
+// Libraries
+#include "NumericalIntegrationProperties.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+// MultiRateNumericalIntegration-class
+class MultiRateNumericalIntegration : public virtual NumericalIntegrationProperties {
+public:
+	// Constructor (default)
+	MultiRateNumericalIntegration() = default;
+
+	// Constructor (with arguments)
+	MultiRateNumericalIntegration(double timeStep, int substeps);
+
+
+	// Getters (substeps)
+	int getSubsteps() const { return m_substeps; } // Zero --> automatic
+	double getFastTimeStep() const { return m_fastTimeStep; }
+	int getNumberOfSubsteps() const; // Used by the next step
+
+
+	// Setters (substeps)
+	void setSubsteps(int);
+	void setFastTimeStep(double);
+
+
+	// Calculate (step)
+	template <typename SlowFunction, typename FastFunction, typename OutputFunction, typename State, typename Control, typename Parameters>
+	void calculateStep(SlowFunction&&, FastFunction&&, OutputFunction&&, const State&, const Control&, const Parameters&, bool, State&);
+
+private:
+	// Attributes (substeps)
+	int m_substeps = 0;			// Fixed number of substeps; zero --> chosen from the fast time step
+	double m_fastTimeStep = 0;	// Largest time step of the fast part; zero --> not known (one substep)
+};
+
+
+// Calculate (step)
+/**
+ * Computes the integration of a system whose derivative is split into a slow and a fast part:
+ *
+ *		xDot = fSlow(x) + fFast(x)
+ *
+ * The slow part is evaluated once, at the start of the step, and held constant. The fast part is integrated with
+ * getNumberOfSubsteps() RK4-substeps within the step, with the output vector recomputed at every stage. Only the
+ * (cheap) fast part is evaluated at the fine time scale.
+ *
+ * @param	slowFunction : the slow part of the derivative function --> [ f(x,u,y,P,n,xDot) ] format
+ * @param	fastFunction : the fast part of the derivative function --> [ f(x,u,y,P,n,xDot) ] format
+ * @param	outputFunction : computes the output vector from a state vector --> [ y = g(x) ] format
+ * @param	stateVector : the current state vector of the system
+ * @param	controlVector : the current control vector
+ * @param	parametersList : array containing all necessary parameters to compute the derivative equation
+ * @param	dynamicsType : specifies the dynamics type to be used of the system
+ * @param	nextStateVector : array the integrated result of the derivative function is written to (may alias stateVector)
+ */
+template <typename SlowFunction, typename FastFunction, typename OutputFunction, typename State, typename Control, typename Parameters>
+void MultiRateNumericalIntegration::calculateStep(SlowFunction&& slowFunction, FastFunction&& fastFunction, OutputFunction&& outputFunction, const State& stateVector,
+												  const Control& controlVector, const Parameters& parameterList, bool dynamicsType, State& nextStateVector)
+{
+	// Initialize variables
+	State slowDynamicsStateVector{};	// Frozen slow part
+	State K1{}, K2{}, K3{}, K4{};		// K's of RK4-substep (fast part only)
+	State x = stateVector;				// Substep state
+	State stateVectorK{};				// Used for f(x + K)
+	const int numberOfSubsteps = getNumberOfSubsteps();
+	const double timeStep = getTimeStep() / numberOfSubsteps;
+	const std::size_t n = x.size();
+
+	// Slow part (once per step)
+	slowFunction(stateVector, controlVector, outputFunction(stateVector), parameterList, dynamicsType, slowDynamicsStateVector);
+
+	// Fast part (RK4 per substep)
+	for (int substep = 0; substep < numberOfSubsteps; substep++) {
+		// Compute K1
+		fastFunction(x, controlVector, outputFunction(x), parameterList, dynamicsType, K1);
+		for (std::size_t i = 0; i < n; i++) { K1[i] += slowDynamicsStateVector[i]; }
+
+		// Compute K2 --> f(x + [K1 * (h/2)])
+		for (std::size_t i = 0; i < n; i++) { stateVectorK[i] = x[i] + K1[i] * (timeStep / 2); }
+		fastFunction(stateVectorK, controlVector, outputFunction(stateVectorK), parameterList, dynamicsType, K2);
+		for (std::size_t i = 0; i < n; i++) { K2[i] += slowDynamicsStateVector[i]; }
+
+		// Compute K3 --> f(x + [K2 * (h/2)])
+		for (std::size_t i = 0; i < n; i++) { stateVectorK[i] = x[i] + K2[i] * (timeStep / 2); }
+		fastFunction(stateVectorK, controlVector, outputFunction(stateVectorK), parameterList, dynamicsType, K3);
+		for (std::size_t i = 0; i < n; i++) { K3[i] += slowDynamicsStateVector[i]; }
+
+		// Compute K4 --> f(x + [K3 * h])
+		for (std::size_t i = 0; i < n; i++) { stateVectorK[i] = x[i] + K3[i] * timeStep; }
+		fastFunction(stateVectorK, controlVector, outputFunction(stateVectorK), parameterList, dynamicsType, K4);
+		for (std::size_t i = 0; i < n; i++) { K4[i] += slowDynamicsStateVector[i]; }
+
+		// Sum to construct substep state vector
+		for (std::size_t i = 0; i < n; i++) {
+			x[i] = x[i] + K1[i] * (timeStep / 6) + K2[i] * (timeStep / 3) + K3[i] * (timeStep / 3) + K4[i] * (timeStep / 6);
+		}
+	}
+
+	// Construct final state vector
+	nextStateVector = x;
+}
+
+
+// [END]: Prevent multiple inclusions of header
+#endif
\ No newline at end of file
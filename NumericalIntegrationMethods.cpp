@@ -10,6 +10,10 @@
 
 // Libraries
 #include "NumericalIntegrationMethods.h"
+#include "EulerNumericalIntegration.h"
+#include "RungeKuttaFourNumericalIntegration.h"
+#include "DynamicSystemArrays.h"
+#include <algorithm>
 
 
 // Constructor
@@ -21,6 +25,10 @@ NumericalIntegrationMethods::NumericalIntegrationMethods(double timeStep, double
 
 // Setters
 void NumericalIntegrationMethods::setIntegrationType(bool integrationType) {
+	m_integrationType = integrationType ? IntegrationType::RungeKuttaFour : IntegrationType::Euler;
+}
+
+void NumericalIntegrationMethods::setIntegrationType(IntegrationType integrationType) {
 	m_integrationType = integrationType;
 }
 
@@ -44,12 +52,40 @@ std::vector<double> NumericalIntegrationMethods::calculateNextState(std::functio
 	// Initialize variables
 	std::vector<double> nextStateVector;
 
-	// Choose integration type based on specified bool value
-	if (getIntegrationType() == false) { // Euler-case
-		nextStateVector = EulerNumericalIntegration::calculateStep(function, stateVector, controlVector, outputVector, parameterList, dynamicsType);
+	// Choose integration type based on specified value (Euler and RK4 for state vectors of any size, not saving dense output)
+	if (getIntegrationType() == IntegrationType::Euler) { // Euler-case
+		nextStateVector = EulerNumericalIntegration(getTimeStep()).calculateStep(function, stateVector, controlVector, outputVector, parameterList, dynamicsType);
+	}
+	else if ((getIntegrationType() == IntegrationType::RungeKuttaFour) || (getIntegrationType() == IntegrationType::RungeKuttaFourStageOutput)) { // Runge Kutta 4-case (no output function: output vector is constant)
+		nextStateVector = RungeKuttaFourNumericalIntegration(getTimeStep()).calculateStep(function, stateVector, controlVector, outputVector, parameterList, dynamicsType);
 	}
-	else if (getIntegrationType() == true) { // Runge Kutta 4-case
-		nextStateVector = RungeKuttaFourNumericalIntegration::calculateStep(function, stateVector, controlVector, outputVector, parameterList, dynamicsType);
+	else { // Implicit Runge-Kutta/multi-rate/Adams-Bashforth-Moulton/Butcher-tableau-case (works on the fixed-size state of the drone + cargo system)
+		// Copy vectors into arrays
+		StateArray stateArray{}, nextStateArray{};
+		std::copy_n(stateVector.begin(), stateArray.size(), stateArray.begin());
+
+		// Wrap vector-based derivative function; output vector is constant over the step
+		auto arrayFunction = [&](const StateArray& x, const std::vector<double>& u, const std::vector<double>& y, const std::vector<double>& P, bool n, StateArray& xDot) {
+			std::vector<double> dynamicsStateVector = function(std::vector<double>(x.begin(), x.end()), u, y, P, n);
+			std::copy_n(dynamicsStateVector.begin(), xDot.size(), xDot.begin());
+		};
+		auto outputFunction = [&outputVector](const StateArray&) { return outputVector; };
+
+		// Integrate
+		if (getIntegrationType() == IntegrationType::ImplicitRungeKutta) {
+			ImplicitRungeKuttaNumericalIntegration::calculateStep(arrayFunction, outputFunction, stateArray, controlVector, parameterList, dynamicsType, nextStateArray);
+		}
+		else if (getIntegrationType() == IntegrationType::MultiRate) { // No slow/fast split given: the whole derivative is substepped
+			auto zeroFunction = [](const StateArray&, const std::vector<double>&, const std::vector<double>&, const std::vector<double>&, bool, StateArray& xDot) { xDot = {}; };
+			MultiRateNumericalIntegration::calculateStep(zeroFunction, arrayFunction, outputFunction, stateArray, controlVector, parameterList, dynamicsType, nextStateArray);
+		}
+		else if (getIntegrationType() == IntegrationType::AdamsBashforthMoulton) {
+			AdamsBashforthMoultonNumericalIntegration::calculateStep(arrayFunction, outputFunction, stateArray, controlVector, parameterList, dynamicsType, nextStateArray);
+		}
+		else { // Butcher-tableau methods
+			calculateNextState(arrayFunction, outputFunction, stateArray, controlVector, outputVector, parameterList, dynamicsType, nextStateArray);
+		}
+		nextStateVector.assign(nextStateArray.begin(), nextStateArray.end());
 	}
 
 	// Return next state vector
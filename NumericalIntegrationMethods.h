@@ -13,11 +13,58 @@
 
 
 // Libraries
-#include "RungeKuttaFourNumericalIntegration.h"
-#include "EulerNumericalIntegration.h"
+#include "DormandPrinceNumericalIntegration.h"
+#include "ImplicitRungeKuttaNumericalIntegration.h"
+#include "MultiRateNumericalIntegration.h"
+#include "AdamsBashforthMoultonNumericalIntegration.h"
+#include "EventDetectionNumericalIntegration.h"
+#include "ExplicitRungeKuttaNumericalIntegration.h"
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+// Available (fixed-step) integration types
+enum class IntegrationType {
+	Euler,						// Explicit Euler
+	RungeKuttaFour,				// Explicit Runge-Kutta 4
+	RungeKuttaFourStageOutput,	// Explicit Runge-Kutta 4, output vector recomputed at every stage
+	ImplicitRungeKutta,			// Implicit Runge-Kutta (SDIRK2), for stiff ropes
+	MultiRate,					// Slow part once per step, fast part with RK4-substeps
+	AdamsBashforthMoulton,		// Adams-Bashforth-Moulton 4 (PECE), two evaluations per step
+	Heun,						// Explicit Runge-Kutta 2 (Heun), output vector recomputed at every stage
+	RungeKuttaThree,			// Explicit Runge-Kutta 3 (Kutta), output vector recomputed at every stage
+	RungeKuttaFourThreeEighths,	// Explicit Runge-Kutta 4 (3/8-rule), output vector recomputed at every stage
+	StrongStabilityPreservingRungeKuttaThree	// Explicit SSP Runge-Kutta 3 (Shu-Osher), output vector recomputed at every stage
+};
+
+// Explicit Runge-Kutta integration types: Butcher tableau, and whether the output vector is recomputed at every stage
+template <IntegrationType Type, const auto& Tableau, bool StageOutput>
+struct ExplicitRungeKuttaIntegrator {
+	static constexpr IntegrationType integrationType = Type;
+	static constexpr const auto& tableau = Tableau;
+	static constexpr bool stageOutput = StageOutput;		// Output vector recomputed at every stage (otherwise constant over the step)
+
+	// Time step with cargo (rope of 40000 N/m): Euler 0.0005 s, Heun 0.005 s (unstable above ~0.012 s), RK3/RK4 0.01 s (unstable above ~0.015 s)
+	static constexpr std::size_t numberOfStages = std::decay_t<decltype(Tableau)>::numberOfStages;
+	static constexpr double timeStepWithCargo = (numberOfStages == 1) ? 0.0005 : (numberOfStages == 2) ? 0.005 : 0.01;
+};
+
+using EulerIntegrator = ExplicitRungeKuttaIntegrator<IntegrationType::Euler, ButcherTableaux::euler, false>;
+using RungeKuttaFourIntegrator = ExplicitRungeKuttaIntegrator<IntegrationType::RungeKuttaFour, ButcherTableaux::rungeKuttaFour, false>;
+using RungeKuttaFourStageOutputIntegrator = ExplicitRungeKuttaIntegrator<IntegrationType::RungeKuttaFourStageOutput, ButcherTableaux::rungeKuttaFour, true>;
+using HeunIntegrator = ExplicitRungeKuttaIntegrator<IntegrationType::Heun, ButcherTableaux::heun, true>;
+using RungeKuttaThreeIntegrator = ExplicitRungeKuttaIntegrator<IntegrationType::RungeKuttaThree, ButcherTableaux::rungeKuttaThree, true>;
+using RungeKuttaFourThreeEighthsIntegrator = ExplicitRungeKuttaIntegrator<IntegrationType::RungeKuttaFourThreeEighths, ButcherTableaux::rungeKuttaFourThreeEighths, true>;
+using StrongStabilityPreservingRungeKuttaThreeIntegrator = ExplicitRungeKuttaIntegrator<IntegrationType::StrongStabilityPreservingRungeKuttaThree, ButcherTableaux::strongStabilityPreservingRungeKuttaThree, true>;
+
+// All explicit Runge-Kutta integration types (extend this list when adding a Butcher tableau)
+using ExplicitRungeKuttaIntegrators = std::tuple<EulerIntegrator, RungeKuttaFourIntegrator, RungeKuttaFourStageOutputIntegrator, HeunIntegrator, RungeKuttaThreeIntegrator,
+												 RungeKuttaFourThreeEighthsIntegrator, StrongStabilityPreservingRungeKuttaThreeIntegrator>;
 
 // NumericalIntegrationBase-class
-class NumericalIntegrationMethods : public RungeKuttaFourNumericalIntegration,  public EulerNumericalIntegration {
+class NumericalIntegrationMethods : public DormandPrinceNumericalIntegration, public ImplicitRungeKuttaNumericalIntegration, public MultiRateNumericalIntegration,
+									public AdamsBashforthMoultonNumericalIntegration, public EventDetectionNumericalIntegration, public ExplicitRungeKuttaNumericalIntegration {
 public:
 	// Constructor (default)
 	NumericalIntegrationMethods() = default;
@@ -26,21 +73,152 @@ public:
 	NumericalIntegrationMethods(double timeStep, double integrationType);
 
 	// Getters
-	bool getIntegrationType() { return m_integrationType; }
+	IntegrationType getIntegrationType() const { return m_integrationType; }
 
 	// Setters
-	void setIntegrationType(bool);
+	void setIntegrationType(bool); // false --> Euler, true --> RK4
+	void setIntegrationType(IntegrationType);
 
 	// Calculate
 	std::vector<double> calculateNextState(std::function<std::vector<double>(std::vector<double>, std::vector<double>, std::vector<double>, std::vector<double>, bool)>, 
 										   std::vector<double>, std::vector<double>, std::vector<double>, 
 										   std::vector<double>, bool);
 
+	// Calculate (fixed-size, allocation-free)
+	template <typename Function, typename State, typename Control, typename Output, typename Parameters>
+	void calculateNextState(Function&&, const State&, const Control&, const Output&, const Parameters&, bool, State&);
+	template <typename Function, typename OutputFunction, typename State, typename Control, typename Output, typename Parameters>
+	void calculateNextState(Function&&, OutputFunction&&, const State&, const Control&, const Output&, const Parameters&, bool, State&);
+	template <typename Function, typename OutputFunction, typename JacobianFunction, typename State, typename Control, typename Output, typename Parameters>
+	void calculateNextState(Function&&, OutputFunction&&, JacobianFunction&&, const State&, const Control&, const Output&, const Parameters&, bool, State&);
+
+	// Other
+	template <typename Body>
+	static bool visitExplicitRungeKuttaIntegrator(IntegrationType, Body&&); // false --> not an explicit Runge-Kutta type
+
 private:
 	// Attributes
-	bool m_integrationType;
+	IntegrationType m_integrationType = IntegrationType::Euler;
 };
 
 
+// Calculate (fixed-size, allocation-free)
+/**
+ * Computes the integration of the derivative function using the integration type specified by the user.
+ * Works on fixed-size arrays passed by reference, such that a step does not allocate. The output vector
+ * is held constant over the step.
+ *
+ * @param	function : the derivative function --> this function must adhere a [ f(x,u,y,P,n,xDot) ] format
+ * @param	stateVector : the current state vector of the system
+ * @param	controlVector : the current control vector
+ * @param	outputVector : the current output vector of the system
+ * @param	parametersList : array containing all necessary parameters to compute the derivative equation
+ * @param	dynamicsType : specifies the dynamics type to be used of the system
+ * @param	nextStateVector : array the integrated result of the derivative function is written to
+ */
+template <typename Function, typename State, typename Control, typename Output, typename Parameters>
+void NumericalIntegrationMethods::calculateNextState(Function&& function, const State& stateVector, const Control& controlVector, const Output& outputVector,
+													 const Parameters& parameterList, bool dynamicsType, State& nextStateVector)
+{
+	// Output vector is constant over the step
+	auto outputFunction = [&outputVector](const State&) { return outputVector; };
+
+	// Integrate
+	calculateNextState(function, outputFunction, stateVector, controlVector, outputVector, parameterList, dynamicsType, nextStateVector);
+}
+
+/**
+ * Computes the integration of the derivative function using the integration type specified by the user.
+ * Integration types that evaluate the derivative away from the current state (RK4 with stage output, implicit Runge-Kutta,
+ * multi-rate, Adams-Bashforth-Moulton) recompute the output vector from that state with the output function. The Jacobian
+ * of implicit Runge-Kutta is approximated by finite differences.
+ *
+ * @param	function : the derivative function --> this function must adhere a [ f(x,u,y,P,n,xDot) ] format
+ * @param	outputFunction : computes the output vector from a state vector --> [ y = g(x) ] format
+ * @param	stateVector : the current state vector of the system
+ * @param	controlVector : the current control vector
+ * @param	outputVector : the current output vector of the system
+ * @param	parametersList : array containing all necessary parameters to compute the derivative equation
+ * @param	dynamicsType : specifies the dynamics type to be used of the system
+ * @param	nextStateVector : array the integrated result of the derivative function is written to
+ */
+template <typename Function, typename OutputFunction, typename State, typename Control, typename Output, typename Parameters>
+void NumericalIntegrationMethods::calculateNextState(Function&& function, OutputFunction&& outputFunction, const State& stateVector, const Control& controlVector, const Output& outputVector,
+													 const Parameters& parameterList, bool dynamicsType, State& nextStateVector)
+{
+	// Jacobian by finite differences
+	auto jacobianFunction = [&](const State& x, const State& xDot, std::array<State, std::tuple_size<State>::value>& jacobian) {
+		ImplicitRungeKuttaNumericalIntegration::calculateJacobianFiniteDifference(function, outputFunction, x, xDot, controlVector, parameterList, dynamicsType, jacobian);
+	};
+
+	// Integrate
+	calculateNextState(function, outputFunction, jacobianFunction, stateVector, controlVector, outputVector, parameterList, dynamicsType, nextStateVector);
+}
+
+/**
+ * Computes the integration of the derivative function using the integration type specified by the user.
+ * Integration types that evaluate the derivative away from the current state (RK4 with stage output, implicit Runge-Kutta,
+ * multi-rate, Adams-Bashforth-Moulton, the Butcher-tableau methods) recompute the output vector from that state with the
+ * output function; implicit Runge-Kutta uses the given (e.g. analytic) Jacobian.
+ *
+ * @param	function : the derivative function --> this function must adhere a [ f(x,u,y,P,n,xDot) ] format
+ * @param	outputFunction : computes the output vector from a state vector --> [ y = g(x) ] format
+ * @param	jacobianFunction : computes the Jacobian df/dx at a state --> [ J(x,xDot,jacobian) ] format
+ * @param	stateVector : the current state vector of the system
+ * @param	controlVector : the current control vector
+ * @param	outputVector : the current output vector of the system
+ * @param	parametersList : array containing all necessary parameters to compute the derivative equation
+ * @param	dynamicsType : specifies the dynamics type to be used of the system
+ * @param	nextStateVector : array the integrated result of the derivative function is written to
+ */
+template <typename Function, typename OutputFunction, typename JacobianFunction, typename State, typename Control, typename Output, typename Parameters>
+void NumericalIntegrationMethods::calculateNextState(Function&& function, OutputFunction&& outputFunction, JacobianFunction&& jacobianFunction, const State& stateVector,
+													 const Control& controlVector, const Output& outputVector, const Parameters& parameterList, bool dynamicsType, State& nextStateVector)
+{
+	// Choose integration type based on specified value
+	switch (getIntegrationType()) {
+	case IntegrationType::ImplicitRungeKutta:		// Implicit Runge-Kutta-case
+		ImplicitRungeKuttaNumericalIntegration::calculateStep(function, outputFunction, jacobianFunction, stateVector, controlVector, parameterList, dynamicsType, nextStateVector);
+		break;
+	case IntegrationType::MultiRate:		// Multi-rate-case (no slow/fast split given: the whole derivative is substepped)
+		MultiRateNumericalIntegration::calculateStep([](const State&, const Control&, const Output&, const Parameters&, bool, State& dynamicsStateVector) { dynamicsStateVector = {}; },
+													 function, outputFunction, stateVector, controlVector, parameterList, dynamicsType, nextStateVector);
+		break;
+	case IntegrationType::AdamsBashforthMoulton:	// Adams-Bashforth-Moulton-case
+		AdamsBashforthMoultonNumericalIntegration::calculateStep(function, outputFunction, stateVector, controlVector, parameterList, dynamicsType, nextStateVector);
+		break;
+	default:								// Explicit Runge-Kutta-cases (Euler, RK4, Heun, ...: Butcher tableau, see ExplicitRungeKuttaIntegrators)
+		visitExplicitRungeKuttaIntegrator(getIntegrationType(), [&](auto integrator) {
+			using Integrator = decltype(integrator);
+			if constexpr (Integrator::stageOutput) {
+				ExplicitRungeKuttaNumericalIntegration::calculateStep<Integrator::tableau>(function, outputFunction, stateVector, controlVector, parameterList, dynamicsType, nextStateVector);
+			}
+			else {
+				ExplicitRungeKuttaNumericalIntegration::calculateStep<Integrator::tableau>(function, stateVector, controlVector, outputVector, parameterList, dynamicsType, nextStateVector);
+			}
+		});
+		break;
+	}
+}
+
+
+// Other
+/**
+ * Calls a function with the explicit Runge-Kutta integrator (see ExplicitRungeKuttaIntegrator) of an integration type,
+ * such that the Butcher tableau is known at compile time without a branch per tableau
+ *
+ * @param	integrationType : the integration type
+ * @param	body : the function to call --> [ body(Integrator{}) ] format
+ * @return	A type (bool) which is false if the integration type is not an explicit Runge-Kutta type (body not called)
+ */
+template <typename Body>
+bool NumericalIntegrationMethods::visitExplicitRungeKuttaIntegrator(IntegrationType integrationType, Body&& body)
+{
+	return std::apply([&](auto... integrators) {
+		return (((integrationType == decltype(integrators)::integrationType) && (body(integrators), true)) || ...);
+	}, ExplicitRungeKuttaIntegrators{});
+}
+
+
 // [END]: Prevent multiple inclusions of header
 #endif
\ No newline at end of file
@@ -0,0 +1,228 @@
+//==============================================================
+// Filename : RealTimeLoop.cpp
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class to run a step function periodically on a
+//				 dedicated thread, paced to absolute release
+//				 times, with CPU pinning, real-time scheduling,
+//				 locked memory and a jitter histogram - source
+//==============================================================
+
+// Libraries
+#include "RealTimeLoop.h"
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <ctime>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+
+// Time of the monotonic clock in [ns] (the clock of the release times)
+static std::int64_t monotonicTime() {
+	std::timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return std::int64_t(time.tv_sec) * 1000000000 + time.tv_nsec;
+}
+
+
+// Destructor
+RealTimeLoop::~RealTimeLoop() {
+	stop();
+}
+
+
+// Setters (settings)
+/**
+ * Sets the settings of the loop, applied by the next start()
+ *
+ * @param	settings : the settings (see RealTimeSettings)
+ * @return	A type (bool) which is false if the loop is running (settings unchanged)
+ */
+bool RealTimeLoop::setSettings(const RealTimeSettings& settings) {
+	if (isRunning() || m_thread.joinable()) {
+		return false;
+	}
+	m_settings = settings;
+	return true;
+}
+
+
+// Other
+/**
+ * Starts the thread of the loop. The thread first applies the settings (pinning and scheduling; see isPinned() and
+ * isRealTimeScheduled(), as these need privileges), then calls the step function at every release: one period after
+ * the start, two periods after, and so on. Releases are absolute times, such that the duration of a step and the
+ * wake-up latency do not accumulate into a drift of the cadence.
+ *
+ * @param	step : function called at every release; returns false to end the loop
+ * @return	A type (bool) which is false if the loop is already running
+ */
+bool RealTimeLoop::start(const StepFunction& step) {
+	if (isRunning()) {
+		return false;
+	}
+	if (m_thread.joinable()) {
+		m_thread.join(); // Ended by its step function
+	}
+
+	// Lock the memory of the process, now and for later allocations
+	m_memoryLocked = m_settings.lockMemory && (mlockall(MCL_CURRENT | MCL_FUTURE) == 0);
+
+	// Start the thread, and wait until it has applied its settings
+	std::atomic<int> ready{ 0 };
+	m_step = step;
+	m_running.store(true, std::memory_order_release);
+	m_thread = std::thread(&RealTimeLoop::run, this, std::ref(ready));
+	while (ready.load(std::memory_order_acquire) == 0) {
+		std::this_thread::yield();
+	}
+	return true;
+}
+
+/**
+ * Stops the loop after the current step and waits for its thread; not to be called from the step function (which
+ * returns false instead)
+ */
+void RealTimeLoop::stop() {
+	m_running.store(false, std::memory_order_release);
+	if (m_thread.joinable()) {
+		m_thread.join();
+	}
+}
+
+/**
+ * Waits until the step function ends the loop (returns false)
+ */
+void RealTimeLoop::wait() {
+	if (m_thread.joinable()) {
+		m_thread.join();
+	}
+}
+
+/**
+ * Formats the settings as applied, the counters and the quantiles of the jitter and of the execution time, e.g.
+ *   period 1000.0 us, cpu 2 (pinned), SCHED_FIFO 80, memory locked, skip: 5000 steps, 1 overruns, 2 missed periods
+ *     jitter [us]    : p50 3.1, p99 12.4, p99.9 30.2, max 41.0
+ *     execution [us] : ...
+ *
+ * @return	A (std::string) which is the report, ending with a newline
+ */
+std::string RealTimeLoop::formatReport() const {
+	// Initialize variables
+	const char* policyNames[] = { "skip", "catch up", "restart" };
+	char scheduling[64];
+	if (m_settings.priority <= 0) {
+		std::snprintf(scheduling, sizeof(scheduling), "SCHED_OTHER");
+	} else {
+		std::snprintf(scheduling, sizeof(scheduling), m_realTimeScheduled ? "SCHED_FIFO %d" : "SCHED_OTHER (SCHED_FIFO %d not permitted)", m_settings.priority);
+	}
+
+	char line[320];
+	std::snprintf(line, sizeof(line), "period %.1f us, cpu %d (%s), %s, memory %s, %s: %llu steps, %llu overruns, %llu missed periods\n",
+				  m_settings.period * 1e6, m_settings.cpu, m_pinned ? "pinned" : "not pinned", scheduling,
+				  m_memoryLocked ? "locked" : "not locked", policyNames[int(m_settings.catchUpPolicy)],
+				  (unsigned long long)getNumberOfSteps(), (unsigned long long)getNumberOfOverruns(), (unsigned long long)getNumberOfMissedPeriods());
+
+	return std::string(line)
+		+ "  jitter [us]    : " + m_jitter.formatQuantiles()
+		+ "  execution [us] : " + m_execution.formatQuantiles();
+}
+
+
+// Helper functions for start()
+/**
+ * Loop of the thread: sleeps until the release (clock_nanosleep with an absolute time), steps, and determines the next
+ * release. A step ending past the next release is an overrun; the releases it passed are handled by the catch-up policy.
+ * With CatchUp, the steps of the passed releases end late as well; they belong to the same overrun, which counts once.
+ *
+ * @param	ready : set once the settings are applied and the first release is known
+ */
+void RealTimeLoop::run(std::atomic<int>& ready) {
+	// Initialize variables
+	applyThreadSettings();
+	const std::int64_t period = std::max<std::int64_t>(1, std::llround(m_settings.period * 1e9));
+	std::int64_t release = monotonicTime() + period;
+	bool catchingUp = false; // Stepping releases passed by an overrun; these steps end late, but are not overruns themselves
+	ready.store(1, std::memory_order_release);
+
+	while (m_running.load(std::memory_order_acquire)) {
+		// Sleep until the release
+		const std::timespec releaseTime = { std::time_t(release / 1000000000), long(release % 1000000000) };
+		while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &releaseTime, nullptr) == EINTR) {}
+
+		// Step
+		const std::int64_t startTime = monotonicTime();
+		const bool proceed = m_step();
+		const std::int64_t endTime = monotonicTime();
+		m_jitter.add(std::uint64_t(std::max<std::int64_t>(startTime - release, 0)));
+		m_execution.add(std::uint64_t(std::max<std::int64_t>(endTime - startTime, 0)));
+		m_numberOfSteps.fetch_add(1, std::memory_order_relaxed);
+		if (!proceed) {
+			m_running.store(false, std::memory_order_release);
+			break;
+		}
+
+		// Next release; on an overrun, the releases passed (the next one included) are skipped, stepped late or dropped
+		release += period;
+		const bool late = (endTime > release);
+		if (late && !catchingUp) {
+			m_numberOfOverruns.fetch_add(1, std::memory_order_relaxed);
+		}
+		catchingUp = late && (m_settings.catchUpPolicy == CatchUpPolicy::CatchUp);
+		if (late) {
+			const std::int64_t passedReleases = (endTime - release) / period + 1;
+
+			switch (m_settings.catchUpPolicy) {
+			case CatchUpPolicy::Skip:
+				m_numberOfMissedPeriods.fetch_add(std::uint64_t(passedReleases), std::memory_order_relaxed);
+				release += passedReleases * period;
+				break;
+			case CatchUpPolicy::CatchUp:
+				if (passedReleases > std::int64_t(m_settings.maximumCatchUp)) {
+					const std::int64_t skippedReleases = passedReleases - std::int64_t(m_settings.maximumCatchUp);
+					m_numberOfMissedPeriods.fetch_add(std::uint64_t(skippedReleases), std::memory_order_relaxed);
+					release += skippedReleases * period;
+				}
+				break;
+			case CatchUpPolicy::Restart:
+				m_numberOfMissedPeriods.fetch_add(std::uint64_t(passedReleases), std::memory_order_relaxed);
+				release = endTime + period;
+				break;
+			}
+		}
+	}
+}
+
+/**
+ * Applies the settings of the calling thread (the loop): CPU affinity and SCHED_FIFO priority. With locked memory,
+ * the stack the loop may use is touched once, such that it is resident before the first release.
+ */
+void RealTimeLoop::applyThreadSettings() {
+	// Pinning
+	m_pinned = false;
+	if (m_settings.cpu >= 0 && m_settings.cpu < CPU_SETSIZE) {
+		cpu_set_t cpuSet;
+		CPU_ZERO(&cpuSet);
+		CPU_SET(m_settings.cpu, &cpuSet);
+		m_pinned = (pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet) == 0);
+	}
+
+	// Scheduling
+	m_realTimeScheduled = false;
+	if (m_settings.priority > 0) {
+		sched_param parameters{};
+		parameters.sched_priority = std::clamp(m_settings.priority, sched_get_priority_min(SCHED_FIFO), sched_get_priority_max(SCHED_FIFO));
+		m_realTimeScheduled = (pthread_setschedparam(pthread_self(), SCHED_FIFO, &parameters) == 0);
+	}
+
+	// Stack
+	if (m_memoryLocked) {
+		volatile unsigned char stack[64 * 1024];
+		for (std::size_t byte = 0; byte < sizeof(stack); byte += 4096) {
+			stack[byte] = 0; // One write per page
+		}
+	}
+}
\ No newline at end of file
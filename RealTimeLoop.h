@@ -0,0 +1,115 @@
+//==============================================================
+// Filename : RealTimeLoop.h
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class to run a step function periodically on a
+//				 dedicated thread, paced to absolute release
+//				 times, with CPU pinning, real-time scheduling,
+//				 locked memory and a jitter histogram - header
+//==============================================================
+
+// [BEGIN]: Prevent multiple inclusions of header
+#ifndef REALTIMELOOP_H
+#define REALTIMELOOP_H
+
+
+// Libraries
+#include "LatencyHistogram.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <thread>
+
+// Behavior after a step that ends past the release of the next one (overrun)
+enum class CatchUpPolicy {
+	Skip,		// Missed releases are skipped; the cadence stays on the original schedule
+	CatchUp,	// Missed releases are stepped back to back (at most maximumCatchUp), such that the number of steps keeps up with the clock
+	Restart		// The schedule restarts one period after the overrun; no burst, but the schedule shifts
+};
+
+// Settings of the real-time loop
+struct RealTimeSettings {
+	double period = 0.01;							// [s]
+	int cpu = -1;									// CPU the thread is pinned to; -1 --> not pinned
+	int priority = 0;								// SCHED_FIFO priority (1 - 99); 0 --> default scheduling
+	bool lockMemory = false;						// Lock the memory of the process (no page faults in the loop)
+	CatchUpPolicy catchUpPolicy = CatchUpPolicy::Skip;
+	std::size_t maximumCatchUp = 10;				// CatchUp: releases missed beyond this number are skipped
+};
+
+// RealTimeLoop-class
+class RealTimeLoop {
+public:
+	// Function executed per release; returns false to end the loop
+	using StepFunction = std::function<bool()>;
+
+	// Constructor (default)
+	RealTimeLoop() = default;
+
+	// Destructor; stops the loop
+	~RealTimeLoop();
+
+	// Not copyable (owns a thread)
+	RealTimeLoop(const RealTimeLoop&) = delete;
+	RealTimeLoop& operator=(const RealTimeLoop&) = delete;
+
+
+	// Getters (settings)
+	const RealTimeSettings& getSettings() const { return m_settings; }
+
+	// Getters (state); whether the settings could be applied (pinning, scheduling and locking need privileges)
+	bool isRunning() const { return m_running.load(std::memory_order_acquire); }
+	bool isPinned() const { return m_pinned; }
+	bool isRealTimeScheduled() const { return m_realTimeScheduled; }
+	bool isMemoryLocked() const { return m_memoryLocked; }
+
+	// Getters (histograms); in [ns]
+	const LatencyHistogram& getJitterHistogram() const { return m_jitter; }			// Release --> start of the step
+	const LatencyHistogram& getExecutionHistogram() const { return m_execution; }	// Duration of the step
+
+	// Getters (counters)
+	std::uint64_t getNumberOfSteps() const { return m_numberOfSteps.load(std::memory_order_relaxed); }
+	std::uint64_t getNumberOfOverruns() const { return m_numberOfOverruns.load(std::memory_order_relaxed); }			// Steps ending past the next release (catch-up steps not included)
+	std::uint64_t getNumberOfMissedPeriods() const { return m_numberOfMissedPeriods.load(std::memory_order_relaxed); }	// Releases without a step
+
+
+	// Setters (settings); only while not running
+	bool setSettings(const RealTimeSettings&);
+
+
+	// Other
+	bool start(const StepFunction&);
+	void stop();
+	void wait();
+	std::string formatReport() const;
+
+private:
+	// Attributes (settings)
+	RealTimeSettings m_settings;
+
+	// Attributes (thread)
+	std::thread m_thread;
+	StepFunction m_step;
+	std::atomic<bool> m_running{ false };
+	bool m_pinned = false;				// Written by the thread before start() returns
+	bool m_realTimeScheduled = false;	// ...
+	bool m_memoryLocked = false;
+
+	// Attributes (histograms and counters)
+	LatencyHistogram m_jitter;
+	LatencyHistogram m_execution;
+	std::atomic<std::uint64_t> m_numberOfSteps{ 0 };
+	std::atomic<std::uint64_t> m_numberOfOverruns{ 0 };
+	std::atomic<std::uint64_t> m_numberOfMissedPeriods{ 0 };
+
+	// Helper functions for start()
+	void run(std::atomic<int>&);
+	void applyThreadSettings();
+};
+
+
+// [END]: Prevent multiple inclusions of header
+#endif
\ No newline at end of file
@@ -13,12 +13,13 @@
 
 // Libraries
 #include "NumericalIntegrationProperties.h"
+#include "DenseOutputNumericalIntegration.h"
 #include <functional>
 #include <vector>
 
 
 // RungeKuttaFourNumericalIntegration-class
-class RungeKuttaFourNumericalIntegration : public virtual NumericalIntegrationProperties {
+class RungeKuttaFourNumericalIntegration : public virtual NumericalIntegrationProperties, public virtual DenseOutputNumericalIntegration {
 public:
 	// Constructor (default)
 	RungeKuttaFourNumericalIntegration() = default;
@@ -31,8 +32,92 @@ public:
 	std::vector<double> calculateStep(std::function<std::vector<double>(std::vector<double>, std::vector<double>, std::vector<double>, std::vector<double>, bool)>, 
 									  std::vector<double>, std::vector<double>, std::vector<double>, 
 									  std::vector<double>, bool);
+
+	// Calculate (step: fixed-size, allocation-free)
+	template <typename Function, typename State, typename Control, typename Output, typename Parameters>
+	void calculateStep(Function&&, const State&, const Control&, const Output&, const Parameters&, bool, State&);
+	template <typename Function, typename OutputFunction, typename State, typename Control, typename Parameters>
+	void calculateStep(Function&&, OutputFunction&&, const State&, const Control&, const Parameters&, bool, State&); // Output vector per stage
 };
 
 
+// Calculate (step: fixed-size, allocation-free)
+/**
+ * Computes the integration of the derivative function using the RK4-approach with some timestep.
+ * Works on fixed-size arrays passed by reference and calls the derivative function directly (no std::function),
+ * such that a step does not allocate. The output vector is held constant over the step.
+ *
+ * @param	function : the derivative function --> this function must adhere a [ f(x,u,y,P,n,xDot) ] format
+ * @param	stateVector : the current state vector of the system
+ * @param	controlVector : the current control vector
+ * @param	outputVector : the current output vector of the system
+ * @param	parametersList : array containing all necessary parameters to compute the derivative equation
+ * @param	dynamicsType : specifies the dynamics type to be used of the system
+ * @param	nextStateVector : array the integrated result of the derivative function is written to (may alias stateVector)
+ */
+template <typename Function, typename State, typename Control, typename Output, typename Parameters>
+void RungeKuttaFourNumericalIntegration::calculateStep(Function&& function, const State& stateVector, const Control& controlVector, const Output& outputVector,
+													   const Parameters& parameterList, bool dynamicsType, State& nextStateVector)
+{
+	// Output vector is constant over the step
+	auto outputFunction = [&outputVector](const State&) -> const Output& { return outputVector; };
+
+	// Integrate
+	calculateStep(function, outputFunction, stateVector, controlVector, parameterList, dynamicsType, nextStateVector);
+}
+
+/**
+ * Computes the integration of the derivative function using the RK4-approach with some timestep, where the output vector
+ * is recomputed from every stage state with the output function. Since the rope force depends on the output vector,
+ * this keeps K2 - K4 consistent with their stage states and gives the full fourth order of the method.
+ * The dense output of the step (cubic Hermite with K1 and K4 as derivatives) is saved, see DenseOutputNumericalIntegration.
+ *
+ * @param	function : the derivative function --> this function must adhere a [ f(x,u,y,P,n,xDot) ] format
+ * @param	outputFunction : computes the output vector from a state vector --> [ y = g(x) ] format
+ * @param	stateVector : the current state vector of the system
+ * @param	controlVector : the current control vector
+ * @param	parametersList : array containing all necessary parameters to compute the derivative equation
+ * @param	dynamicsType : specifies the dynamics type to be used of the system
+ * @param	nextStateVector : array the integrated result of the derivative function is written to (may alias stateVector)
+ */
+template <typename Function, typename OutputFunction, typename State, typename Control, typename Parameters>
+void RungeKuttaFourNumericalIntegration::calculateStep(Function&& function, OutputFunction&& outputFunction, const State& stateVector, const Control& controlVector,
+													   const Parameters& parameterList, bool dynamicsType, State& nextStateVector)
+{
+	// Initialize variables
+	State K1{}, K2{}, K3{}, K4{};	// K's of RK4-method
+	State stateVectorK{};			// Used for f(x + K)
+	State x{};						// Next state
+	const double timeStep = getTimeStep();
+
+	// Compute K1
+	function(stateVector, controlVector, outputFunction(stateVector), parameterList, dynamicsType, K1);
+
+	// Compute K2 --> f(x + [K1 * (h/2)])
+	for (std::size_t i = 0; i < stateVector.size(); i++) { stateVectorK[i] = stateVector[i] + K1[i] * (timeStep / 2); }
+	function(stateVectorK, controlVector, outputFunction(stateVectorK), parameterList, dynamicsType, K2);
+
+	// Compute K3 --> f(x + [K2 * (h/2)])
+	for (std::size_t i = 0; i < stateVector.size(); i++) { stateVectorK[i] = stateVector[i] + K2[i] * (timeStep / 2); }
+	function(stateVectorK, controlVector, outputFunction(stateVectorK), parameterList, dynamicsType, K3);
+
+	// Compute K4 --> f(x + [K3 * h])
+	for (std::size_t i = 0; i < stateVector.size(); i++) { stateVectorK[i] = stateVector[i] + K3[i] * timeStep; }
+	function(stateVectorK, controlVector, outputFunction(stateVectorK), parameterList, dynamicsType, K4);
+
+	// Sum to construct final state vector
+	//		EQUATION: x_next = x_current + (1/6) * h * (K1 + 2*K2 + 2*K3 + 1*K4)
+	for (std::size_t i = 0; i < stateVector.size(); i++) {
+		x[i] = stateVector[i] + K1[i] * (timeStep / 6) + K2[i] * (timeStep / 3) + K3[i] * (timeStep / 3) + K4[i] * (timeStep / 6);
+	}
+
+	// Save dense output (cubic Hermite with K1 and K4 as derivatives, no additional evaluations)
+	setDenseOutput(stateVector, K1, x, K4, timeStep);
+
+	// Construct final state vector
+	nextStateVector = x;
+}
+
+
 // [END]: Prevent multiple inclusions of header
 #endif
\ No newline at end of file
@@ -0,0 +1,71 @@
+//==============================================================
+// Filename : RunningStatistics.cpp
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class for the mean, variance, minimum and
+//				 maximum of a stream of values, updated per value
+//				 (Welford) - source
+//==============================================================
+
+// Libraries
+#include "RunningStatistics.h"
+#include <algorithm>
+#include <cmath>
+
+
+// Getters (statistics)
+/**
+ * Retrieves the sample variance of the values added so far
+ *
+ * @return	A (double) which is the sample variance; zero for less than two values
+ */
+double RunningStatistics::getVariance() const {
+	return (m_count > 1) ? m_sumOfSquaredDeviations / double(m_count - 1) : 0;
+}
+
+double RunningStatistics::getStandardDeviation() const {
+	return std::sqrt(getVariance());
+}
+
+
+// Other
+/**
+ * Adds a value (Welford's update), which avoids the cancellation of summing values and squared values
+ *
+ * @param	value : the value to add
+ */
+void RunningStatistics::add(double value) {
+	m_count++;
+	const double deviation = value - m_mean;
+	m_mean += deviation / double(m_count);
+	m_sumOfSquaredDeviations += deviation * (value - m_mean);
+
+	m_minimum = std::min(m_minimum, value);
+	m_maximum = std::max(m_maximum, value);
+}
+
+/**
+ * Adds the values of other statistics (Chan et al. pairwise update). The result depends on the order of merging in
+ * the last bits; merge in a fixed order for reproducible results.
+ *
+ * @param	other : the statistics to add
+ */
+void RunningStatistics::merge(const RunningStatistics& other) {
+	if (other.m_count == 0) {
+		return;
+	}
+	if (m_count == 0) {
+		*this = other;
+		return;
+	}
+
+	const double count = double(m_count + other.m_count);
+	const double deviation = other.m_mean - m_mean;
+	m_mean += deviation * (double(other.m_count) / count);
+	m_sumOfSquaredDeviations += other.m_sumOfSquaredDeviations + deviation * deviation * (double(m_count) * double(other.m_count) / count);
+	m_count += other.m_count;
+
+	m_minimum = std::min(m_minimum, other.m_minimum);
+	m_maximum = std::max(m_maximum, other.m_maximum);
+}
\ No newline at end of file
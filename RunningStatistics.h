@@ -0,0 +1,51 @@
+//==============================================================
+// Filename : RunningStatistics.h
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class for the mean, variance, minimum and
+//				 maximum of a stream of values, updated per value
+//				 (Welford) - header
+//==============================================================
+
+// [BEGIN]: Prevent multiple inclusions of header
+#ifndef RUNNINGSTATISTICS_H
+#define RUNNINGSTATISTICS_H
+
+
+// Libraries
+#include <cstddef>
+#include <limits>
+
+// RunningStatistics-class
+class RunningStatistics {
+public:
+	// Constructor (default)
+	RunningStatistics() = default;
+
+
+	// Getters (statistics)
+	std::size_t getCount() const { return m_count; }
+	double getMean() const { return m_mean; }
+	double getVariance() const; // Sample variance (n - 1)
+	double getStandardDeviation() const;
+	double getMinimum() const { return m_minimum; }
+	double getMaximum() const { return m_maximum; }
+
+
+	// Other
+	void add(double);
+	void merge(const RunningStatistics&);
+
+private:
+	// Attributes (statistics)
+	std::size_t m_count = 0;
+	double m_mean = 0;
+	double m_sumOfSquaredDeviations = 0; // Sum of (value - mean)^2
+	double m_minimum = std::numeric_limits<double>::infinity();
+	double m_maximum = -std::numeric_limits<double>::infinity();
+};
+
+
+// [END]: Prevent multiple inclusions of header
+#endif
\ No newline at end of file
@@ -0,0 +1,244 @@
+//==============================================================
+// Filename : SharedMemoryChannel.h
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class for a latest-value channel of one record
+//				 in shared memory (seqlock), with one writer and
+//				 readers that wait on a futex - header
+//==============================================================
+
+// [BEGIN]: Prevent multiple inclusions of header
+#ifndef SHAREDMEMORYCHANNEL_H
+#define SHAREDMEMORYCHANNEL_H
+
+
+// Libraries
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <type_traits>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+// SharedMemoryChannel-class; placed in memory shared between processes, so it holds no pointers
+template <typename Record>
+class SharedMemoryChannel {
+	static_assert(std::is_trivially_copyable<Record>::value, "Records are copied into and out of the channel as plain memory");
+	static_assert(std::atomic<std::uint32_t>::is_always_lock_free && sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t), "A futex is a plain 32-bit word");
+	static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "Lock-free atomics are address-free, as required across processes");
+
+public:
+	// Constructor (default)
+	SharedMemoryChannel() = default;
+
+	// Not copyable (shared between processes)
+	SharedMemoryChannel(const SharedMemoryChannel&) = delete;
+	SharedMemoryChannel& operator=(const SharedMemoryChannel&) = delete;
+
+
+	// Getters (state)
+	std::uint32_t getSequence() const { return m_sequence.load(std::memory_order_acquire); } // Twice the number of publishes (odd while writing)
+	bool isClosed() const { return m_closed.load(std::memory_order_acquire) != 0; }
+
+
+	// Writer (one thread)
+	void publish(const Record&);
+
+	// Readers
+	std::uint32_t read(Record&) const;
+	bool waitForNew(std::uint32_t&, Record&, double, unsigned) const;
+
+	// Other
+	void close(); // Readers stop waiting, e.g. at the end of a run
+
+private:
+	// Number of 64-bit words of a record
+	static constexpr std::size_t numberOfWords = (sizeof(Record) + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t);
+
+	// Attributes (seqlock); on a cache line of their own
+	alignas(64) std::atomic<std::uint32_t> m_sequence{ 0 };
+	std::atomic<std::uint64_t> m_words[numberOfWords]{};
+
+	// Attributes (wake-up); the futex word changes on every publish or close that has a waiting reader
+	alignas(64) mutable std::atomic<std::uint32_t> m_event{ 0 };
+	mutable std::atomic<std::uint32_t> m_numberOfWaiters{ 0 };
+	std::atomic<std::uint32_t> m_closed{ 0 };
+
+	// Helper functions for waitForNew() and publish()
+	static void relax();
+	static void waitOnFutex(std::atomic<std::uint32_t>&, std::uint32_t, std::chrono::nanoseconds);
+	static void wakeFutex(std::atomic<std::uint32_t>&);
+};
+
+
+// Writer
+/**
+ * Publishes a record (writer only). The sequence is odd while the words are written, such that readers retry instead
+ * of returning a torn record; readers sleeping in waitForNew() are woken with one system call, which is skipped when
+ * none is waiting.
+ *
+ * @param	record : the record to publish
+ */
+template <typename Record>
+void SharedMemoryChannel<Record>::publish(const Record& record) {
+	// Initialize variables
+	std::uint64_t words[numberOfWords] = {};
+	std::memcpy(words, &record, sizeof(Record));
+	const std::uint32_t sequence = m_sequence.load(std::memory_order_relaxed);
+
+	// Write (odd sequence)
+	m_sequence.store(sequence + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	for (std::size_t word = 0; word < numberOfWords; word++) {
+		m_words[word].store(words[word], std::memory_order_relaxed);
+	}
+	m_sequence.store(sequence + 2, std::memory_order_seq_cst);
+
+	// Wake the waiting readers
+	if (m_numberOfWaiters.load(std::memory_order_seq_cst) > 0) {
+		m_event.fetch_add(1, std::memory_order_seq_cst);
+		wakeFutex(m_event);
+	}
+}
+
+
+// Readers
+/**
+ * Reads the latest record without waiting (the writer is never blocked by readers)
+ *
+ * @param	record : the latest record is written to this record (zero before the first publish)
+ * @return	A (std::uint32_t) which is the sequence of the record read, 0 if none has been published
+ */
+template <typename Record>
+std::uint32_t SharedMemoryChannel<Record>::read(Record& record) const {
+	std::uint64_t words[numberOfWords];
+
+	while (true) {
+		const std::uint32_t sequence = m_sequence.load(std::memory_order_acquire);
+		if (sequence & 1) {
+			relax(); // Write in progress
+			continue;
+		}
+
+		for (std::size_t word = 0; word < numberOfWords; word++) {
+			words[word] = m_words[word].load(std::memory_order_relaxed);
+		}
+		std::atomic_thread_fence(std::memory_order_acquire);
+
+		if (m_sequence.load(std::memory_order_relaxed) == sequence) {
+			std::memcpy(&record, words, sizeof(Record));
+			return sequence;
+		}
+	}
+}
+
+/**
+ * Waits until a record newer than the last one read is published. The reader spins first (lowest latency when the
+ * writer runs on another core), then sleeps on a futex until the writer wakes it. Records published in between are
+ * skipped: the channel holds the latest value only.
+ *
+ * @param	sequence : the sequence of the last record read (0 --> none); updated to the sequence of the new record
+ * @param	record : the new record is written to this record
+ * @param	timeout : maximum time to wait in [s]
+ * @param	spinCount : number of checks before sleeping (0 --> sleep at once)
+ * @return	A type (bool) which is true if a new record was read, false on a timeout or when the channel is closed
+ */
+template <typename Record>
+bool SharedMemoryChannel<Record>::waitForNew(std::uint32_t& sequence, Record& record, double timeout, unsigned spinCount) const {
+	// Initialize variables
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::duration<double>(timeout));
+	unsigned spin = 0;
+
+	while (true) {
+		// New record
+		if (m_sequence.load(std::memory_order_acquire) != sequence) {
+			const std::uint32_t readSequence = read(record);
+			if (readSequence != sequence) {
+				sequence = readSequence;
+				return true;
+			}
+		}
+		if (isClosed()) {
+			return false;
+		}
+
+		// Spin
+		if (spin < spinCount) {
+			spin++;
+			relax();
+			continue;
+		}
+
+		// Sleep; the futex word is read before the sequence, such that a publish in between is not missed
+		const auto remaining = deadline - std::chrono::steady_clock::now();
+		if (remaining <= std::chrono::nanoseconds(0)) {
+			return false;
+		}
+		m_numberOfWaiters.fetch_add(1, std::memory_order_seq_cst);
+		const std::uint32_t event = m_event.load(std::memory_order_seq_cst);
+		if ((m_sequence.load(std::memory_order_seq_cst) == sequence) && !m_closed.load(std::memory_order_seq_cst)) {
+			waitOnFutex(m_event, event, std::chrono::duration_cast<std::chrono::nanoseconds>(remaining));
+		}
+		m_numberOfWaiters.fetch_sub(1, std::memory_order_seq_cst);
+	}
+}
+
+
+// Other
+/**
+ * Closes the channel: waiting readers return false from waitForNew(), now and in later calls
+ */
+template <typename Record>
+void SharedMemoryChannel<Record>::close() {
+	m_closed.store(1, std::memory_order_seq_cst);
+	if (m_numberOfWaiters.load(std::memory_order_seq_cst) > 0) {
+		m_event.fetch_add(1, std::memory_order_seq_cst);
+		wakeFutex(m_event);
+	}
+}
+
+
+// Helper functions for waitForNew() and publish()
+/**
+ * Hint to the processor that the thread is spinning
+ */
+template <typename Record>
+void SharedMemoryChannel<Record>::relax() {
+#if defined(__x86_64__) || defined(__i386__)
+	__builtin_ia32_pause();
+#endif
+}
+
+/**
+ * Sleeps until the futex word is woken, unless it no longer holds the expected value (shared futex: the word may be
+ * mapped at different addresses in different processes)
+ *
+ * @param	word : the futex word
+ * @param	expected : the value the word held when the caller decided to sleep
+ * @param	timeout : maximum time to sleep
+ */
+template <typename Record>
+void SharedMemoryChannel<Record>::waitOnFutex(std::atomic<std::uint32_t>& word, std::uint32_t expected, std::chrono::nanoseconds timeout) {
+	const std::timespec relativeTimeout = { static_cast<std::time_t>(timeout.count() / 1000000000), static_cast<long>(timeout.count() % 1000000000) };
+	syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word), FUTEX_WAIT, expected, &relativeTimeout, nullptr, 0);
+}
+
+/**
+ * Wakes all threads sleeping on the futex word, in any process
+ *
+ * @param	word : the futex word
+ */
+template <typename Record>
+void SharedMemoryChannel<Record>::wakeFutex(std::atomic<std::uint32_t>& word) {
+	syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+}
+
+
+// [END]: Prevent multiple inclusions of header
+#endif
\ No newline at end of file
@@ -0,0 +1,82 @@
+//==============================================================
+// Filename : SharedMemoryControllerAdapter.cpp
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class to compute control records with the
+//				 feedback controller from the state records of a
+//				 shared memory transport - source
+//==============================================================
+
+// Libraries
+#include "SharedMemoryControllerAdapter.h"
+#include <thread>
+#include <vector>
+
+
+// Constructor
+/**
+ * Creates the adapter of a controller (its time constants and reference velocity are set by the caller) and an open
+ * transport, with the model of the controller node (drone with cargo, masses of 3 and 2 kg)
+ *
+ * @param	controller : the controller computing the control vectors
+ * @param	transport : the transport, created or opened
+ */
+SharedMemoryControllerAdapter::SharedMemoryControllerAdapter(DroneControllerControlVector& controller, SharedMemoryTransport& transport)
+	: m_controller(controller), m_transport(transport), m_spinCount((std::thread::hardware_concurrency() > 1) ? 1000 : 0) {}
+
+
+// Setters (settings)
+/**
+ * Sets the number of checks for a new state record before the controller sleeps (see SharedMemoryChannel::waitForNew())
+ *
+ * @param	spinCount : number of checks (0 --> sleep at once, best when both processes share a core)
+ */
+void SharedMemoryControllerAdapter::setSpinCount(unsigned spinCount) {
+	m_spinCount = spinCount;
+}
+
+/**
+ * Sets the model the controller computes its control vectors with
+ *
+ * @param	dynamicsType : drone only (false) or drone with cargo (true)
+ * @param	gravitationalConstant : in [m / s^2]
+ * @param	massDrone : in [kg]
+ * @param	massCargo : in [kg]
+ */
+void SharedMemoryControllerAdapter::setModel(bool dynamicsType, double gravitationalConstant, double massDrone, double massCargo) {
+	m_dynamicsType = dynamicsType;
+	m_gravitationalConstant = gravitationalConstant;
+	m_massDrone = massDrone;
+	m_massCargo = massCargo;
+}
+
+
+// Other
+/**
+ * Waits for a new state record, computes the control vector for it (as the controller node does per timer tick) and
+ * publishes it as a control record
+ *
+ * @param	timeout : maximum time to wait for the state record in [s]
+ * @return	A type (bool) which is true if a control record was published, false on a timeout or when the transport is closed
+ */
+bool SharedMemoryControllerAdapter::step(double timeout) {
+	// State record
+	const std::uint32_t lastStateSequence = m_stateSequence;
+	StateRecord stateRecord;
+	if (!m_transport.getStateChannel().waitForNew(m_stateSequence, stateRecord, timeout, m_spinCount)) {
+		return false;
+	}
+	if (lastStateSequence != 0) {
+		m_numberOfMissedStates += (m_stateSequence - lastStateSequence) / 2 - 1;
+	}
+
+	// Control vector and publish
+	const std::vector<double> controlVector = m_controller.calculateReferenceControlVector(m_dynamicsType, m_gravitationalConstant,
+																						   m_massDrone, stateRecord.xdrone, stateRecord.xdotdrone, stateRecord.ydrone, stateRecord.ydotdrone, stateRecord.thetadrone,
+																						   m_massCargo, stateRecord.xcargo, stateRecord.ycargo);
+	m_transport.getControlChannel().publish({ controlVector[0], controlVector[1] });
+	m_numberOfSteps++;
+
+	return true;
+}
\ No newline at end of file
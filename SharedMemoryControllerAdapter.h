@@ -0,0 +1,68 @@
+//==============================================================
+// Filename : SharedMemoryControllerAdapter.h
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class to compute control records with the
+//				 feedback controller from the state records of a
+//				 shared memory transport - header
+//==============================================================
+
+// [BEGIN]: Prevent multiple inclusions of header
+#ifndef SHAREDMEMORYCONTROLLERADAPTER_H
+#define SHAREDMEMORYCONTROLLERADAPTER_H
+
+
+// Libraries
+#include "SharedMemoryTransport.h"
+#include "DroneControllerControlVector.h"
+#include <cstdint>
+
+// SharedMemoryControllerAdapter-class
+class SharedMemoryControllerAdapter {
+public:
+	// Constructor (with arguments); the controller and the transport must outlive the adapter
+	SharedMemoryControllerAdapter(DroneControllerControlVector&, SharedMemoryTransport&);
+
+
+	// Getters (counters)
+	std::uint64_t getNumberOfSteps() const { return m_numberOfSteps; }
+	std::uint64_t getNumberOfMissedStates() const { return m_numberOfMissedStates; } // State records overwritten before they were read
+
+	// Getters (settings)
+	unsigned getSpinCount() const { return m_spinCount; }
+
+
+	// Setters (settings)
+	void setSpinCount(unsigned);
+	void setModel(bool, double, double, double);
+
+
+	// Other
+	bool step(double);
+
+private:
+	// Attributes (controller and transport)
+	DroneControllerControlVector& m_controller;
+	SharedMemoryTransport& m_transport;
+
+	// Attributes (settings)
+	unsigned m_spinCount;	// 1000 with more than one hardware thread, else 0
+
+	// Attributes (model); as the controller node
+	bool m_dynamicsType = true;
+	double m_gravitationalConstant = 9.81;	// in [m / s^2]
+	double m_massDrone = 3;					// in [kg]
+	double m_massCargo = 2;					// in [kg]
+
+	// Attributes (last records)
+	std::uint32_t m_stateSequence = 0;
+
+	// Attributes (counters)
+	std::uint64_t m_numberOfSteps = 0;
+	std::uint64_t m_numberOfMissedStates = 0;
+};
+
+
+// [END]: Prevent multiple inclusions of header
+#endif
\ No newline at end of file
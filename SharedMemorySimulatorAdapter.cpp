@@ -0,0 +1,72 @@
+//==============================================================
+// Filename : SharedMemorySimulatorAdapter.cpp
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class to drive the simulator with the control
+//				 records of a shared memory transport, and to
+//				 publish its state records - source
+//==============================================================
+
+// Libraries
+#include "SharedMemorySimulatorAdapter.h"
+#include <thread>
+
+
+// Constructor
+/**
+ * Creates the adapter of a simulator (its parameters, implementation and initial state are set by the caller) and an
+ * open transport. The adapter spins before sleeping only if the processes can run on different cores.
+ *
+ * @param	simulator : the simulator to drive
+ * @param	transport : the transport, created or opened
+ */
+SharedMemorySimulatorAdapter::SharedMemorySimulatorAdapter(DroneRopeCargoSimulator& simulator, SharedMemoryTransport& transport)
+	: m_simulator(simulator), m_transport(transport), m_spinCount((std::thread::hardware_concurrency() > 1) ? 1000 : 0) {}
+
+
+// Setters (settings)
+/**
+ * Sets the number of checks for a new control record before the simulator sleeps (see SharedMemoryChannel::waitForNew())
+ *
+ * @param	spinCount : number of checks (0 --> sleep at once, best when both processes share a core)
+ */
+void SharedMemorySimulatorAdapter::setSpinCount(unsigned spinCount) {
+	m_spinCount = spinCount;
+}
+
+
+// Other
+/**
+ * Publishes the current state vector of the simulator, e.g. the initial state before the first step
+ */
+void SharedMemorySimulatorAdapter::publishState() {
+	m_stateVector = m_simulator.getStateArray();
+	m_transport.getStateChannel().publish(StateRecord::fromStateArray(m_stateVector));
+}
+
+/**
+ * Waits for a new control record, steps the simulator once with it (as the dynamics_simulator node does per control
+ * message) and publishes the resulting state record
+ *
+ * @param	timeout : maximum time to wait for the control record in [s]
+ * @return	A type (bool) which is true if the simulator stepped, false on a timeout or when the transport is closed
+ */
+bool SharedMemorySimulatorAdapter::step(double timeout) {
+	// Control record
+	const std::uint32_t lastControlSequence = m_controlSequence;
+	ControlRecord controlRecord;
+	if (!m_transport.getControlChannel().waitForNew(m_controlSequence, controlRecord, timeout, m_spinCount)) {
+		return false;
+	}
+	if (lastControlSequence != 0) {
+		m_numberOfMissedControls += (m_controlSequence - lastControlSequence) / 2 - 1;
+	}
+
+	// Step and publish
+	m_simulator.simulationStep(controlRecord.toControlArray(), m_stateVector);
+	m_transport.getStateChannel().publish(StateRecord::fromStateArray(m_stateVector));
+	m_numberOfSteps++;
+
+	return true;
+}
\ No newline at end of file
@@ -0,0 +1,63 @@
+//==============================================================
+// Filename : SharedMemorySimulatorAdapter.h
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class to drive the simulator with the control
+//				 records of a shared memory transport, and to
+//				 publish its state records - header
+//==============================================================
+
+// [BEGIN]: Prevent multiple inclusions of header
+#ifndef SHAREDMEMORYSIMULATORADAPTER_H
+#define SHAREDMEMORYSIMULATORADAPTER_H
+
+
+// Libraries
+#include "SharedMemoryTransport.h"
+#include "DroneRopeCargoSimulator.h"
+#include <cstdint>
+
+// SharedMemorySimulatorAdapter-class
+class SharedMemorySimulatorAdapter {
+public:
+	// Constructor (with arguments); the simulator and the transport must outlive the adapter
+	SharedMemorySimulatorAdapter(DroneRopeCargoSimulator&, SharedMemoryTransport&);
+
+
+	// Getters (counters)
+	std::uint64_t getNumberOfSteps() const { return m_numberOfSteps; }
+	std::uint64_t getNumberOfMissedControls() const { return m_numberOfMissedControls; } // Control records overwritten before they were read
+
+	// Getters (settings)
+	unsigned getSpinCount() const { return m_spinCount; }
+
+
+	// Setters (settings)
+	void setSpinCount(unsigned);
+
+
+	// Other
+	void publishState();
+	bool step(double);
+
+private:
+	// Attributes (simulator and transport)
+	DroneRopeCargoSimulator& m_simulator;
+	SharedMemoryTransport& m_transport;
+
+	// Attributes (settings)
+	unsigned m_spinCount;	// 1000 with more than one hardware thread, else 0
+
+	// Attributes (last records)
+	StateArray m_stateVector{};
+	std::uint32_t m_controlSequence = 0;
+
+	// Attributes (counters)
+	std::uint64_t m_numberOfSteps = 0;
+	std::uint64_t m_numberOfMissedControls = 0;
+};
+
+
+// [END]: Prevent multiple inclusions of header
+#endif
\ No newline at end of file
@@ -0,0 +1,156 @@
+//==============================================================
+// Filename : SharedMemoryTransport.cpp
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class for the exchange of state and control
+//				 records between a simulator process and a
+//				 controller process through POSIX shared memory,
+//				 without ROS - source
+//==============================================================
+
+// Libraries
+#include "SharedMemoryTransport.h"
+#include <chrono>
+#include <new>
+#include <thread>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+// Destructor
+SharedMemoryTransport::~SharedMemoryTransport() {
+	detach();
+}
+
+
+// Other (segment)
+/**
+ * Creates the shared memory segment (simulator side) with two empty channels. A segment left behind under the same
+ * name (e.g. by a crashed run) is replaced.
+ *
+ * @param	name : name of the segment (a leading '/' is added if missing)
+ * @return	A type (bool) which is true if the segment was created and mapped
+ */
+bool SharedMemoryTransport::create(const std::string& name) {
+	// Initialize variables
+	detach();
+	const std::string objectName = toObjectName(name);
+
+	// Create and size the segment
+	shm_unlink(objectName.c_str());
+	const int fileDescriptor = shm_open(objectName.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+	if (fileDescriptor < 0) {
+		return false;
+	}
+	if (ftruncate(fileDescriptor, sizeof(SharedMemoryLayout)) != 0) {
+		close(fileDescriptor);
+		shm_unlink(objectName.c_str());
+		return false;
+	}
+
+	// Map; the mapping stays valid after closing the file descriptor
+	void* address = mmap(nullptr, sizeof(SharedMemoryLayout), PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0);
+	close(fileDescriptor);
+	if (address == MAP_FAILED) {
+		shm_unlink(objectName.c_str());
+		return false;
+	}
+
+	// Construct the channels, then mark the segment as initialized
+	m_layout = new (address) SharedMemoryLayout();
+	m_layout->version = layoutVersion;
+	m_layout->size = sizeof(SharedMemoryLayout);
+	m_layout->identifier.store(layoutIdentifier, std::memory_order_release);
+
+	m_name = objectName;
+	m_owner = true;
+	return true;
+}
+
+/**
+ * Opens a segment created by another process (controller side), waiting until it exists and is initialized
+ *
+ * @param	name : name of the segment (a leading '/' is added if missing)
+ * @param	timeout : maximum time to wait for the segment in [s]
+ * @return	A type (bool) which is true if the segment was opened and mapped
+ */
+bool SharedMemoryTransport::open(const std::string& name, double timeout) {
+	// Initialize variables
+	detach();
+	const std::string objectName = toObjectName(name);
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::duration<double>(timeout));
+
+	do {
+		const int fileDescriptor = shm_open(objectName.c_str(), O_RDWR, 0600);
+		if (fileDescriptor >= 0) {
+			// Map once it has the size of the layout
+			struct stat status {};
+			void* address = MAP_FAILED;
+			if ((fstat(fileDescriptor, &status) == 0) && (status.st_size == off_t(sizeof(SharedMemoryLayout)))) {
+				address = mmap(nullptr, sizeof(SharedMemoryLayout), PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0);
+			}
+			close(fileDescriptor);
+
+			// Accept once initialized by a build with the same layout
+			if (address != MAP_FAILED) {
+				SharedMemoryLayout* layout = static_cast<SharedMemoryLayout*>(address);
+				if (layout->identifier.load(std::memory_order_acquire) == layoutIdentifier) {
+					if ((layout->version == layoutVersion) && (layout->size == sizeof(SharedMemoryLayout))) {
+						m_layout = layout;
+						m_name = objectName;
+						m_owner = false;
+						return true;
+					}
+					munmap(address, sizeof(SharedMemoryLayout));
+					return false;
+				}
+				munmap(address, sizeof(SharedMemoryLayout));
+			}
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	} while (std::chrono::steady_clock::now() < deadline);
+
+	return false;
+}
+
+/**
+ * Closes both channels, such that the other process stops waiting (end of a run); the segment stays mapped
+ */
+void SharedMemoryTransport::closeChannels() {
+	if (m_layout != nullptr) {
+		m_layout->stateChannel.close();
+		m_layout->controlChannel.close();
+	}
+}
+
+/**
+ * Unmaps the segment; its name is removed if this object created it (the memory is freed once no process maps it)
+ */
+void SharedMemoryTransport::detach() {
+	if (m_layout == nullptr) {
+		return;
+	}
+
+	munmap(m_layout, sizeof(SharedMemoryLayout));
+	if (m_owner) {
+		shm_unlink(m_name.c_str());
+	}
+	m_layout = nullptr;
+	m_name.clear();
+	m_owner = false;
+}
+
+
+// Helper functions for create() and open()
+/**
+ * Converts a name into the name of a POSIX shared memory object
+ *
+ * @param	name : name of the segment
+ * @return	A (std::string) which is the name with a leading '/'
+ */
+std::string SharedMemoryTransport::toObjectName(const std::string& name) {
+	return (!name.empty() && name[0] == '/') ? name : "/" + name;
+}
\ No newline at end of file
@@ -0,0 +1,107 @@
+//==============================================================
+// Filename : SharedMemoryTransport.h
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class for the exchange of state and control
+//				 records between a simulator process and a
+//				 controller process through POSIX shared memory,
+//				 without ROS - header
+//==============================================================
+
+// [BEGIN]: Prevent multiple inclusions of header
+#ifndef SHAREDMEMORYTRANSPORT_H
+#define SHAREDMEMORYTRANSPORT_H
+
+
+// Libraries
+#include "SharedMemoryChannel.h"
+#include "DynamicSystemArrays.h"
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+// Record of a state vector, with the fields of dynamic_system_vectors/msg/State.msg (in its order)
+struct StateRecord {
+	double xdrone = 0;
+	double xdotdrone = 0;
+	double thetadrone = 0;
+	double ydrone = 0;
+	double ydotdrone = 0;
+	double xcargo = 0;
+	double xdotcargo = 0;
+	double ycargo = 0;
+	double ydotcargo = 0;
+
+	// Conversion from and to the state vector of the simulator (xD, yD, thetaD, xDotD, yDotD, xC, yC, xDotC, yDotC)
+	static StateRecord fromStateArray(const StateArray& stateVector) {
+		return { stateVector[0], stateVector[3], stateVector[2], stateVector[1], stateVector[4], stateVector[5], stateVector[7], stateVector[6], stateVector[8] };
+	}
+	StateArray toStateArray() const { return { xdrone, ydrone, thetadrone, xdotdrone, ydotdrone, xcargo, ycargo, xdotcargo, ydotcargo }; }
+};
+
+// Record of a control vector, with the fields of dynamic_system_vectors/msg/Control.msg
+struct ControlRecord {
+	double tau = 0;
+	double omega = 0;
+
+	// Conversion from and to the control vector of the simulator
+	static ControlRecord fromControlArray(const ControlArray& controlVector) { return { controlVector[0], controlVector[1] }; }
+	ControlArray toControlArray() const { return { tau, omega }; }
+};
+
+// Contents of the shared memory segment
+struct SharedMemoryLayout {
+	std::atomic<std::uint32_t> identifier{ 0 };	// Written last by the creator, such that an opener sees an initialized segment
+	std::uint32_t version = 0;
+	std::uint64_t size = 0;						// sizeof(SharedMemoryLayout) of the creator (rejects other builds)
+	SharedMemoryChannel<StateRecord> stateChannel;		// Simulator --> controller
+	SharedMemoryChannel<ControlRecord> controlChannel;	// Controller --> simulator
+};
+
+// SharedMemoryTransport-class
+class SharedMemoryTransport {
+public:
+	// Constructor (default)
+	SharedMemoryTransport() = default;
+
+	// Destructor; unmaps the segment and, if created by this object, removes its name
+	~SharedMemoryTransport();
+
+	// Not copyable (owns the mapping)
+	SharedMemoryTransport(const SharedMemoryTransport&) = delete;
+	SharedMemoryTransport& operator=(const SharedMemoryTransport&) = delete;
+
+
+	// Getters (segment)
+	bool isOpen() const { return m_layout != nullptr; }
+	const std::string& getName() const { return m_name; }
+
+	// Getters (channels); only valid while open
+	SharedMemoryChannel<StateRecord>& getStateChannel() { return m_layout->stateChannel; }
+	SharedMemoryChannel<ControlRecord>& getControlChannel() { return m_layout->controlChannel; }
+
+
+	// Other (segment)
+	bool create(const std::string&);
+	bool open(const std::string&, double);
+	void closeChannels();
+	void detach();
+
+private:
+	// Identification of the layout
+	static constexpr std::uint32_t layoutIdentifier = 0x4d534452; // "RDSM"
+	static constexpr std::uint32_t layoutVersion = 1;
+
+	// Attributes (segment)
+	SharedMemoryLayout* m_layout = nullptr;
+	std::string m_name;
+	bool m_owner = false;
+
+	// Helper functions for create() and open()
+	static std::string toObjectName(const std::string&);
+};
+
+
+// [END]: Prevent multiple inclusions of header
+#endif
\ No newline at end of file
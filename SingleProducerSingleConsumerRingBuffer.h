@@ -0,0 +1,211 @@
+//==============================================================
+// Filename : SingleProducerSingleConsumerRingBuffer.h
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class for a lock-free ring buffer of fixed-size
+//				 records between one producer thread and one
+//				 consumer thread, with an overflow policy - header
+//==============================================================
+
+// [BEGIN]: Prevent multiple inclusions of header
+#ifndef SINGLEPRODUCERSINGLECONSUMERRINGBUFFER_H
+#define SINGLEPRODUCERSINGLECONSUMERRINGBUFFER_H
+
+
+// Libraries
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+// Behavior of push() on a full buffer
+enum class OverflowPolicy {
+	DropNewest,		// The pushed record is dropped (queue of the oldest records)
+	DropOldest,		// The oldest record is dropped (queue of the newest records)
+	LatestValue		// As DropOldest; pop() returns the newest record and drops all older ones
+};
+
+// SingleProducerSingleConsumerRingBuffer-class
+template <typename Record>
+class SingleProducerSingleConsumerRingBuffer {
+	static_assert(std::is_trivially_copyable<Record>::value, "Records are copied into and out of the ring as plain memory");
+
+public:
+	// Constructor (with arguments)
+	SingleProducerSingleConsumerRingBuffer(std::size_t capacity = 10, OverflowPolicy overflowPolicy = OverflowPolicy::DropNewest);
+
+	// Not copyable (shared between threads)
+	SingleProducerSingleConsumerRingBuffer(const SingleProducerSingleConsumerRingBuffer&) = delete;
+	SingleProducerSingleConsumerRingBuffer& operator=(const SingleProducerSingleConsumerRingBuffer&) = delete;
+
+
+	// Getters (settings)
+	std::size_t getCapacity() const { return m_records.size(); }
+	OverflowPolicy getOverflowPolicy() const { return m_overflowPolicy; }
+
+	// Getters (counters); may be called from any thread, the values are a recent snapshot
+	std::size_t getSize() const;
+	bool isEmpty() const { return getSize() == 0; }
+	std::size_t getMaximumSize() const { return m_producer.maximumSize.load(std::memory_order_relaxed); } // Largest size after a push
+	std::uint64_t getNumberOfPushes() const { return m_producer.numberOfPushes.load(std::memory_order_relaxed); }
+	std::uint64_t getNumberOfPops() const { return m_consumer.numberOfPops.load(std::memory_order_relaxed); }
+	std::uint64_t getNumberOfDrops() const { return m_producer.numberOfDrops.load(std::memory_order_relaxed) + m_consumer.numberOfDrops.load(std::memory_order_relaxed); }
+
+
+	// Producer (one thread)
+	bool push(const Record&);
+
+	// Consumer (one thread)
+	bool pop(Record&);
+
+private:
+	// Size of a cache line; the indices and counters of producer and consumer are kept on separate lines
+	static constexpr std::size_t cacheLineSize = 64;
+
+	// Attributes (settings)
+	OverflowPolicy m_overflowPolicy;
+
+	// Attributes (records); allocated once by the constructor
+	std::vector<Record> m_records;
+
+	// Attributes (producer)
+	struct alignas(cacheLineSize) ProducerState {
+		std::atomic<std::uint64_t> head{ 0 };			// Records pushed so far, being the position of the next push
+		std::atomic<std::uint64_t> numberOfPushes{ 0 };
+		std::atomic<std::uint64_t> numberOfDrops{ 0 };
+		std::atomic<std::size_t> maximumSize{ 0 };
+		std::uint64_t cachedTail = 0;					// Last tail seen by the producer (saves reading the line of the consumer)
+	} m_producer;
+
+	// Attributes (consumer)
+	struct alignas(cacheLineSize) ConsumerState {
+		std::atomic<std::uint64_t> tail{ 0 };			// Position of the oldest record; also advanced by the producer when dropping the oldest
+		std::atomic<std::uint64_t> numberOfPops{ 0 };
+		std::atomic<std::uint64_t> numberOfDrops{ 0 };
+		std::uint64_t cachedHead = 0;					// Last head seen by the consumer
+	} m_consumer;
+};
+
+
+// Constructor
+/**
+ * Creates the ring buffer; the memory of the records is allocated once, such that push() and pop() do not allocate
+ *
+ * @param	capacity : number of records the buffer holds (at least one)
+ * @param	overflowPolicy : behavior of push() on a full buffer (see OverflowPolicy)
+ */
+template <typename Record>
+SingleProducerSingleConsumerRingBuffer<Record>::SingleProducerSingleConsumerRingBuffer(std::size_t capacity, OverflowPolicy overflowPolicy)
+	: m_overflowPolicy(overflowPolicy), m_records(std::max<std::size_t>(capacity, 1)) {}
+
+
+// Getters (counters)
+/**
+ * Retrieves the number of records in the buffer
+ *
+ * @return	A (std::size_t) which is the number of records; exact when called by the producer or consumer while the other is idle
+ */
+template <typename Record>
+std::size_t SingleProducerSingleConsumerRingBuffer<Record>::getSize() const {
+	const std::uint64_t tail = m_consumer.tail.load(std::memory_order_acquire);
+	const std::uint64_t head = m_producer.head.load(std::memory_order_acquire);
+	return (head > tail) ? std::size_t(head - tail) : 0;
+}
+
+
+// Producer
+/**
+ * Pushes a record (producer thread only). On a full buffer the overflow policy decides which record is dropped: the
+ * pushed one (DropNewest) or the oldest one (DropOldest, LatestValue). Dropping the oldest record moves the tail with a
+ * compare-and-swap, such that a consumer reading that record at the same time discards its copy and retries.
+ *
+ * @param	record : the record to push
+ * @return	A type (bool) which is false if a record was dropped
+ */
+template <typename Record>
+bool SingleProducerSingleConsumerRingBuffer<Record>::push(const Record& record) {
+	// Initialize variables
+	const std::uint64_t head = m_producer.head.load(std::memory_order_relaxed);
+	const std::uint64_t capacity = m_records.size();
+	bool dropped = false;
+	m_producer.numberOfPushes.fetch_add(1, std::memory_order_relaxed); // Also the dropped ones
+
+	// Full (by the cached tail, then by the current one)
+	if (head - m_producer.cachedTail >= capacity) {
+		m_producer.cachedTail = m_consumer.tail.load(std::memory_order_acquire);
+
+		if (head - m_producer.cachedTail >= capacity) {
+			if (m_overflowPolicy == OverflowPolicy::DropNewest) {
+				m_producer.numberOfDrops.fetch_add(1, std::memory_order_relaxed);
+				return false;
+			}
+
+			// Drop the oldest record, unless the consumer popped it in the meantime
+			std::uint64_t tail = m_producer.cachedTail;
+			if (m_consumer.tail.compare_exchange_strong(tail, tail + 1, std::memory_order_acq_rel, std::memory_order_acquire)) {
+				m_producer.numberOfDrops.fetch_add(1, std::memory_order_relaxed);
+				dropped = true;
+				tail++;
+			}
+			m_producer.cachedTail = tail;
+		}
+	}
+
+	// Write and publish
+	m_records[head % capacity] = record;
+	m_producer.head.store(head + 1, std::memory_order_release);
+
+	// Occupancy
+	const std::size_t size = std::size_t(head + 1 - m_producer.cachedTail);
+	if (size > m_producer.maximumSize.load(std::memory_order_relaxed)) {
+		m_producer.maximumSize.store(size, std::memory_order_relaxed);
+	}
+
+	return !dropped;
+}
+
+
+// Consumer
+/**
+ * Pops the oldest record (consumer thread only); with LatestValue the newest record, the older ones are dropped. The
+ * record is copied before the tail is moved with a compare-and-swap; if the producer dropped the record in the
+ * meantime (and may have overwritten it), the copy is discarded and the next record is tried.
+ *
+ * @param	record : the popped record is written to this record (unchanged if the buffer is empty)
+ * @return	A type (bool) which is true if a record was popped
+ */
+template <typename Record>
+bool SingleProducerSingleConsumerRingBuffer<Record>::pop(Record& record) {
+	// Initialize variables
+	const std::uint64_t capacity = m_records.size();
+	std::uint64_t tail = m_consumer.tail.load(std::memory_order_acquire);
+
+	while (true) {
+		// Empty (by the cached head, then by the current one)
+		if (tail >= m_consumer.cachedHead) {
+			m_consumer.cachedHead = m_producer.head.load(std::memory_order_acquire);
+			if (tail >= m_consumer.cachedHead) {
+				return false;
+			}
+		}
+
+		// Copy, then claim (failure --> dropped by the producer; tail holds the current one)
+		const std::uint64_t position = (m_overflowPolicy == OverflowPolicy::LatestValue) ? m_consumer.cachedHead - 1 : tail;
+		const Record copy = m_records[position % capacity];
+		if (m_consumer.tail.compare_exchange_strong(tail, position + 1, std::memory_order_acq_rel, std::memory_order_acquire)) {
+			record = copy;
+			m_consumer.numberOfPops.fetch_add(1, std::memory_order_relaxed);
+			if (position > tail) {
+				m_consumer.numberOfDrops.fetch_add(position - tail, std::memory_order_relaxed);
+			}
+			return true;
+		}
+	}
+}
+
+
+// [END]: Prevent multiple inclusions of header
+#endif
\ No newline at end of file
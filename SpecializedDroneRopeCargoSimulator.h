@@ -0,0 +1,255 @@
+//==============================================================
+// Filename : SpecializedDroneRopeCargoSimulator.h
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class template to simulate the behavior of a
+//				 drone with or without cargo, with the model and
+//				 the integration method fixed at compile time
+//==============================================================
+
+// [BEGIN]: Prevent multiple inclusions of header
+#ifndef SPECIALIZEDDRONEROPECARGOSIMULATOR_H
+#define SPECIALIZEDDRONEROPECARGOSIMULATOR_H
+
+
+// Libraries
+#include "DroneRopeCargoDynamics.h"
+#include "ExplicitRungeKuttaNumericalIntegration.h"
+#include "GravitationalConstants.h"
+#include "DynamicSystemArrays.h"
+#include "NumericalIntegrationMethods.h"
+#include <array>
+#include <cstddef>
+
+// Models (template argument Dynamics)
+struct DroneModel {
+	static constexpr bool withCargo = false;				// Dynamics type
+	static constexpr std::size_t numberOfStates = 5;		// x1 - x5
+};
+
+struct DroneRopeCargoModel {
+	static constexpr bool withCargo = true;					// Dynamics type
+	static constexpr std::size_t numberOfStates = 9;		// x1 - x9
+};
+
+// Integration methods (template argument Integrator): the explicit Runge-Kutta integrators, see ExplicitRungeKuttaIntegrators
+
+// SpecializedDroneRopeCargoSimulator-class
+template <typename Dynamics, typename Integrator>
+class SpecializedDroneRopeCargoSimulator : public ExplicitRungeKuttaNumericalIntegration, public GravitationalConstants {
+public:
+	// State vector of the model (drone states only without cargo)
+	using State = std::array<double, Dynamics::numberOfStates>;
+
+	// Time step per combination of model and integration method (see DroneRopeCargoSimulator::setImplementation())
+	static constexpr double defaultTimeStep = !Dynamics::withCargo ? 0.01					// Drone - all integration types
+											: Integrator::timeStepWithCargo;				// Drone with cargo
+
+	// Constructor (default)
+	SpecializedDroneRopeCargoSimulator();
+
+
+	// Getters (implementation)
+	static constexpr bool getDynamicsType() { return Dynamics::withCargo; }
+	static constexpr IntegrationType getIntegrationType() { return Integrator::integrationType; }
+
+	// Getters (simulation time)
+	double getSimulationTime() const { return m_simulationTime; }
+
+	// Getters (state vector)
+	StateArray getStateArray() const; // Cargo states zero without cargo
+
+	// Getters (output vector)
+	const OutputArray& getOutputArray() const { return m_outputVector; } // Zero without cargo
+
+
+	// Setters (parameters)
+	void setConstantDroneParameters(double, double);
+	void setConstantRopeParameters(double, double, double);
+	void setConstantCargoParameters(double, double);
+
+	// Setters (simulation time)
+	void setSimulationTime(double);
+
+	// Setters (state vector)
+	void setStateArray(const StateArray&);
+
+
+	// Other
+	void simulationStep(const ControlArray&, StateArray&);
+
+private:
+	// Attributes (parameters)
+	DynamicSystemParameters m_parameters;
+
+	// Attributes (state and output vector)
+	State m_stateVector{};
+	OutputArray m_outputVector{};
+
+	// Attributes (simulation time)
+	double m_simulationTime = 0;
+
+	// Helper functions for simulationStep()
+	static OutputArray calculateOutputArray(const State&);
+};
+
+
+// Constructor
+/**
+ * Creates the simulator with the time step of its combination of model and integration method (defaultTimeStep)
+ * and the gravitational constant of Earth.
+ */
+template <typename Dynamics, typename Integrator>
+SpecializedDroneRopeCargoSimulator<Dynamics, Integrator>::SpecializedDroneRopeCargoSimulator() : NumericalIntegrationProperties(defaultTimeStep)
+{
+	m_parameters.gravitationalConstant = getGravitationalConstant("Earth");
+}
+
+
+// Getters (state vector)
+/**
+ * Retrieves the state vector of drone (+ cargo) in the layout of DroneRopeCargoSimulator
+ *
+ * @return	A (StateArray) representing the state vector; the cargo states (x6 - x9) are zero without cargo
+ */
+template <typename Dynamics, typename Integrator>
+StateArray SpecializedDroneRopeCargoSimulator<Dynamics, Integrator>::getStateArray() const
+{
+	StateArray stateVector{};
+	for (std::size_t i = 0; i < m_stateVector.size(); i++) {
+		stateVector[i] = m_stateVector[i];
+	}
+	return stateVector;
+}
+
+
+// Setters (parameters)
+/**
+ * Sets the parameters of the drone
+ *
+ * @param	massDrone : mass of the drone [kg]
+ * @param	dragConstantDrone : drag constant of the drone [N s^2 / m^2]
+ */
+template <typename Dynamics, typename Integrator>
+void SpecializedDroneRopeCargoSimulator<Dynamics, Integrator>::setConstantDroneParameters(double massDrone, double dragConstantDrone)
+{
+	m_parameters.massDrone = massDrone;
+	m_parameters.dragConstantDrone = dragConstantDrone;
+	m_parameters.inverseMassDrone = 1 / massDrone;
+}
+
+/**
+ * Sets the parameters of the rope (not used without cargo)
+ *
+ * @param	ropeLengthInitial : initial (unstretched) length of the rope [m]
+ * @param	ropeStiffness : stiffness of the rope [N / m]
+ * @param	ropeDamping : damping of the rope [N s / m]
+ */
+template <typename Dynamics, typename Integrator>
+void SpecializedDroneRopeCargoSimulator<Dynamics, Integrator>::setConstantRopeParameters(double ropeLengthInitial, double ropeStiffness, double ropeDamping)
+{
+	m_parameters.ropeLengthInitial = ropeLengthInitial;
+	m_parameters.ropeStiffness = ropeStiffness;
+	m_parameters.ropeDamping = ropeDamping;
+}
+
+/**
+ * Sets the parameters of the cargo (not used without cargo)
+ *
+ * @param	massCargo : mass of the cargo [kg]
+ * @param	dragConstantCargo : drag constant of the cargo [N s^2 / m^2]
+ */
+template <typename Dynamics, typename Integrator>
+void SpecializedDroneRopeCargoSimulator<Dynamics, Integrator>::setConstantCargoParameters(double massCargo, double dragConstantCargo)
+{
+	m_parameters.massCargo = massCargo;
+	m_parameters.dragConstantCargo = dragConstantCargo;
+	m_parameters.inverseMassCargo = 1 / massCargo;
+}
+
+
+// Setters (simulation time)
+template <typename Dynamics, typename Integrator>
+void SpecializedDroneRopeCargoSimulator<Dynamics, Integrator>::setSimulationTime(double simulationTime)
+{
+	m_simulationTime = simulationTime;
+}
+
+
+// Setters (state vector)
+/**
+ * Sets the state vector of drone (+ cargo) and computes the corresponding output vector
+ *
+ * @param	stateVector : the state vector in the layout of DroneRopeCargoSimulator; the cargo states are ignored without cargo
+ */
+template <typename Dynamics, typename Integrator>
+void SpecializedDroneRopeCargoSimulator<Dynamics, Integrator>::setStateArray(const StateArray& stateVector)
+{
+	for (std::size_t i = 0; i < m_stateVector.size(); i++) {
+		m_stateVector[i] = stateVector[i];
+	}
+	m_outputVector = calculateOutputArray(m_stateVector);
+}
+
+
+// Other
+/**
+ * Computes the next state for the given control vector (see DroneRopeCargoSimulator::simulationStep()), saves it to the
+ * object, and writes it to the given array. The model and integration method are template arguments: the derivative
+ * and the Runge-Kutta stages are inlined, and without cargo neither the cargo states nor the rope are computed.
+ *
+ * @param	droneControlVector : the control vector to apply during this step
+ * @param	nextStateVector : array the "next" state vector of drone (+ cargo) is written to
+ */
+template <typename Dynamics, typename Integrator>
+void SpecializedDroneRopeCargoSimulator<Dynamics, Integrator>::simulationStep(const ControlArray& droneControlVector, StateArray& nextStateVector)
+{
+	// Save the to-be-used derivative function
+	auto derivativeFunction = [](const State& stateVector, const ControlArray& controlVector, const OutputArray& outputVector,
+								 const DynamicSystemParameters& parameters, bool, State& dynamicsStateVector) {
+		DroneRopeCargoDynamics::calculateDerivativeStateVectorSpecialized<Dynamics::withCargo>(stateVector, controlVector, outputVector, parameters, dynamicsStateVector);
+	};
+
+	// Integrate (output vector per stage, or constant over the step)
+	if constexpr (Integrator::stageOutput && Dynamics::withCargo) {
+		ExplicitRungeKuttaNumericalIntegration::calculateStep<Integrator::tableau>(derivativeFunction, &calculateOutputArray, m_stateVector, droneControlVector,
+																				  m_parameters, Dynamics::withCargo, m_stateVector);
+	}
+	else {
+		ExplicitRungeKuttaNumericalIntegration::calculateStep<Integrator::tableau>(derivativeFunction, m_stateVector, droneControlVector, m_outputVector,
+																				  m_parameters, Dynamics::withCargo, m_stateVector);
+	}
+
+	// Save output vector and advance simulation time
+	m_outputVector = calculateOutputArray(m_stateVector);
+	m_simulationTime += getTimeStep();
+
+	// Write state vector
+	nextStateVector = getStateArray();
+}
+
+
+// Helper functions for simulationStep()
+/**
+ * Computes the output vector from a state vector (see DroneRopeCargoDynamics::calculateOutputArray())
+ *
+ * @param	stateVector : the state vector of the model
+ * @return	A (OutputArray) with the rope length and rope rate of change; zero without cargo
+ */
+template <typename Dynamics, typename Integrator>
+OutputArray SpecializedDroneRopeCargoSimulator<Dynamics, Integrator>::calculateOutputArray(const State& stateVector)
+{
+	OutputArray outputVector{};
+	if constexpr (Dynamics::withCargo) {
+		DroneRopeCargoDynamics::calculateOutputArray(stateVector, outputVector);
+	}
+	else {
+		static_cast<void>(stateVector);
+	}
+	return outputVector;
+}
+
+
+// [END]: Prevent multiple inclusions of header
+#endif
\ No newline at end of file
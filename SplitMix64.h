@@ -0,0 +1,58 @@
+//==============================================================
+// Filename : SplitMix64.h
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Small random number generator (splitmix64)
+//				 with reproducible streams per index - header
+//==============================================================
+
+// [BEGIN]: Prevent multiple inclusions of header
+#ifndef SPLITMIX64_H
+#define SPLITMIX64_H
+
+
+// Libraries
+#include <cstddef>
+#include <cstdint>
+
+// Random number generator (splitmix64); equal results on every platform, unlike the standard library distributions
+struct SplitMix64 {
+	std::uint64_t state = 0;
+
+	std::uint64_t next();
+	double nextUniform(); // In [0, 1)
+
+	static std::uint64_t calculateStreamSeed(std::uint64_t, std::size_t); // Seed of stream index of a seed
+};
+
+
+// Other
+inline std::uint64_t SplitMix64::next() {
+	std::uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+	return z ^ (z >> 31);
+}
+
+inline double SplitMix64::nextUniform() {
+	return double(next() >> 11) * 0x1.0p-53; // Upper 53 bits
+}
+
+/**
+ * Computes the seed of a stream (e.g. a Monte-Carlo run or a rollout), being output index + 1 of the splitmix64
+ * sequence started at the seed. Streams thus get decorrelated seeds that only depend on the seed and their index,
+ * not on the worker that draws from them.
+ *
+ * @param	seed : seed of all streams
+ * @param	index : index of the stream
+ * @return	A (std::uint64_t) which is the seed of the stream
+ */
+inline std::uint64_t SplitMix64::calculateStreamSeed(std::uint64_t seed, std::size_t index) {
+	SplitMix64 generator{ seed + std::uint64_t(index) * 0x9E3779B97F4A7C15ull };
+	return generator.next();
+}
+
+
+// [END]: Prevent multiple inclusions of header
+#endif
\ No newline at end of file
@@ -0,0 +1,176 @@
+//==============================================================
+// Filename : WorkStealingThreadPool.cpp
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class for a pool of worker threads that execute
+//				 indexed tasks, idle workers stealing tasks from
+//				 the queues of busy workers - source
+//==============================================================
+
+// Libraries
+#include "WorkStealingThreadPool.h"
+#include <algorithm>
+
+
+// Constructor
+/**
+ * Creates the pool and starts its threads. The thread calling parallelFor() works as worker 0, such that one thread
+ * less than the number of workers is started.
+ *
+ * @param	numberOfWorkers : number of workers executing tasks (0 --> number of hardware threads)
+ */
+WorkStealingThreadPool::WorkStealingThreadPool(std::size_t numberOfWorkers)
+	: m_workerQueues(numberOfWorkers > 0 ? numberOfWorkers : std::max<std::size_t>(std::thread::hardware_concurrency(), 1))
+{
+	for (std::size_t worker = 1; worker < m_workerQueues.size(); worker++) {
+		m_threads.emplace_back(&WorkStealingThreadPool::workerLoop, this, worker);
+	}
+}
+
+
+// Destructor
+WorkStealingThreadPool::~WorkStealingThreadPool()
+{
+	// Stop threads
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stop = true;
+	}
+	m_startCondition.notify_all();
+
+	for (std::thread& thread : m_threads) {
+		thread.join();
+	}
+}
+
+
+// Other
+/**
+ * Executes the task function for the task indices 0 to numberOfTasks - 1 and returns when all tasks are done. Every
+ * worker starts with a contiguous range of the tasks; a worker that runs out of tasks steals from the front of the
+ * queues of the other workers, such that unequal task durations do not leave workers idle. The order in which tasks
+ * are executed, and by which worker, is not fixed.
+ *
+ * @param	numberOfTasks : number of tasks to execute
+ * @param	taskFunction : function executed per task, with the task index and the index of the executing worker
+ */
+void WorkStealingThreadPool::parallelFor(std::size_t numberOfTasks, const TaskFunction& taskFunction)
+{
+	if (numberOfTasks == 0) {
+		return;
+	}
+
+	// Distribute tasks over the queues of the workers
+	const std::size_t numberOfWorkers = m_workerQueues.size();
+	for (std::size_t worker = 0; worker < numberOfWorkers; worker++) {
+		std::lock_guard<std::mutex> lock(m_workerQueues[worker].mutex);
+		for (std::size_t task = worker * numberOfTasks / numberOfWorkers; task < (worker + 1) * numberOfTasks / numberOfWorkers; task++) {
+			m_workerQueues[worker].tasks.push_back(task);
+		}
+	}
+
+	// Start threads
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_taskFunction = &taskFunction;
+		m_numberOfBusyThreads = m_threads.size();
+		m_generation++;
+	}
+	m_startCondition.notify_all();
+
+	// Work as worker 0
+	processTasks(0);
+
+	// Wait for the threads
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_finishCondition.wait(lock, [this] { return m_numberOfBusyThreads == 0; });
+	m_taskFunction = nullptr;
+}
+
+
+// Helper functions for parallelFor()
+/**
+ * Loop of a started thread: waits for a parallelFor() and works on its tasks until all queues are empty
+ *
+ * @param	worker : index of the worker
+ */
+void WorkStealingThreadPool::workerLoop(std::size_t worker)
+{
+	std::size_t generation = 0;
+
+	while (true) {
+		// Wait for tasks (or stop)
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_startCondition.wait(lock, [&] { return m_stop || m_generation != generation; });
+			if (m_stop) {
+				return;
+			}
+			generation = m_generation;
+		}
+
+		// Work
+		processTasks(worker);
+
+		// Report done
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (--m_numberOfBusyThreads == 0) {
+			m_finishCondition.notify_one();
+		}
+	}
+}
+
+/**
+ * Executes tasks from the own queue, and stolen from other queues, until no tasks are left
+ *
+ * @param	worker : index of the worker
+ */
+void WorkStealingThreadPool::processTasks(std::size_t worker)
+{
+	std::size_t task = 0;
+	while (popTask(worker, task) || stealTask(worker, task)) {
+		(*m_taskFunction)(task, worker);
+	}
+}
+
+/**
+ * Takes a task from the back of the own queue
+ *
+ * @param	worker : index of the worker
+ * @param	task : the index of the task taken
+ * @return	A (bool) which is false if the own queue is empty
+ */
+bool WorkStealingThreadPool::popTask(std::size_t worker, std::size_t& task)
+{
+	WorkerQueue& queue = m_workerQueues[worker];
+	std::lock_guard<std::mutex> lock(queue.mutex);
+	if (queue.tasks.empty()) {
+		return false;
+	}
+	task = queue.tasks.back();
+	queue.tasks.pop_back();
+	return true;
+}
+
+/**
+ * Takes a task from the front of the queue of another worker, trying the workers after the own index in turn
+ *
+ * @param	worker : index of the worker
+ * @param	task : the index of the task taken
+ * @return	A (bool) which is false if all queues are empty
+ */
+bool WorkStealingThreadPool::stealTask(std::size_t worker, std::size_t& task)
+{
+	const std::size_t numberOfWorkers = m_workerQueues.size();
+	for (std::size_t offset = 1; offset < numberOfWorkers; offset++) {
+		WorkerQueue& queue = m_workerQueues[(worker + offset) % numberOfWorkers];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if (!queue.tasks.empty()) {
+			task = queue.tasks.front();
+			queue.tasks.pop_front();
+			return true;
+		}
+	}
+	return false;
+}
\ No newline at end of file
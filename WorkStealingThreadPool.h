@@ -0,0 +1,78 @@
+//==============================================================
+// Filename : WorkStealingThreadPool.h
+// Authors : Jesper Schrijver, Nick in het Veld
+// Version : v1
+// License : MIT License
+// Description : Class for a pool of worker threads that execute
+//				 indexed tasks, idle workers stealing tasks from
+//				 the queues of busy workers - header
+//==============================================================
+
+// [BEGIN]: Prevent multiple inclusions of header
+#ifndef WORKSTEALINGTHREADPOOL_H
+#define WORKSTEALINGTHREADPOOL_H
+
+
+// Libraries
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// WorkStealingThreadPool-class
+class WorkStealingThreadPool {
+public:
+	// Function executed per task: (task index, worker index)
+	using TaskFunction = std::function<void(std::size_t, std::size_t)>;
+
+	// Constructor (with arguments)
+	WorkStealingThreadPool(std::size_t numberOfWorkers = 0); // 0 --> number of hardware threads
+
+	// Destructor
+	~WorkStealingThreadPool();
+
+	// Not copyable (owns threads)
+	WorkStealingThreadPool(const WorkStealingThreadPool&) = delete;
+	WorkStealingThreadPool& operator=(const WorkStealingThreadPool&) = delete;
+
+
+	// Getters (workers)
+	std::size_t getNumberOfWorkers() const { return m_workerQueues.size(); } // Including the calling thread
+
+
+	// Other
+	void parallelFor(std::size_t, const TaskFunction&);
+
+private:
+	// Queue of task indices of a worker
+	struct WorkerQueue {
+		std::mutex mutex;
+		std::deque<std::size_t> tasks;
+	};
+
+	// Attributes (workers); worker 0 is the thread calling parallelFor()
+	std::vector<WorkerQueue> m_workerQueues;
+	std::vector<std::thread> m_threads;
+
+	// Attributes (synchronization)
+	std::mutex m_mutex;
+	std::condition_variable m_startCondition;
+	std::condition_variable m_finishCondition;
+	const TaskFunction* m_taskFunction = nullptr;
+	std::size_t m_generation = 0;			// Incremented per parallelFor()
+	std::size_t m_numberOfBusyThreads = 0;	// Threads still working on the current parallelFor()
+	bool m_stop = false;
+
+	// Helper functions for parallelFor()
+	void workerLoop(std::size_t);
+	void processTasks(std::size_t);
+	bool popTask(std::size_t, std::size_t&);
+	bool stealTask(std::size_t, std::size_t&);
+};
+
+
+// [END]: Prevent multiple inclusions of header
+#endif
\ No newline at end of file
@@ -0,0 +1,84 @@
+// Libraries
+#include "DroneRopeCargoBatchSimulator.h"
+#include "DroneRopeCargoSimulator.h"
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+// Initial state of system k (hovering drone with swinging cargo, all different)
+StateArray initializeStateVector(std::size_t k)
+{
+	const double phase = 0.01 * k;
+	return { 0.1 * std::sin(phase), 2 + 0.1 * std::cos(phase), 0.2 * std::sin(3 * phase), std::cos(phase), std::sin(2 * phase),
+			 0.3 * std::sin(phase), 0.5 + 0.02 * std::sin(7 * phase), std::sin(phase), std::cos(3 * phase) };
+}
+
+// Main function
+int main()
+{
+	/* ---------------------------------- SETTINGS ---------------------------------- */
+
+	// Number of systems and steps
+	const std::size_t numberOfSystems = 1024;
+	const int numberOfSteps = 200;
+
+	// Specify a control vector
+	const ControlArray controlVector = { 49.05, 0.3 };
+
+	/* ---------------------------------- ACTIONS ---------------------------------- */
+
+	std::cout << "Batch of " << numberOfSystems << " systems, " << numberOfSteps << " steps (" << (DroneRopeCargoBatchSimulator::isVectorized() ? "AVX2" : "scalar") << ")\n";
+
+	for (bool dynamicsType : { false, true }) {
+		for (IntegrationType integrationType : { IntegrationType::Euler, IntegrationType::RungeKuttaFour, IntegrationType::RungeKuttaFourStageOutput }) {
+			// Batch simulator
+			DroneRopeCargoBatchSimulator batchSimulator(numberOfSystems);
+			batchSimulator.setImplementation(dynamicsType, integrationType);
+			for (std::size_t k = 0; k < numberOfSystems; k++) {
+				batchSimulator.setConstantDroneParameters(k, 3, 0.1);
+				batchSimulator.setConstantRopeParameters(k, 1.5, 1000, 50);
+				batchSimulator.setConstantCargoParameters(k, 2, 0.1);
+				batchSimulator.setStateArray(k, initializeStateVector(k));
+				batchSimulator.setControlArray(k, controlVector);
+			}
+
+			auto start = std::chrono::steady_clock::now();
+			for (int step = 0; step < numberOfSteps; step++) { batchSimulator.simulationStep(); }
+			auto end = std::chrono::steady_clock::now();
+			const double timeBatch = std::chrono::duration<double, std::nano>(end - start).count() / (double(numberOfSteps) * numberOfSystems);
+
+			// Scalar simulator, one system after the other
+			std::vector<DroneRopeCargoSimulator> simulators(numberOfSystems);
+			for (std::size_t k = 0; k < numberOfSystems; k++) {
+				simulators[k].setConstantDroneParameters(3, 0.1);
+				simulators[k].setConstantRopeParameters(1.5, 1000, 50);
+				simulators[k].setConstantCargoParameters(2, 0.1);
+				simulators[k].setImplementation(dynamicsType, integrationType);
+				simulators[k].setStateArray(initializeStateVector(k));
+				simulators[k].setOutputVector();
+			}
+
+			StateArray stateVector{};
+			start = std::chrono::steady_clock::now();
+			for (int step = 0; step < numberOfSteps; step++) {
+				for (DroneRopeCargoSimulator& simulator : simulators) { simulator.simulationStep(controlVector, stateVector); }
+			}
+			end = std::chrono::steady_clock::now();
+			const double timeScalar = std::chrono::duration<double, std::nano>(end - start).count() / (double(numberOfSteps) * numberOfSystems);
+
+			// Checksum (keeps results alive)
+			double checksum = 0;
+			for (std::size_t k = 0; k < numberOfSystems; k++) { checksum += batchSimulator.getStateArray(k)[1] - simulators[k].getStateArray()[1]; }
+
+			// Report
+			std::cout << (dynamicsType ? "drone + cargo" : "drone") << ", integration type " << static_cast<int>(integrationType) << ":\n"
+					  << "  DroneRopeCargoBatchSimulator : " << timeBatch << " ns per system per step\n"
+					  << "  DroneRopeCargoSimulator      : " << timeScalar << " ns per system per step\n"
+					  << "  speedup                      : " << timeScalar / timeBatch << "x (checksum " << checksum << ")\n";
+		}
+	}
+
+	// Exit program
+	return 0;
+}
\ No newline at end of file
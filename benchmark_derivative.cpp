@@ -0,0 +1,89 @@
+// Libraries
+#include "DroneRopeCargoDynamics.h"
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+// Times a derivative function over a set of states, returns the time per evaluation in [ns]
+template <typename Function>
+double benchmarkDerivative(Function&& function, const std::vector<StateArray>& stateVectors, const std::vector<OutputArray>& outputVectors,
+						   const ControlArray& controlVector, const DynamicSystemParameters& parameterList, bool dynamicsType, int repetitions, double& checksum)
+{
+	StateArray dynamicsStateVector{};
+
+	auto start = std::chrono::steady_clock::now();
+	for (int repetition = 0; repetition < repetitions; repetition++) {
+		for (std::size_t k = 0; k < stateVectors.size(); k++) {
+			function(stateVectors[k], controlVector, outputVectors[k], parameterList, dynamicsType, dynamicsStateVector);
+			checksum += dynamicsStateVector[3] + dynamicsStateVector[8]; // Keep result alive
+		}
+	}
+	auto end = std::chrono::steady_clock::now();
+
+	return std::chrono::duration<double, std::nano>(end - start).count() / (double(repetitions) * stateVectors.size());
+}
+
+// Main function
+int main()
+{
+	/* ---------------------------------- PARAMETERS ---------------------------------- */
+
+	// Initialize parameter block (see DynamicSystemArrays.h)
+	const DynamicSystemParameters parameterList = ParameterArray{ 9.81, 3, 0.1, 1.5, 50, 40000, 2, 0.1 };
+
+	// Specify a control vector
+	const ControlArray controlVector = { 49.05, 0.3 };
+
+	// Number of states and repetitions
+	const int numberOfStates = 1024;
+	const int repetitions = 2000;
+
+	/* ---------------------------------- STATES ---------------------------------- */
+
+	// Spread states around a hovering drone with cargo (taut and slack rope)
+	std::vector<StateArray> stateVectors(numberOfStates);
+	std::vector<OutputArray> outputVectors(numberOfStates);
+
+	for (int k = 0; k < numberOfStates; k++) {
+		const double phase = 0.01 * k;
+		stateVectors[k] = { 0.1 * sin(phase), 2 + 0.1 * cos(phase), 0.2 * sin(3 * phase), cos(phase), sin(2 * phase),
+							0.3 * sin(phase), 0.5 + 0.02 * sin(7 * phase), sin(phase), cos(3 * phase) };
+		DroneRopeCargoDynamics::calculateOutputArray(stateVectors[k], outputVectors[k]);
+	}
+
+	/* ---------------------------------- ACTIONS ---------------------------------- */
+
+	for (bool dynamicsType : { false, true }) {
+		// Check that both functions give identical results (bitwise; with FMA contraction enabled the last bits may differ)
+		int mismatches = 0;
+		for (int k = 0; k < numberOfStates; k++) {
+			StateArray dynamicsStateVector{}, dynamicsStateVectorFused{};
+			DroneRopeCargoDynamics::calculateDerivativeStateVector(stateVectors[k], controlVector, outputVectors[k], parameterList, dynamicsType, dynamicsStateVector);
+			DroneRopeCargoDynamics::calculateDerivativeStateVectorFused(stateVectors[k], controlVector, outputVectors[k], parameterList, dynamicsType, dynamicsStateVectorFused);
+			mismatches += (dynamicsStateVector != dynamicsStateVectorFused);
+		}
+
+		// Time both functions
+		auto referenceFunction = [](const StateArray& x, const ControlArray& u, const OutputArray& y, const DynamicSystemParameters& P, bool n, StateArray& xDot) {
+			DroneRopeCargoDynamics::calculateDerivativeStateVector(x, u, y, P, n, xDot);
+		};
+		auto fusedFunction = [](const StateArray& x, const ControlArray& u, const OutputArray& y, const DynamicSystemParameters& P, bool n, StateArray& xDot) {
+			DroneRopeCargoDynamics::calculateDerivativeStateVectorFused(x, u, y, P, n, xDot);
+		};
+
+		double checksum = 0;
+		const double timeReference = benchmarkDerivative(referenceFunction, stateVectors, outputVectors, controlVector, parameterList, dynamicsType, repetitions, checksum);
+		const double timeFused = benchmarkDerivative(fusedFunction, stateVectors, outputVectors, controlVector, parameterList, dynamicsType, repetitions, checksum);
+
+		// Report
+		std::cout << (dynamicsType ? "drone + cargo" : "drone") << ":\n"
+				  << "  calculateDerivativeStateVector      : " << timeReference << " ns\n"
+				  << "  calculateDerivativeStateVectorFused : " << timeFused << " ns\n"
+				  << "  speedup                             : " << timeReference / timeFused << "x\n"
+				  << "  mismatching states                  : " << mismatches << " (checksum " << checksum << ")\n";
+	}
+
+	// Exit program
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,81 @@
+// Libraries
+#include "RealTimeLoop.h"
+#include "DroneRopeCargoClosedLoop.h"
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <sched.h>
+
+// Steps the simulator in a real-time loop for a duration, optionally next to threads that keep every CPU busy
+void benchmarkRealTimeLoop(const std::string& name, const RealTimeSettings& settings, double duration, bool withLoad)
+{
+	// Initialize variables
+	DroneRopeCargoClosedLoop closedLoop;
+	DroneRopeCargoSimulator simulator = closedLoop.getSimulator();
+	const ControlArray controlVector = { 0, 0 };
+	StateArray stateVector = simulator.getStateArray();
+	const long numberOfSteps = std::lround(duration / settings.period);
+
+	// Load
+	std::atomic<bool> loaded{ withLoad };
+	std::vector<std::thread> loadThreads;
+	for (unsigned thread = 0; withLoad && thread < std::max(1u, std::thread::hardware_concurrency()); thread++) {
+		loadThreads.emplace_back([&loaded]() {
+			volatile double sink = 0;
+			while (loaded.load(std::memory_order_relaxed)) {
+				sink = sink + 1;
+			}
+		});
+	}
+
+	// Real-time loop
+	RealTimeLoop loop;
+	loop.setSettings(settings);
+	long step = 0;
+	loop.start([&]() {
+		simulator.simulationStep(controlVector, stateVector);
+		return ++step < numberOfSteps;
+	});
+	loop.wait();
+
+	loaded.store(false);
+	for (std::thread& thread : loadThreads) {
+		thread.join();
+	}
+
+	std::cout << name << (withLoad ? " (all CPUs loaded)" : "") << ": " << loop.formatReport();
+}
+
+// Main function
+int main()
+{
+	/* ---------------------------------- SETTINGS ---------------------------------- */
+
+	const double period = 0.001;	// in [s]; the fastest cadence of the simulator node
+	const double duration = 3;		// in [s] per run
+	const int priority = 80;		// SCHED_FIFO
+
+	/* ---------------------------------- ACTIONS ---------------------------------- */
+
+	std::cout << std::thread::hardware_concurrency() << " hardware threads\n";
+
+	// Default scheduling
+	RealTimeSettings settings;
+	settings.period = period;
+	benchmarkRealTimeLoop("Default scheduling", settings, duration, false);
+	benchmarkRealTimeLoop("Default scheduling", settings, duration, true);
+
+	// Pinned, SCHED_FIFO and locked memory (where permitted)
+	settings.cpu = sched_getcpu();
+	settings.priority = priority;
+	settings.lockMemory = true;
+	benchmarkRealTimeLoop("Real-time settings", settings, duration, false);
+	benchmarkRealTimeLoop("Real-time settings", settings, duration, true);
+
+	// Exit program
+	return 0;
+}
\ No newline at end of file
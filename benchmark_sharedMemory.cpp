@@ -0,0 +1,128 @@
+// Libraries
+#include "SharedMemorySimulatorAdapter.h"
+#include "SharedMemoryControllerAdapter.h"
+#include "DroneRopeCargoClosedLoop.h"
+#include "HistogramQuantileSketch.h"
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// Round trips of a state record to a controller process and back (echo), timed in the simulator process [us]
+HistogramQuantileSketch benchmarkRoundTrip(const std::string& segmentName, unsigned spinCount, int numberOfRoundTrips, double& totalTime)
+{
+	SharedMemoryTransport transport;
+	transport.create(segmentName);
+
+	const pid_t child = fork();
+	if (child == 0) {
+		// Echo process
+		SharedMemoryTransport echoTransport;
+		echoTransport.open(segmentName, 5);
+		StateRecord record;
+		std::uint32_t sequence = 0;
+		while (echoTransport.getStateChannel().waitForNew(sequence, record, 5, spinCount)) {
+			echoTransport.getControlChannel().publish({ record.xdrone, 0 });
+		}
+		_exit(0);
+	}
+
+	HistogramQuantileSketch roundTripTimes(0, 1000, 10000); // 0.1 us bins up to 1 ms
+	ControlRecord reply;
+	std::uint32_t sequence = 0;
+	const auto start = std::chrono::steady_clock::now();
+	for (int roundTrip = 0; roundTrip < numberOfRoundTrips; roundTrip++) {
+		const auto sent = std::chrono::steady_clock::now();
+		transport.getStateChannel().publish({ double(roundTrip) });
+		if (!transport.getControlChannel().waitForNew(sequence, reply, 5, spinCount)) {
+			break;
+		}
+		roundTripTimes.add(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - sent).count());
+	}
+	totalTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	transport.closeChannels();
+	waitpid(child, nullptr, 0);
+	return roundTripTimes;
+}
+
+// Main function
+int main()
+{
+	/* ---------------------------------- SETTINGS ---------------------------------- */
+
+	const std::string segmentName = "benchmark_sharedMemory_" + std::to_string(getpid());
+	const int numberOfRoundTrips = 100000;
+	const unsigned spinCounts[] = { 0, 20000 };		// Sleep at once (futex), spin first (skipped on one core: the spinning process holds the core)
+	const double duration = 60;						// Closed loop, in [s] of simulation time
+
+	/* ---------------------------------- ACTIONS ---------------------------------- */
+
+	const bool multipleCores = (std::thread::hardware_concurrency() > 1);
+	std::cout << std::thread::hardware_concurrency() << " hardware threads\n";
+
+	// 1. Latency and throughput of the transport (echo of a state record as a control record)
+	for (unsigned spinCount : spinCounts) {
+		if ((spinCount > 0) && !multipleCores) {
+			continue;
+		}
+		double totalTime = 0;
+		const HistogramQuantileSketch roundTripTimes = benchmarkRoundTrip(segmentName, spinCount, numberOfRoundTrips, totalTime);
+
+		std::cout << "Round trip (spin count " << spinCount << "): median " << roundTripTimes.getQuantile(0.5) << " us, 99% " << roundTripTimes.getQuantile(0.99)
+				  << " us, 99.9% " << roundTripTimes.getQuantile(0.999) << " us (" << roundTripTimes.getOverflowCount() << " above 1 ms), "
+				  << roundTripTimes.getCount() / totalTime << " round trips per s\n";
+	}
+
+	// 2. Closed loop of the simulator and the controller in two processes, compared to one process
+	DroneRopeCargoClosedLoop closedLoop;
+	DroneRopeCargoSimulator simulator = closedLoop.getSimulator();
+	const DynamicSystemParameters parameters = simulator.getParameters();
+	const long numberOfSteps = std::lround(duration / simulator.getTimeStep());
+
+	auto start = std::chrono::steady_clock::now();
+	closedLoop.run({ { duration, { 1.0, 0 } } });
+	const double directTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	for (unsigned spinCount : spinCounts) {
+		if ((spinCount > 0) && !multipleCores) {
+			continue;
+		}
+		DroneRopeCargoSimulator loopSimulator = simulator;
+		SharedMemoryTransport transport;
+		transport.create(segmentName);
+
+		const pid_t child = fork();
+		if (child == 0) {
+			// Controller process
+			SharedMemoryTransport controllerTransport;
+			controllerTransport.open(segmentName, 5);
+			DroneControllerControlVector controller(0.2, 0.2, 0.1, 50);
+			controller.setVelocityVector({ 1.0, 0 });
+			SharedMemoryControllerAdapter controllerAdapter(controller, controllerTransport);
+			controllerAdapter.setModel(simulator.getDynamicsType(), parameters.gravitationalConstant, parameters.massDrone, parameters.massCargo);
+			controllerAdapter.setSpinCount(spinCount);
+			while (controllerAdapter.step(5)) {}
+			_exit(0);
+		}
+
+		// Simulator process
+		SharedMemorySimulatorAdapter simulatorAdapter(loopSimulator, transport);
+		simulatorAdapter.setSpinCount(spinCount);
+		start = std::chrono::steady_clock::now();
+		simulatorAdapter.publishState();
+		for (long step = 0; step < numberOfSteps && simulatorAdapter.step(5); step++) {}
+		const double loopTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		transport.closeChannels();
+		waitpid(child, nullptr, 0);
+
+		std::cout << "Closed loop in two processes (spin count " << spinCount << "): " << simulatorAdapter.getNumberOfSteps() / loopTime << " steps per s, "
+				  << loopTime / simulatorAdapter.getNumberOfSteps() * 1e6 << " us per step (one process: " << directTime / numberOfSteps * 1e6 << " us per step)\n";
+	}
+
+	// Exit program
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,138 @@
+// Libraries
+#include "AdamsBashforthMoultonNumericalIntegration.h"
+#include "DroneRopeCargoSimulator.h"
+#include "RungeKuttaFourNumericalIntegration.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+// Sets the parameters of a swinging cargo on a taut rope (no drag, such that the dynamics are smooth), returns the parameter block
+DynamicSystemParameters initializeParameters(DroneRopeCargoSimulator& simulator)
+{
+	simulator.setConstantDroneParameters(3, 0);			// in [kg], [N s^2 / m^2]
+	simulator.setConstantRopeParameters(1.5, 1000, 5);	// in [m], [N / m], [N s / m]
+	simulator.setConstantCargoParameters(2, 0);			// in [kg], [N s^2 / m^2]
+	return simulator.getParameters();
+}
+
+// Maximum absolute difference between two state vectors
+double calculateError(const StateArray& stateVector, const StateArray& referenceStateVector)
+{
+	double error = 0;
+	for (std::size_t i = 0; i < stateVector.size(); i++) { error = std::max(error, std::fabs(stateVector[i] - referenceStateVector[i])); }
+	return error;
+}
+
+// Main function
+int main()
+{
+	/* ---------------------------------- SETTINGS ---------------------------------- */
+
+	DroneRopeCargoSimulator referenceSimulator;
+	const DynamicSystemParameters parameters = initializeParameters(referenceSimulator);
+	const ControlArray controlVector = { 49.05, 0.1 };				// Hover thrust
+	const StateArray initialStateVector = { 0, 0, 0, 0, 0, 0.3, -1.5, 1.0, 0 };	// Hanging cargo, swinging sideways
+	const double interval = 1;										// in [s]
+	const std::vector<double> timeSteps = { 0.01, 0.005, 0.0025 };	// in [s]
+
+	/* ---------------------------------- ACTIONS ---------------------------------- */
+
+	// Derivative function counting its evaluations, output function
+	int evaluations = 0;
+	auto derivativeFunction = [&evaluations](const StateArray& stateVector, const ControlArray& control, const OutputArray& outputVector,
+											 const DynamicSystemParameters& parameterList, bool dynamicsType, StateArray& dynamicsStateVector) {
+		evaluations++;
+		DroneRopeCargoDynamics::calculateDerivativeStateVector(stateVector, control, outputVector, parameterList, dynamicsType, dynamicsStateVector);
+	};
+	auto outputFunction = [](const StateArray& stateVector) {
+		OutputArray outputVector{};
+		DroneRopeCargoDynamics::calculateOutputArray(stateVector, outputVector);
+		return outputVector;
+	};
+
+	// Reference solution (Dormand-Prince, tight tolerances)
+	referenceSimulator.setImplementation(true, IntegrationType::RungeKuttaFour);
+	referenceSimulator.setStateArray(initialStateVector);
+	referenceSimulator.setOutputVector();
+	referenceSimulator.setTolerances(1e-12, 1e-12);
+	StateArray referenceStateVector{};
+	referenceSimulator.simulateInterval(controlVector, interval, referenceStateVector);
+
+	// 1. Accuracy per derivative evaluation: ABM (two evaluations per step, three RK4 steps to start) at half the time step of RK4
+	int mismatches = 0;
+	double previousError = 0;
+	for (double timeStep : timeSteps) {
+		const long numberOfSteps = std::lround(interval / timeStep);
+
+		// Adams-Bashforth-Moulton at h / 2
+		AdamsBashforthMoultonNumericalIntegration integrator(timeStep / 2);
+		StateArray stateVector = initialStateVector;
+		evaluations = 0;
+		for (long step = 0; step < 2 * numberOfSteps; step++) {
+			integrator.calculateStep(derivativeFunction, outputFunction, stateVector, controlVector, parameters, true, stateVector);
+		}
+		const int evaluationsMultistep = evaluations;
+		const double error = calculateError(stateVector, referenceStateVector);
+
+		// RK4 at h
+		RungeKuttaFourNumericalIntegration explicitIntegrator;
+		explicitIntegrator.setTimeStep(timeStep);
+		StateArray explicitStateVector = initialStateVector;
+		evaluations = 0;
+		for (long step = 0; step < numberOfSteps; step++) {
+			explicitIntegrator.calculateStep(derivativeFunction, outputFunction, explicitStateVector, controlVector, parameters, true, explicitStateVector);
+		}
+		const int evaluationsExplicit = evaluations;
+		const double explicitError = calculateError(explicitStateVector, referenceStateVector);
+
+		// Evaluations: 2 per step + 7 (start-up); about as many as RK4 at twice the time step, at a smaller error; fourth order (halving h --> error / 16)
+		const bool passed = (evaluationsMultistep == 2 * (2 * numberOfSteps) + 7) && (evaluationsMultistep <= evaluationsExplicit + 7) && (error < explicitError)
+							&& ((previousError == 0) || (error < previousError / 10)) && (integrator.getNumberOfRestarts() == 0);
+		mismatches += !passed;
+		previousError = error;
+
+		std::cout << "h = " << timeStep << " s: ABM (h / 2) " << evaluationsMultistep << " evaluations, error " << error << "; RK4 " << evaluationsExplicit
+				  << " evaluations, error " << explicitError << (passed ? "" : " (NOT AS EXPECTED)") << "\n";
+	}
+
+	// 2. Restarts: control jump, time step change, state overwrite; none for a constant control or a change within the tolerance
+	AdamsBashforthMoultonNumericalIntegration integrator(0.005);
+	integrator.setRestartTolerance(0.5);
+	StateArray stateVector = initialStateVector;
+	auto takeSteps = [&](int numberOfSteps, const ControlArray& control) {
+		for (int step = 0; step < numberOfSteps; step++) { integrator.calculateStep(derivativeFunction, outputFunction, stateVector, control, parameters, true, stateVector); }
+	};
+
+	takeSteps(10, controlVector);
+	const bool constantPassed = (integrator.getNumberOfRestarts() == 0) && (integrator.getHistoryLength() == 4);
+
+	takeSteps(10, { controlVector[0] + 0.4, controlVector[1] });
+	const bool withinTolerancePassed = (integrator.getNumberOfRestarts() == 0);
+
+	takeSteps(1, { controlVector[0] + 5, controlVector[1] });
+	const bool controlJumpPassed = (integrator.getNumberOfRestarts() == 1) && (integrator.getHistoryLength() == 1);
+
+	takeSteps(10, { controlVector[0] + 5, controlVector[1] });
+	integrator.setTimeStep(0.0025);
+	takeSteps(1, { controlVector[0] + 5, controlVector[1] });
+	const bool timeStepPassed = (integrator.getNumberOfRestarts() == 2) && (integrator.getHistoryLength() == 1);
+
+	takeSteps(10, { controlVector[0] + 5, controlVector[1] });
+	stateVector[0] += 0.01;
+	takeSteps(1, { controlVector[0] + 5, controlVector[1] });
+	const bool stateOverwritePassed = (integrator.getNumberOfRestarts() == 3) && (integrator.getHistoryLength() == 1);
+
+	takeSteps(10, { controlVector[0] + 5, controlVector[1] });
+	const bool continuedPassed = (integrator.getNumberOfRestarts() == 3) && (integrator.getHistoryLength() == 4);
+
+	std::cout << "Restarts: constant " << constantPassed << ", within tolerance " << withinTolerancePassed << ", control jump " << controlJumpPassed << ", time step "
+			  << timeStepPassed << ", state overwrite " << stateOverwritePassed << ", continued " << continuedPassed << "\n";
+
+	// Report
+	const bool passed = (mismatches == 0) && constantPassed && withinTolerancePassed && controlJumpPassed && timeStepPassed && stateOverwritePassed && continuedPassed;
+	std::cout << (passed ? "PASSED" : "FAILED") << "\n";
+
+	// Exit program
+	return passed ? 0 : 1;
+}
\ No newline at end of file
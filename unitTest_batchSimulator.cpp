@@ -0,0 +1,111 @@
+// Libraries
+#include "DroneRopeCargoBatchSimulator.h"
+#include "DroneRopeCargoSimulator.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+// Parameters, state and control of system k of the batch (all different)
+struct SystemSettings {
+	double massDrone, dragConstantDrone;
+	double ropeLengthInitial, ropeStiffness, ropeDamping;
+	double massCargo, dragConstantCargo;
+	StateArray stateVector;
+	ControlArray controlVector;
+};
+
+SystemSettings initializeSystem(std::size_t k)
+{
+	const double phase = 0.7 * k;
+	SystemSettings settings{};
+	settings.massDrone = 3 + 0.1 * k;
+	settings.dragConstantDrone = 0.1 + 0.01 * k;
+	settings.ropeLengthInitial = 1.5;
+	settings.ropeStiffness = 1000 + 200 * k;		// Soft, such that RK4 (output vector held over the step) is stable at h = 0.01 s
+	settings.ropeDamping = 50;
+	settings.massCargo = 2 + 0.05 * k;
+	settings.dragConstantCargo = 0.1;
+	settings.stateVector = { 0.1 * std::sin(phase), 0.1 * std::cos(phase), 0.05 * std::sin(2 * phase), 0.2 * std::cos(phase), 0.1 * std::sin(3 * phase),
+							 0.3 * std::sin(phase), -1.45 - 0.04 * std::cos(phase), 0.5 * std::cos(2 * phase), 0.1 * std::sin(phase) };
+	settings.controlVector = { 49.05 + 2 * std::sin(phase), 0.2 * std::cos(phase) };
+	return settings;
+}
+
+// Largest relative difference between two state vectors; infinite if a state is not finite
+double calculateRelativeError(const StateArray& stateVector, const StateArray& referenceStateVector)
+{
+	double error = 0;
+	for (std::size_t i = 0; i < stateVector.size(); i++) {
+		if (!std::isfinite(stateVector[i])) { return INFINITY; }
+		error = std::max(error, std::fabs(stateVector[i] - referenceStateVector[i]) / std::max(1.0, std::fabs(referenceStateVector[i])));
+	}
+	return error;
+}
+
+// Main function
+int main()
+{
+	/* ---------------------------------- SETTINGS ---------------------------------- */
+
+	const std::size_t numberOfSystems = 7;		// Not a multiple of the vector width (padding lanes)
+	const int numberOfSteps = 200;
+	const double tolerance = 1e-10;				// AVX2: relative, after all steps (vectorized sine/cosine, FMA)
+	const std::vector<IntegrationType> integrationTypes = { IntegrationType::Euler, IntegrationType::RungeKuttaFour, IntegrationType::RungeKuttaFourStageOutput };
+
+	/* ---------------------------------- ACTIONS ---------------------------------- */
+
+	// Every lane against the scalar simulator: bit for bit for the scalar fallback, within the tolerance with AVX2
+	const bool vectorized = DroneRopeCargoBatchSimulator::isVectorized();
+	int mismatches = 0;
+	for (bool dynamicsType : { false, true }) {
+		for (IntegrationType integrationType : integrationTypes) {
+			// Batch
+			DroneRopeCargoBatchSimulator batchSimulator(numberOfSystems);
+			batchSimulator.setImplementation(dynamicsType, integrationType);
+			for (std::size_t k = 0; k < numberOfSystems; k++) {
+				const SystemSettings settings = initializeSystem(k);
+				batchSimulator.setConstantDroneParameters(k, settings.massDrone, settings.dragConstantDrone);
+				batchSimulator.setConstantRopeParameters(k, settings.ropeLengthInitial, settings.ropeStiffness, settings.ropeDamping);
+				batchSimulator.setConstantCargoParameters(k, settings.massCargo, settings.dragConstantCargo);
+				batchSimulator.setStateArray(k, settings.stateVector);
+				batchSimulator.setControlArray(k, settings.controlVector);
+			}
+			for (int step = 0; step < numberOfSteps; step++) { batchSimulator.simulationStep(); }
+
+			// Scalar simulator, per system
+			double largestError = 0;
+			for (std::size_t k = 0; k < numberOfSystems; k++) {
+				const SystemSettings settings = initializeSystem(k);
+				DroneRopeCargoSimulator simulator;
+				simulator.setConstantDroneParameters(settings.massDrone, settings.dragConstantDrone);
+				simulator.setConstantRopeParameters(settings.ropeLengthInitial, settings.ropeStiffness, settings.ropeDamping);
+				simulator.setConstantCargoParameters(settings.massCargo, settings.dragConstantCargo);
+				simulator.setImplementation(dynamicsType, integrationType);
+				simulator.setStateArray(settings.stateVector);
+				simulator.setOutputVector();
+
+				StateArray stateVector{};
+				for (int step = 0; step < numberOfSteps; step++) { simulator.simulationStep(settings.controlVector, stateVector); }
+
+				// Without cargo only the drone states are integrated (cargo states of the scalar simulator are not compared)
+				StateArray batchStateVector = batchSimulator.getStateArray(k);
+				if (!dynamicsType) { std::copy(stateVector.begin() + 5, stateVector.end(), batchStateVector.begin() + 5); }
+
+				const double error = calculateRelativeError(batchStateVector, stateVector);
+				largestError = std::max(largestError, error);
+				mismatches += vectorized ? !(error < tolerance) : (batchStateVector != stateVector);
+			}
+
+			std::cout << (dynamicsType ? "drone + cargo" : "drone") << ", integration type " << static_cast<int>(integrationType) << ": largest relative difference "
+					  << largestError << "\n";
+		}
+	}
+
+	// Report
+	const bool passed = (mismatches == 0);
+	std::cout << (vectorized ? "AVX2" : "scalar") << ": " << mismatches << " mismatching systems\n" << (passed ? "PASSED" : "FAILED") << "\n";
+
+	// Exit program
+	return passed ? 0 : 1;
+}
\ No newline at end of file
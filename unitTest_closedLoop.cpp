@@ -0,0 +1,108 @@
+// Libraries
+#include "DroneRopeCargoClosedLoop.h"
+#include <chrono>
+#include <cmath>
+#include <deque>
+#include <iostream>
+
+// Runs the closed loop step by step with the simulator and controller of a separate object (reference for direct mode)
+StateArray runReference(DroneRopeCargoClosedLoop& closedLoop, const std::vector<VelocityScheduleEntry>& velocitySchedule, std::size_t controllerPeriod, std::size_t controlDelay)
+{
+	DroneRopeCargoSimulator& simulator = closedLoop.getSimulator();
+	DroneControllerControlVector& controller = closedLoop.getController();
+	const DynamicSystemParameters& parameters = simulator.getParameters();
+
+	StateArray stateVector = simulator.getStateArray();
+	std::deque<ControlArray> computedControlVectors; // Control vector per tick, computed or held
+	std::size_t stepIndex = 0;
+
+	for (const VelocityScheduleEntry& entry : velocitySchedule) {
+		controller.setVelocityVector({ entry.velocityVector[0], entry.velocityVector[1] });
+		for (long step = 0; step < std::lround(entry.duration / simulator.getTimeStep()); step++) {
+			if (stepIndex % controllerPeriod == 0) {
+				const std::vector<double> controlVector = controller.calculateReferenceControlVector(true, parameters.gravitationalConstant,
+																									 parameters.massDrone, stateVector[0], stateVector[3], stateVector[1], stateVector[4], stateVector[2],
+																									 parameters.massCargo, stateVector[5], stateVector[6]);
+				computedControlVectors.push_back({ controlVector[0], controlVector[1] });
+			}
+			else {
+				computedControlVectors.push_back(computedControlVectors.back());
+			}
+
+			const ControlArray appliedControlVector = (stepIndex >= controlDelay) ? computedControlVectors[stepIndex - controlDelay] : ControlArray{};
+			simulator.simulationStep(appliedControlVector, stateVector);
+			stepIndex++;
+		}
+	}
+
+	return stateVector;
+}
+
+// Main function
+int main()
+{
+	/* ---------------------------------- SETTINGS ---------------------------------- */
+
+	const std::vector<VelocityScheduleEntry> velocitySchedule = { { 2.0, { 1.0, 0.5 } }, { 4.0, { 0, 0 } } }; // Fly, then stop
+	const int numberOfTimedRuns = 200;
+
+	/* ---------------------------------- ACTIONS ---------------------------------- */
+
+	// 1. Direct mode equals stepping simulator and controller by hand, for several controller periods and delays
+	int mismatches = 0;
+	for (std::size_t controllerPeriod : { 1, 4 }) {
+		for (std::size_t controlDelay : { 0, 3 }) {
+			DroneRopeCargoClosedLoop closedLoop, referenceClosedLoop;
+			closedLoop.setSettings({ ClosedLoopMode::Direct, controllerPeriod, controlDelay });
+
+			const StateArray stateVector = closedLoop.run(velocitySchedule);
+			const StateArray referenceStateVector = runReference(referenceClosedLoop, velocitySchedule, controllerPeriod, controlDelay);
+			mismatches += (stateVector != referenceStateVector);
+
+			std::cout << "Direct, controller period " << controllerPeriod << ", control delay " << controlDelay << ": xDrone " << stateVector[0]
+					  << " m, xDotDrone " << stateVector[3] << " m/s" << ((stateVector != referenceStateVector) ? " (MISMATCH)" : "") << "\n";
+		}
+	}
+
+	// 2. Pipeline mode: the latency of the buffer nodes delays the response, but the loop still tracks the reference
+	DroneRopeCargoClosedLoop directClosedLoop, pipelineClosedLoop;
+	pipelineClosedLoop.setSettings({ ClosedLoopMode::Pipeline });
+
+	std::vector<TrajectorySample> directSamples(10), pipelineSamples(10);
+	TrajectoryBuffer directBuffer{ directSamples.data(), directSamples.size(), 20 }, pipelineBuffer{ pipelineSamples.data(), pipelineSamples.size(), 20 };
+	const StateArray directStateVector = directClosedLoop.run({ velocitySchedule[0] }, directBuffer);
+	const StateArray pipelineStateVector = pipelineClosedLoop.run({ velocitySchedule[0] }, pipelineBuffer);
+
+	const bool pipelinePassed = (std::abs(directStateVector[3] - 1.0) < 0.05) && (std::abs(pipelineStateVector[3] - 1.0) < 0.05)
+								&& (pipelineSamples[0].stateVector[0] < directSamples[0].stateVector[0]) && (pipelineBuffer.numberOfSamples == 10);
+
+	std::cout << "After 0.2 s: xDrone " << directSamples[0].stateVector[0] << " m (direct), " << pipelineSamples[0].stateVector[0] << " m (pipeline)\n";
+	std::cout << "After 2 s: xDotDrone " << directStateVector[3] << " m/s (direct), " << pipelineStateVector[3] << " m/s (pipeline)\n";
+
+	// 3. Pacing to the wall clock
+	DroneRopeCargoClosedLoop pacedClosedLoop;
+	pacedClosedLoop.setSettings({ ClosedLoopMode::Pipeline, 1, 0, 10, 1.0 });
+	auto start = std::chrono::steady_clock::now();
+	pacedClosedLoop.run({ { 0.2, { 0, 0 } } });
+	const double pacedTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	const bool pacingPassed = (pacedTime >= 0.2);
+
+	std::cout << "0.2 s in real time took " << pacedTime << " s\n";
+
+	// 4. Runs per second as fast as possible
+	start = std::chrono::steady_clock::now();
+	for (int run = 0; run < numberOfTimedRuns; run++) {
+		DroneRopeCargoClosedLoop timedClosedLoop;
+		timedClosedLoop.run(velocitySchedule);
+	}
+	const double timedTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	std::cout << "Runs of " << velocitySchedule[0].duration + velocitySchedule[1].duration << " s: " << numberOfTimedRuns / timedTime << " per second\n";
+
+	// Report
+	const bool passed = (mismatches == 0) && pipelinePassed && pacingPassed;
+	std::cout << (passed ? "PASSED" : "FAILED") << "\n";
+
+	// Exit program
+	return passed ? 0 : 1;
+}
\ No newline at end of file
@@ -1,5 +1,41 @@
 // Libraries
 #include "DroneControllerControlVector.h"
+#include "DroneRopeCargoSimulator.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+// Flies a swinging cargo with the controller (reference velocity zero), returns the largest horizontal offset of the cargo during the last second
+double calculateSwing(double oscillationDampingConstant)
+{
+	// Initialize simulator (cargo displaced sideways on a taut rope)
+	DroneRopeCargoSimulator simulator;
+	simulator.setConstantDroneParameters(3, 0.1);				// in [kg], [N s^2 / m^2]
+	simulator.setConstantRopeParameters(1.5, 40000, 50);		// in [m], [N / m], [N s / m]
+	simulator.setConstantCargoParameters(2, 0.1);				// in [kg], [N s^2 / m^2]
+	simulator.setImplementation(true, IntegrationType::RungeKuttaFourStageOutput);
+	simulator.setStateArray({ 0, 0, 0, 0, 0, 0.5, -1.41, 0, 0 });
+	simulator.setOutputVector();
+
+	// Initialize controller
+	DroneControllerControlVector controller(0.5, 0.5, 0.1, oscillationDampingConstant);
+	controller.setVelocityVector({ 0, 0 });
+
+	// Fly 6 s, controller at the time step of the simulator
+	double swing = 0;
+	StateArray stateVector = simulator.getStateArray();
+	const long numberOfSteps = std::lround(6 / simulator.getTimeStep());
+	for (long step = 0; step < numberOfSteps; step++) {
+		const std::vector<double> controlVector = controller.calculateReferenceControlVector(true, 9.81, 3, stateVector[0], stateVector[3], stateVector[1], stateVector[4], stateVector[2],
+																							 2, stateVector[5], stateVector[6]);
+		simulator.simulationStep({ controlVector[0], controlVector[1] }, stateVector);
+
+		if (!std::isfinite(stateVector[5])) { return INFINITY; }
+		if (step >= numberOfSteps - std::lround(1 / simulator.getTimeStep())) { swing = std::max(swing, std::fabs(stateVector[5] - stateVector[0])); }
+	}
+
+	return swing;
+}
 
 // Main function
 int main()
@@ -9,9 +45,6 @@ int main()
 	// Initialize object
 	DroneControllerControlVector controller;
 
-	// Set dynamics type
-	bool dynamicsType = false;
-
 	// Set time constants
 	double timeConstantX = 0.2;		// in [s]
 	double timeConstantY = 0.2;		// in [s]
@@ -38,23 +71,48 @@ int main()
 
 	/* ----------------------------- ACTIONS ----------------------------- */
 
-	// Set time constants
+	// Set time constants and controller damping
 	controller.setTimeConstants(timeConstantX, timeConstantY, timeConstantTheta);
+	controller.setOscillationDampingConstant(oscillationDampingConstant);
+
+	// 1. Hover (at rest, level, cargo below the drone): thrust carries the weight of drone (+ cargo), no rotation
+	controller.setVelocityVector({ 0, 0 });
+	const std::vector<double> hoverControlVector = controller.calculateReferenceControlVector(true, gravitationalConstant, massDrone, xDrone, 0, yDrone, 0, 0, massCargo, xDrone, yDrone - 1.5);
+	const std::vector<double> hoverDroneControlVector = controller.calculateReferenceControlVector(false, gravitationalConstant, massDrone, xDrone, 0, yDrone, 0, 0, massCargo, xDrone, yDrone - 1.5);
+	const bool hoverPassed = (std::fabs(hoverControlVector[0] - (massDrone + massCargo) * gravitationalConstant) < 1e-12) && (hoverControlVector[1] == 0)
+							 && (std::fabs(hoverDroneControlVector[0] - massDrone * gravitationalConstant) < 1e-12) && (hoverDroneControlVector[1] == 0);
+
+	std::cout << "Hover thrust: " << hoverControlVector[0] << " N (drone + cargo), " << hoverDroneControlVector[0] << " N (drone)\n";
+
+	// 2. Thrust follows the vertical force: tilted drone, the vertical part of the thrust carries the weight
+	const std::vector<double> tiltedControlVector = controller.calculateReferenceControlVector(true, gravitationalConstant, massDrone, xDrone, 0, yDrone, 0, thetaDrone, massCargo, xDrone, yDrone - 1.5);
+	const bool tiltedPassed = (std::fabs(tiltedControlVector[0] * std::cos(thetaDrone) - (massDrone + massCargo) * gravitationalConstant) < 1e-9) && (tiltedControlVector[1] < 0);
+
+	// 3. Oscillation damping: with the cargo to one side, the drone is pushed to that side (back above the cargo)
+	const std::vector<double> forceVector = controller.calculateReferenceForceVector(true, gravitationalConstant, massDrone, xDrone, 0, yDrone, 0, massCargo, xCargo, yCargo);
+	const std::vector<double> mirroredForceVector = controller.calculateReferenceForceVector(true, gravitationalConstant, massDrone, xDrone, 0, yDrone, 0, massCargo, 2 * xDrone - xCargo, yCargo);
+	const bool dampingSignPassed = (forceVector[0] == oscillationDampingConstant * (xCargo - xDrone)) && (mirroredForceVector[0] == -forceVector[0]);
 
-	// Give controller (hypothetical) required reference velocities
-	std::vector<double> velocityVector = { 4, 4 };
+	// 4. Closed loop: the damping reduces the swing of the cargo, the opposite sign increases it (a smaller damping constant
+	//    than above: with time constants of 0.5 s, larger ones excite the lag of the angle of the drone)
+	const double closedLoopDampingConstant = 20;	// in [N / m]
+	const double swingUndamped = calculateSwing(0);
+	const double swingDamped = calculateSwing(closedLoopDampingConstant);
+	const double swingReversed = calculateSwing(-closedLoopDampingConstant);
+	const bool swingPassed = (swingDamped < 0.5 * swingUndamped) && !(swingReversed < swingUndamped);
 
-	// Initialize control vector to save to
-	std::vector<double> referenceControlVector{};
+	std::cout << "Swing during the last second: " << swingDamped << " m (damped), " << swingUndamped << " m (undamped), " << swingReversed << " m (opposite sign)\n";
 
-	// Calculate reference control vector
-	referenceControlVector = controller.calculateReferenceControlVector(dynamicsType, gravitationalConstant,
-																		massDrone, xDrone, xDotDrone, yDrone, yDotDrone, thetaDrone,
-																		massCargo, xCargo, yCargo);
+	// 5. Moving drone (+ cargo): a finite control vector
+	controller.setVelocityVector({ 4, 4 });
+	const std::vector<double> referenceControlVector = controller.calculateReferenceControlVector(true, gravitationalConstant, massDrone, xDrone, xDotDrone, yDrone, yDotDrone, thetaDrone,
+																								  massCargo, xCargo, yCargo);
+	const bool finitePassed = std::isfinite(referenceControlVector[0]) && std::isfinite(referenceControlVector[1]);
 
-	// [DEBUG] Check value in debugger
-	std::vector<double> dummy = referenceControlVector;
+	// Report
+	const bool passed = hoverPassed && tiltedPassed && dampingSignPassed && swingPassed && finitePassed;
+	std::cout << (passed ? "PASSED" : "FAILED") << "\n";
 
 	// Exit program
-	return 0;
+	return passed ? 0 : 1;
 }
\ No newline at end of file
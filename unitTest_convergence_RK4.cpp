@@ -0,0 +1,82 @@
+// Libraries
+#include "DroneRopeCargoSimulator.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+// Simulates a swinging cargo on a taut rope for a fixed duration, returns the final state vector
+StateArray simulate(IntegrationType integrationType, double timeStep, double duration)
+{
+	// Initialize DroneRopeCargoSimulator-object (no drag, such that the dynamics are smooth)
+	DroneRopeCargoSimulator simulator;
+	simulator.setConstantDroneParameters(3, 0);			// in [kg], [N s^2 / m^2]
+	simulator.setConstantRopeParameters(1.5, 1000, 5);	// in [m], [N / m], [N s / m]
+	simulator.setConstantCargoParameters(2, 0);			// in [kg], [N s^2 / m^2]
+
+	// Set implementation and overwrite time step
+	simulator.setImplementation(true, integrationType);
+	simulator.setTimeStep(timeStep);
+
+	// Hanging cargo, slightly stretched rope and swinging sideways
+	simulator.setStateArray({ 0, 0, 0, 0, 0, 0.3, -1.5, 1.0, 0 });
+
+	// Hover thrust
+	const ControlArray controlVector = { 49.05, 0.1 };
+
+	// Step
+	StateArray stateVector{};
+	const int numberOfSteps = int(std::lround(duration / timeStep));
+	for (int step = 0; step < numberOfSteps; step++) {
+		simulator.simulationStep(controlVector, stateVector);
+	}
+
+	return stateVector;
+}
+
+// Maximum absolute difference between two state vectors
+double calculateError(const StateArray& stateVector, const StateArray& referenceStateVector)
+{
+	double error = 0;
+	for (std::size_t i = 0; i < stateVector.size(); i++) { error = std::max(error, std::fabs(stateVector[i] - referenceStateVector[i])); }
+	return error;
+}
+
+// Estimates the order of convergence from the errors at time steps h and h/2, reports the errors
+double calculateOrder(const char* name, IntegrationType integrationType, double timeStep, double duration, const StateArray& referenceStateVector)
+{
+	const double error = calculateError(simulate(integrationType, timeStep, duration), referenceStateVector);
+	const double errorHalf = calculateError(simulate(integrationType, timeStep / 2, duration), referenceStateVector);
+	const double order = std::log2(error / errorHalf);
+
+	std::cout << name << ": error(h = " << timeStep << ") = " << error << ", error(h/2) = " << errorHalf << ", order = " << order << "\n";
+
+	return order;
+}
+
+// Main function
+int main()
+{
+	/* ---------------------------------- SETTINGS ---------------------------------- */
+
+	const double duration = 1.0;		// in [s]
+	const double timeStep = 0.02;		// in [s]
+	const double referenceTimeStep = 0.0005;	// in [s]
+
+	/* ---------------------------------- ACTIONS ---------------------------------- */
+
+	// Reference solution (RK4 with output vector per stage, small time step)
+	const StateArray referenceStateVector = simulate(IntegrationType::RungeKuttaFourStageOutput, referenceTimeStep, duration);
+
+	// Estimate orders
+	const double orderStageOutput = calculateOrder("RK4, output vector per stage", IntegrationType::RungeKuttaFourStageOutput, timeStep, duration, referenceStateVector);
+	const double orderConstantOutput = calculateOrder("RK4, constant output vector", IntegrationType::RungeKuttaFour, timeStep, duration, referenceStateVector);
+
+	// Fourth order with the output vector per stage, degraded with a constant output vector
+	const bool passed = (orderStageOutput > 3.5) && (orderConstantOutput < orderStageOutput);
+
+	// Report
+	std::cout << (passed ? "PASSED" : "FAILED") << "\n";
+
+	// Exit program
+	return passed ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,115 @@
+// Libraries
+#include "DroneRopeCargoSimulator.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+// Initializes a simulator with a swinging cargo on a taut rope
+void initialize(DroneRopeCargoSimulator& simulator, IntegrationType integrationType, double timeStep, const StateArray& stateVector)
+{
+	// Constant parameters (no drag, such that the dynamics are smooth)
+	simulator.setConstantDroneParameters(3, 0);			// in [kg], [N s^2 / m^2]
+	simulator.setConstantRopeParameters(1.5, 1000, 5);	// in [m], [N / m], [N s / m]
+	simulator.setConstantCargoParameters(2, 0);			// in [kg], [N s^2 / m^2]
+
+	// Set implementation and overwrite time step
+	simulator.setImplementation(true, integrationType);
+	simulator.setTimeStep(timeStep);
+
+	// Set state
+	simulator.setStateArray(stateVector);
+	simulator.setOutputVector();
+}
+
+// Maximum absolute difference between two state vectors
+double calculateError(const StateArray& stateVector, const StateArray& referenceStateVector)
+{
+	double error = 0;
+	for (std::size_t i = 0; i < stateVector.size(); i++) { error = std::max(error, std::fabs(stateVector[i] - referenceStateVector[i])); }
+	return error;
+}
+
+// Main function
+int main()
+{
+	/* ---------------------------------- SETTINGS ---------------------------------- */
+
+	const ControlArray controlVector = { 49.05, 0.1 };	// Hover thrust
+	const double timeStep = 0.01;						// in [s]
+	const double referenceTimeStep = 0.00001;			// in [s]
+	const int numberOfSteps = 50;						// Steps before the sampled step
+	const int numberOfSamples = 10;						// Samples inside the sampled step
+
+	/* ---------------------------------- ACTIONS ---------------------------------- */
+
+	// Hanging cargo, slightly stretched rope and swinging sideways; swing for a while to get a state inside the motion
+	StateArray stateVector = { 0, 0, 0, 0, 0, 0.3, -1.5, 1.0, 0 };
+	DroneRopeCargoSimulator initialSimulator;
+	initialize(initialSimulator, IntegrationType::RungeKuttaFourStageOutput, timeStep, stateVector);
+	for (int step = 0; step < numberOfSteps; step++) { initialSimulator.simulationStep(controlVector, stateVector); }
+
+	// Reference solution at the sample times inside the next step (RK4 with output vector per stage, small time step)
+	DroneRopeCargoSimulator referenceSimulator;
+	initialize(referenceSimulator, IntegrationType::RungeKuttaFourStageOutput, referenceTimeStep, stateVector);
+
+	StateArray referenceStepStateVector{};
+	std::vector<StateArray> referenceStateVectors;
+	const int referenceStepsPerSample = int(std::lround(timeStep / referenceTimeStep)) / numberOfSamples;
+	for (int sample = 1; sample <= numberOfSamples; sample++) {
+		for (int step = 0; step < referenceStepsPerSample; step++) { referenceSimulator.simulationStep(controlVector, referenceStepStateVector); }
+		referenceStateVectors.push_back(referenceStepStateVector);
+	}
+
+	// RK4 (output vector per stage), one step
+	DroneRopeCargoSimulator simulator;
+	initialize(simulator, IntegrationType::RungeKuttaFourStageOutput, timeStep, stateVector);
+	StateArray nextStateVector{};
+	simulator.simulationStep(controlVector, nextStateVector);
+
+	// Dormand-Prince, the same step as interval
+	DroneRopeCargoSimulator adaptiveSimulator;
+	initialize(adaptiveSimulator, IntegrationType::RungeKuttaFourStageOutput, timeStep, stateVector);
+	adaptiveSimulator.setTolerances(1e-7, 1e-7);
+	adaptiveSimulator.simulateInterval(controlVector, timeStep, nextStateVector);
+	const double adaptiveStartTime = adaptiveSimulator.getSimulationTime() - adaptiveSimulator.getDenseTimeStep();
+
+	// Compare inside the step: dense output, linear interpolation between the states at the start and end of the step
+	double errorDense = 0, errorLinear = 0, errorAdaptive = 0;
+	int adaptiveSamples = 0;
+	const StateArray startStateVector = stateVector;
+	const StateArray endStateVector = simulator.getStateArray();
+
+	for (int sample = 1; sample < numberOfSamples; sample++) {
+		const double timeFraction = double(sample) / numberOfSamples;
+		const double time = simulator.getStepStartTime() + timeFraction * timeStep;
+		const StateArray& referenceStateVector = referenceStateVectors[sample - 1];
+
+		StateArray linearStateVector{};
+		for (std::size_t i = 0; i < linearStateVector.size(); i++) { linearStateVector[i] = startStateVector[i] + timeFraction * (endStateVector[i] - startStateVector[i]); }
+
+		errorDense = std::max(errorDense, calculateError(simulator.getInterpolatedStateArray(time), referenceStateVector));
+		errorLinear = std::max(errorLinear, calculateError(linearStateVector, referenceStateVector));
+
+		if (time > adaptiveStartTime) { // Inside the last internal step
+			errorAdaptive = std::max(errorAdaptive, calculateError(adaptiveSimulator.getInterpolatedStateArray(time), referenceStateVector));
+			adaptiveSamples++;
+		}
+	}
+
+	// Errors at the end of the step, for comparison
+	const double errorStep = calculateError(endStateVector, referenceStateVectors.back());
+	const bool boundsExact = (simulator.getInterpolatedStateArray(simulator.getSimulationTime()) == endStateVector);
+
+	// Report
+	std::cout << "error at end of step:       " << errorStep << "\n"
+			  << "error of dense output (RK4): " << errorDense << "\n"
+			  << "error of linear interpolation: " << errorLinear << "\n"
+			  << "error of dense output (Dormand-Prince, " << adaptiveSamples << " samples): " << errorAdaptive << "\n";
+
+	// Dense output far better than linear interpolation; Dormand-Prince (fourth order) close to its tolerances
+	const bool passed = boundsExact && (adaptiveSamples > 0) && (errorDense < 0.01 * errorLinear) && (errorAdaptive < 1e-7);
+	std::cout << (passed ? "PASSED" : "FAILED") << "\n";
+
+	// Exit program
+	return passed ? 0 : 1;
+}
\ No newline at end of file
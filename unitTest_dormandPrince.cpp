@@ -0,0 +1,131 @@
+// Libraries
+#include "DroneRopeCargoSimulator.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+// Initializes a simulator with a swinging cargo on a taut rope
+void initialize(DroneRopeCargoSimulator& simulator, bool integrationType, const StateArray& stateVector)
+{
+	// Constant parameters (no drag, such that the dynamics are smooth)
+	simulator.setConstantDroneParameters(3, 0);			// in [kg], [N s^2 / m^2]
+	simulator.setConstantRopeParameters(1.5, 1000, 5);	// in [m], [N / m], [N s / m]
+	simulator.setConstantCargoParameters(2, 0);			// in [kg], [N s^2 / m^2]
+
+	// Set implementation
+	simulator.setImplementation(true, integrationType);
+
+	// Set state
+	simulator.setStateArray(stateVector);
+	simulator.setOutputVector();
+}
+
+// Simulates the interval with fixed time steps and a constant control vector, returns the final state vector
+StateArray simulate(DroneRopeCargoSimulator& simulator, double interval, const ControlArray& controlVector)
+{
+	StateArray stateVector = simulator.getStateArray();
+	const long numberOfSteps = std::lround(interval / simulator.getTimeStep());
+	for (long step = 0; step < numberOfSteps; step++) {
+		simulator.simulationStep(controlVector, stateVector);
+	}
+	return stateVector;
+}
+
+// Maximum absolute difference between two state vectors
+double calculateError(const StateArray& stateVector, const StateArray& referenceStateVector)
+{
+	double error = 0;
+	for (std::size_t i = 0; i < stateVector.size(); i++) { error = std::max(error, std::fabs(stateVector[i] - referenceStateVector[i])); }
+	return error;
+}
+
+// Main function
+int main()
+{
+	/* ---------------------------------- SETTINGS ---------------------------------- */
+
+	const ControlArray controlVector = { 49.05, 0.1 };				// Hover thrust
+	const StateArray initialStateVector = { 0, 0, 0, 0, 0, 0.3, -1.5, 1.0, 0 };	// Hanging cargo, swinging sideways
+	const double interval = 1;										// in [s]
+	const double referenceTolerance = 1e-12;						// Absolute and relative
+	const std::vector<double> tolerances = { 1e-4, 1e-6, 1e-8 };	// Absolute and relative
+
+	/* ---------------------------------- ACTIONS ---------------------------------- */
+
+	// Reference solution (Dormand-Prince, tight tolerance)
+	DroneRopeCargoSimulator referenceSimulator;
+	initialize(referenceSimulator, true, initialStateVector);
+	referenceSimulator.setTolerances(referenceTolerance, referenceTolerance);
+	StateArray referenceStateVector{};
+	referenceSimulator.simulateInterval(controlVector, interval, referenceStateVector);
+	double largestState = 0;
+	for (double state : referenceStateVector) { largestState = std::max(largestState, std::fabs(state)); }
+
+	// RK4 at its time step, for comparison
+	DroneRopeCargoSimulator fixedStepSimulator;
+	initialize(fixedStepSimulator, true, initialStateVector);
+	const double errorFixedStep = calculateError(simulate(fixedStepSimulator, interval, controlVector), referenceStateVector);
+	const long evaluationsFixedStep = 4 * std::lround(interval / fixedStepSimulator.getTimeStep());
+	std::cout << "RK4, h = " << fixedStepSimulator.getTimeStep() << " s: " << evaluationsFixedStep << " evaluations, error " << errorFixedStep << "\n";
+
+	// Dormand-Prince over the whole interval, per tolerance
+	int mismatches = 0;
+	int previousEvaluations = 0;
+	for (double tolerance : tolerances) {
+		DroneRopeCargoSimulator simulator;
+		initialize(simulator, true, initialStateVector);
+		simulator.setTolerances(tolerance, tolerance);
+
+		StateArray nextStateVector{};
+		const IntegrationStatistics statistics = simulator.simulateInterval(controlVector, interval, nextStateVector);
+		const double error = calculateError(nextStateVector, referenceStateVector);
+		const double errorBound = statistics.acceptedSteps * (tolerance + tolerance * largestState); // Sum of the local errors allowed per accepted step
+
+		// Error within the tolerance of the accepted steps; one evaluation for the first stage, six per attempted step (FSAL); more steps for a tighter tolerance
+		const bool passed = (error < errorBound) && (statistics.acceptedSteps > 0)
+							&& (statistics.derivativeEvaluations == 1 + 6 * (statistics.acceptedSteps + statistics.rejectedSteps))
+							&& (statistics.rejectedSteps <= statistics.acceptedSteps) && (statistics.derivativeEvaluations > previousEvaluations)
+							&& (simulator.getSimulationTime() == interval) && (nextStateVector == simulator.getStateArray());
+		mismatches += !passed;
+		previousEvaluations = statistics.derivativeEvaluations;
+
+		std::cout << "Dormand-Prince, tolerance " << tolerance << ": " << statistics.derivativeEvaluations << " evaluations, " << statistics.acceptedSteps << " accepted, "
+				  << statistics.rejectedSteps << " rejected, error " << error << " (bound " << errorBound << ")" << (passed ? "" : " (NOT AS EXPECTED)") << "\n";
+	}
+
+	// Interval that is not positive: nothing is evaluated, the simulation time does not move
+	int invalidMismatches = 0;
+	for (double invalidInterval : { 0.0, -0.5, std::nan("") }) {
+		DroneRopeCargoSimulator simulator;
+		initialize(simulator, true, initialStateVector);
+		StateArray nextStateVector{};
+		const IntegrationStatistics statistics = simulator.simulateInterval(controlVector, invalidInterval, nextStateVector);
+		invalidMismatches += (statistics.derivativeEvaluations != 0) || (nextStateVector != initialStateVector) || (simulator.getSimulationTime() != 0);
+	}
+
+	// Tolerances that are not positive are ignored
+	DroneRopeCargoSimulator simulator;
+	initialize(simulator, true, initialStateVector);
+	simulator.setTolerances(0, -1e-6);
+	simulator.setAbsoluteTolerance(std::nan(""));
+	invalidMismatches += (simulator.getAbsoluteTolerance() != 1e-6) || (simulator.getRelativeTolerance() != 1e-6);
+
+	// State that is not finite: the interval is aborted at the first step, instead of shrinking the step to the minimum
+	StateArray invalidStateVector = initialStateVector;
+	invalidStateVector[7] = std::nan("");
+	simulator.setStateArray(invalidStateVector);
+	StateArray nextStateVector{};
+	const IntegrationStatistics statistics = simulator.simulateInterval(controlVector, interval, nextStateVector);
+	invalidMismatches += !statistics.aborted || (statistics.acceptedSteps != 0) || (statistics.derivativeEvaluations != 7) || (statistics.integratedInterval != 0)
+						 || (simulator.getSimulationTime() != 0);
+
+	std::cout << "Invalid intervals, tolerances and states: mismatches: " << invalidMismatches << "\n";
+
+	// Report
+	const bool passed = (mismatches == 0) && (invalidMismatches == 0);
+	std::cout << (passed ? "PASSED" : "FAILED") << "\n";
+
+	// Exit program
+	return passed ? 0 : 1;
+}
\ No newline at end of file
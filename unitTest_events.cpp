@@ -0,0 +1,105 @@
+// Libraries
+#include "DroneRopeCargoSimulator.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+// Simulates a cargo falling into a slack rope, bouncing taut and slack again; returns the final state vector and the rope events
+StateArray simulate(DroneRopeCargoSimulator& simulator, IntegrationType integrationType, double timeStep, bool eventDetection, double duration, std::vector<RopeEvent>& ropeEvents)
+{
+	// Initialize DroneRopeCargoSimulator-object (no drag, such that the dynamics are smooth apart from the rope)
+	simulator.setConstantDroneParameters(3, 0);			// in [kg], [N s^2 / m^2]
+	simulator.setConstantRopeParameters(1.5, 1000, 5);	// in [m], [N / m], [N s / m]
+	simulator.setConstantCargoParameters(2, 0);			// in [kg], [N s^2 / m^2]
+
+	// Set implementation, overwrite time step and enable/disable event detection
+	simulator.setImplementation(true, integrationType);
+	simulator.setTimeStep(timeStep);
+	simulator.setEventDetection(eventDetection);
+
+	// Cargo below the drone on a slack rope, falling
+	simulator.setStateArray({ 0, 0, 0, 0, 0, 0.2, -1.0, 0.5, -2.0 });
+	simulator.setOutputVector();
+
+	// Hover thrust
+	const ControlArray controlVector = { 49.05, 0 };
+
+	// Step
+	StateArray stateVector{};
+	const int numberOfSteps = int(std::lround(duration / timeStep));
+	for (int step = 0; step < numberOfSteps; step++) {
+		simulator.simulationStep(controlVector, stateVector);
+	}
+
+	ropeEvents = simulator.getRopeEvents();
+	return stateVector;
+}
+
+StateArray simulate(IntegrationType integrationType, double timeStep, bool eventDetection, double duration, std::vector<RopeEvent>& ropeEvents)
+{
+	DroneRopeCargoSimulator simulator;
+	return simulate(simulator, integrationType, timeStep, eventDetection, duration, ropeEvents);
+}
+
+// Maximum absolute difference between two state vectors
+double calculateError(const StateArray& stateVector, const StateArray& referenceStateVector)
+{
+	double error = 0;
+	for (std::size_t i = 0; i < stateVector.size(); i++) { error = std::max(error, std::fabs(stateVector[i] - referenceStateVector[i])); }
+	return error;
+}
+
+// Main function
+int main()
+{
+	/* ---------------------------------- SETTINGS ---------------------------------- */
+
+	const double duration = 1.0;			// in [s]
+	const double timeStep = 0.01;			// in [s]
+	const double referenceTimeStep = 0.0001;	// in [s]
+
+	/* ---------------------------------- ACTIONS ---------------------------------- */
+
+	// Reference solution (RK4 with output vector per stage and event detection, small time step)
+	std::vector<RopeEvent> referenceRopeEvents;
+	const StateArray referenceStateVector = simulate(IntegrationType::RungeKuttaFourStageOutput, referenceTimeStep, true, duration, referenceRopeEvents);
+
+	// Coarse time step, without and with event detection
+	std::vector<RopeEvent> ropeEvents, ropeEventsDetected;
+	const double error = calculateError(simulate(IntegrationType::RungeKuttaFourStageOutput, timeStep, false, duration, ropeEvents), referenceStateVector);
+	const double errorDetected = calculateError(simulate(IntegrationType::RungeKuttaFourStageOutput, timeStep, true, duration, ropeEventsDetected), referenceStateVector);
+
+	// Events: same transitions as the reference, at (nearly) the same times
+	bool eventsMatch = (ropeEventsDetected.size() == referenceRopeEvents.size()) && !referenceRopeEvents.empty() && ropeEvents.empty();
+	for (std::size_t i = 0; eventsMatch && i < referenceRopeEvents.size(); i++) {
+		std::cout << "event " << i << ": t = " << ropeEventsDetected[i].time << " (reference " << referenceRopeEvents[i].time << "), "
+				  << (ropeEventsDetected[i].taut ? "slack --> taut" : "taut --> slack") << "\n";
+		eventsMatch = (ropeEventsDetected[i].taut == referenceRopeEvents[i].taut) && (std::fabs(ropeEventsDetected[i].time - referenceRopeEvents[i].time) < 1e-4);
+	}
+
+	// Report
+	std::cout << "error (h = " << timeStep << "): " << error << " without, " << errorDetected << " with event detection\n";
+
+	// Locating an event leaves no trace in the integrators: Adams-Bashforth-Moulton restarts at most twice per event (the
+	// split step and the step after it have another time step), implicit Runge-Kutta (one Newton iteration per stage, such
+	// that every step counts as a failure) counts the steps actually taken, not the partial steps of the bisection
+	const long numberOfSteps = std::lround(duration / timeStep);
+	DroneRopeCargoSimulator multistepSimulator, implicitSimulator;
+	std::vector<RopeEvent> multistepRopeEvents, implicitRopeEvents;
+	simulate(multistepSimulator, IntegrationType::AdamsBashforthMoulton, timeStep, true, duration, multistepRopeEvents);
+	implicitSimulator.setMaximumNewtonIterations(1);
+	simulate(implicitSimulator, IntegrationType::ImplicitRungeKutta, timeStep, true, duration, implicitRopeEvents);
+
+	const bool countersPassed = !multistepRopeEvents.empty() && (multistepSimulator.getNumberOfRestarts() <= 2 * long(multistepRopeEvents.size()))
+								&& !implicitRopeEvents.empty() && (implicitSimulator.getNumberOfNewtonFailures() <= numberOfSteps + long(implicitRopeEvents.size()));
+
+	std::cout << "Adams-Bashforth-Moulton: " << multistepRopeEvents.size() << " events, " << multistepSimulator.getNumberOfRestarts() << " restarts; implicit RK: "
+			  << implicitRopeEvents.size() << " events, " << implicitSimulator.getNumberOfNewtonFailures() << " Newton failures in " << numberOfSteps << " steps\n";
+
+	// Splitting the steps at the transitions recovers most of the accuracy
+	const bool passed = eventsMatch && (errorDetected < 0.01 * error) && countersPassed;
+	std::cout << (passed ? "PASSED" : "FAILED") << "\n";
+
+	// Exit program
+	return passed ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,176 @@
+// Libraries
+#include "DroneRopeCargoSimulator.h"
+#include "RungeKuttaFourNumericalIntegration.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+// Simulates a swinging cargo on a taut rope for a fixed duration, returns the final state vector
+StateArray simulate(IntegrationType integrationType, double timeStep, double duration)
+{
+	// Initialize DroneRopeCargoSimulator-object (no drag, such that the dynamics are smooth)
+	DroneRopeCargoSimulator simulator;
+	simulator.setConstantDroneParameters(3, 0);			// in [kg], [N s^2 / m^2]
+	simulator.setConstantRopeParameters(1.5, 1000, 5);	// in [m], [N / m], [N s / m]
+	simulator.setConstantCargoParameters(2, 0);			// in [kg], [N s^2 / m^2]
+
+	// Set implementation and overwrite time step
+	simulator.setImplementation(true, integrationType);
+	simulator.setTimeStep(timeStep);
+
+	// Hanging cargo, slightly stretched rope and swinging sideways
+	simulator.setStateArray({ 0, 0, 0, 0, 0, 0.3, -1.5, 1.0, 0 });
+
+	// Hover thrust
+	const ControlArray controlVector = { 49.05, 0.1 };
+
+	// Step
+	StateArray stateVector{};
+	const int numberOfSteps = int(std::lround(duration / timeStep));
+	for (int step = 0; step < numberOfSteps; step++) {
+		simulator.simulationStep(controlVector, stateVector);
+	}
+
+	return stateVector;
+}
+
+// Maximum absolute difference between two state vectors
+double calculateError(const StateArray& stateVector, const StateArray& referenceStateVector)
+{
+	double error = 0;
+	for (std::size_t i = 0; i < stateVector.size(); i++) { error = std::max(error, std::fabs(stateVector[i] - referenceStateVector[i])); }
+	return error;
+}
+
+// Estimates the order of convergence of a tableau on a harmonic oscillator (exact solution known), from the errors at time steps h and h/2
+template <const auto& Tableau>
+bool checkOrder(const char* name, double expectedOrder)
+{
+	// Harmonic oscillator x1' = -x2, x2' = x1, starting at (1, 0) --> (cos(t), sin(t))
+	using OscillatorArray = std::array<double, 2>;
+	auto oscillatorFunction = [](const OscillatorArray& x, int, int, int, bool, OscillatorArray& xDot) { xDot = { -x[1], x[0] }; };
+	auto oscillatorOutputFunction = [](const OscillatorArray&) { return 0; };
+	const double duration = 2.0;
+
+	// Error at the end of the duration
+	auto calculateOscillatorError = [&](double timeStep) {
+		ExplicitRungeKuttaNumericalIntegration integrator(timeStep);
+		OscillatorArray x = { 1, 0 };
+		for (int step = 0; step < int(std::lround(duration / timeStep)); step++) {
+			integrator.calculateStep<Tableau>(oscillatorFunction, oscillatorOutputFunction, x, 0, 0, false, x);
+		}
+		return std::max(std::fabs(x[0] - cos(duration)), std::fabs(x[1] - sin(duration)));
+	};
+
+	const double error = calculateOscillatorError(0.02);
+	const double errorHalf = calculateOscillatorError(0.01);
+	const double order = std::log2(error / errorHalf);
+
+	std::cout << name << ": error(h = 0.02) = " << error << ", error(h/2) = " << errorHalf << ", order = " << order << " (expected " << expectedOrder << ")\n";
+
+	return std::fabs(order - expectedOrder) < 0.2;
+}
+
+// Checks the accuracy of an integration type of the simulator at the given time step
+bool checkAccuracy(const char* name, IntegrationType integrationType, double timeStep, double duration, const StateArray& referenceStateVector)
+{
+	const double error = calculateError(simulate(integrationType, timeStep, duration), referenceStateVector);
+
+	std::cout << name << ": error(h = " << timeStep << ") = " << error << "\n";
+
+	return error < 0.05;
+}
+
+// Main function
+int main()
+{
+	/* ---------------------------------- SETTINGS ---------------------------------- */
+
+	const double duration = 1.0;		// in [s]
+	const double timeStep = 0.01;		// in [s]
+	const double referenceTimeStep = 0.0002;	// in [s]
+	const int numberOfStates = 1024;
+	const int repetitions = 200;
+
+	// Initialize parameter block (see DynamicSystemArrays.h)
+	const DynamicSystemParameters parameterList = ParameterArray{ 9.81, 3, 0.1, 1.5, 50, 40000, 2, 0.1 };
+	const ControlArray controlVector = { 49.05, 0.3 };
+
+	// Derivative and output function
+	auto derivativeFunction = [](const StateArray& x, const ControlArray& u, const OutputArray& y, const DynamicSystemParameters& P, bool n, StateArray& xDot) {
+		DroneRopeCargoDynamics::calculateDerivativeStateVectorFused(x, u, y, P, n, xDot);
+	};
+	auto outputFunction = [](const StateArray& x) {
+		OutputArray y{};
+		DroneRopeCargoDynamics::calculateOutputArray(x, y);
+		return y;
+	};
+
+	/* ---------------------------------- ACTIONS ---------------------------------- */
+
+	// 1. The classic RK4-tableau reproduces the hand-written RK4 bit for bit, at the same cost
+	RungeKuttaFourNumericalIntegration handWritten(0.001);
+	ExplicitRungeKuttaNumericalIntegration tableau(0.001);
+
+	std::vector<StateArray> stateVectors(numberOfStates);
+	for (int k = 0; k < numberOfStates; k++) {
+		const double phase = 0.01 * k;
+		stateVectors[k] = { 0.1 * sin(phase), 2 + 0.1 * cos(phase), 0.2 * sin(3 * phase), cos(phase), sin(2 * phase),
+							0.3 * sin(phase), 0.5 + 0.02 * sin(7 * phase), sin(phase), cos(3 * phase) };
+	}
+
+	int mismatches = 0;
+	for (const StateArray& stateVector : stateVectors) {
+		StateArray nextStateVector{}, nextStateVectorTableau{};
+		handWritten.calculateStep(derivativeFunction, outputFunction, stateVector, controlVector, parameterList, true, nextStateVector);
+		tableau.calculateStep<ButcherTableaux::rungeKuttaFour>(derivativeFunction, outputFunction, stateVector, controlVector, parameterList, true, nextStateVectorTableau);
+		mismatches += (nextStateVector != nextStateVectorTableau);
+	}
+
+	double checksum = 0;
+	auto timeSteps = [&](auto&& step) {
+		StateArray nextStateVector{};
+		auto start = std::chrono::steady_clock::now();
+		for (int repetition = 0; repetition < repetitions; repetition++) {
+			for (const StateArray& stateVector : stateVectors) {
+				step(stateVector, nextStateVector);
+				checksum += nextStateVector[3]; // Keep result alive
+			}
+		}
+		auto end = std::chrono::steady_clock::now();
+		return std::chrono::duration<double, std::nano>(end - start).count() / (double(repetitions) * numberOfStates);
+	};
+	const double timeHandWritten = timeSteps([&](const StateArray& x, StateArray& next) {
+		handWritten.calculateStep(derivativeFunction, outputFunction, x, controlVector, parameterList, true, next);
+	});
+	const double timeTableau = timeSteps([&](const StateArray& x, StateArray& next) {
+		tableau.calculateStep<ButcherTableaux::rungeKuttaFour>(derivativeFunction, outputFunction, x, controlVector, parameterList, true, next);
+	});
+
+	std::cout << "RK4 hand-written: " << timeHandWritten << " ns/step, Butcher tableau: " << timeTableau << " ns/step, "
+			  << "mismatching states: " << mismatches << " (checksum " << checksum << ")\n";
+
+	// 2. Orders of convergence of the available tableaux
+	bool methodsPassed = true;
+	methodsPassed &= checkOrder<ButcherTableaux::heun>("Heun", 2);
+	methodsPassed &= checkOrder<ButcherTableaux::rungeKuttaThree>("RK3", 3);
+	methodsPassed &= checkOrder<ButcherTableaux::strongStabilityPreservingRungeKuttaThree>("SSPRK3", 3);
+	methodsPassed &= checkOrder<ButcherTableaux::rungeKuttaFour>("RK4", 4);
+	methodsPassed &= checkOrder<ButcherTableaux::rungeKuttaFourThreeEighths>("RK4 (3/8-rule)", 4);
+
+	// 3. Integration types of the simulator (swinging cargo)
+	const StateArray referenceStateVector = simulate(IntegrationType::RungeKuttaFourStageOutput, referenceTimeStep, duration);
+
+	methodsPassed &= checkAccuracy("Heun", IntegrationType::Heun, timeStep, duration, referenceStateVector);
+	methodsPassed &= checkAccuracy("RK3", IntegrationType::RungeKuttaThree, timeStep, duration, referenceStateVector);
+	methodsPassed &= checkAccuracy("SSPRK3", IntegrationType::StrongStabilityPreservingRungeKuttaThree, timeStep, duration, referenceStateVector);
+	methodsPassed &= checkAccuracy("RK4 (3/8-rule)", IntegrationType::RungeKuttaFourThreeEighths, timeStep, duration, referenceStateVector);
+
+	// Report
+	const bool passed = (mismatches == 0) && methodsPassed;
+	std::cout << (passed ? "PASSED" : "FAILED") << "\n";
+
+	// Exit program
+	return passed ? 0 : 1;
+}
\ No newline at end of file
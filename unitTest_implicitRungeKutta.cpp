@@ -0,0 +1,114 @@
+// Libraries
+#include "DroneRopeCargoSimulator.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+// Initializes a simulator hovering with the cargo just above the rope length (rope slack, then taut)
+void initialize(DroneRopeCargoSimulator& simulator, IntegrationType integrationType, double ropeStiffness)
+{
+	// Constant parameters; rope damping such that the cargo settles on the rope (with little damping it keeps bouncing
+	// on a 1e6 N/m rope, and the reference solution itself depends on the integrator)
+	simulator.setConstantDroneParameters(3, 0.1);				// in [kg], [N s^2 / m^2]
+	simulator.setConstantRopeParameters(1.5, ropeStiffness, 200);	// in [m], [N / m], [N s / m]
+	simulator.setConstantCargoParameters(2, 0.1);				// in [kg], [N s^2 / m^2]
+
+	// Set implementation
+	simulator.setImplementation(true, integrationType);
+
+	// Set state
+	simulator.setStateArray({ 0, 0, 0, 0, 0, 0, -1.45, 0, 0 });
+	simulator.setOutputVector();
+}
+
+// Simulates the duration with a constant control vector, returns the final state vector
+StateArray simulate(DroneRopeCargoSimulator& simulator, double duration, const ControlArray& controlVector)
+{
+	StateArray stateVector = simulator.getStateArray();
+	const long numberOfSteps = std::lround(duration / simulator.getTimeStep());
+	for (long step = 0; step < numberOfSteps; step++) {
+		simulator.simulationStep(controlVector, stateVector);
+	}
+	return stateVector;
+}
+
+// Maximum absolute difference between two state vectors; infinite if a state is not finite
+double calculateError(const StateArray& stateVector, const StateArray& referenceStateVector)
+{
+	double error = 0;
+	for (std::size_t i = 0; i < stateVector.size(); i++) {
+		if (!std::isfinite(stateVector[i])) { return INFINITY; }
+		error = std::max(error, std::fabs(stateVector[i] - referenceStateVector[i]));
+	}
+	return error;
+}
+
+// Main function
+int main()
+{
+	/* ---------------------------------- SETTINGS ---------------------------------- */
+
+	const ControlArray controlVector = { 49.05, 0 };					// Hover thrust
+	const double duration = 2;											// in [s]
+	const std::vector<double> ropeStiffnesses = { 4e4, 1e5, 1e6 };		// in [N / m]
+	const std::vector<double> timeSteps = { 0.01, 0.02 };				// in [s]
+	const double tolerance = 1e-2;										// Implicit RK: final state w.r.t. the reference
+	const double divergence = 1;										// RK4: diverged beyond this error
+
+	/* ---------------------------------- ACTIONS ---------------------------------- */
+
+	// 1. Stiff ropes: implicit RK stays bounded and close to the reference, RK4 diverges
+	int mismatches = 0;
+	for (double ropeStiffness : ropeStiffnesses) {
+		// Reference (Dormand-Prince, tight tolerances)
+		DroneRopeCargoSimulator referenceSimulator;
+		initialize(referenceSimulator, IntegrationType::RungeKuttaFour, ropeStiffness);
+		referenceSimulator.setTolerances(1e-10, 1e-10);
+		StateArray referenceStateVector{};
+		referenceSimulator.simulateInterval(controlVector, duration, referenceStateVector);
+
+		for (double timeStep : timeSteps) {
+			// Implicit RK
+			DroneRopeCargoSimulator simulator;
+			initialize(simulator, IntegrationType::ImplicitRungeKutta, ropeStiffness);
+			simulator.setTimeStep(timeStep);
+			const double error = calculateError(simulate(simulator, duration, controlVector), referenceStateVector);
+
+			// RK4
+			DroneRopeCargoSimulator explicitSimulator;
+			initialize(explicitSimulator, IntegrationType::RungeKuttaFour, ropeStiffness);
+			explicitSimulator.setTimeStep(timeStep);
+			const double explicitError = calculateError(simulate(explicitSimulator, duration, controlVector), referenceStateVector);
+
+			const bool passed = (error < tolerance) && (simulator.getNumberOfNewtonFailures() == 0) && !(explicitError < divergence);
+			mismatches += !passed;
+
+			std::cout << ropeStiffness << " N/m, h = " << timeStep << " s: error implicit RK " << error << ", RK4 " << explicitError
+					  << (passed ? "" : " (NOT AS EXPECTED)") << "\n";
+		}
+	}
+
+	// 2. Convergence: with a single Newton iteration the stages do not converge, which the step reports and counts
+	DroneRopeCargoSimulator simulator;
+	initialize(simulator, IntegrationType::ImplicitRungeKutta, 1e5);
+	simulator.setMaximumNewtonIterations(1);
+	StateArray nextStateVector{};
+	const bool converged = simulator.simulationStep(controlVector, nextStateVector);
+	const bool reportedPassed = !converged && !simulator.getNewtonConverged() && (simulator.getNumberOfNewtonFailures() == 1);
+
+	simulator.setMaximumNewtonIterations(10);
+	simulator.resetNumberOfNewtonFailures();
+	const bool convergedAgain = simulator.simulationStep(controlVector, nextStateVector);
+	const bool recoveredPassed = convergedAgain && simulator.getNewtonConverged() && (simulator.getNumberOfNewtonFailures() == 0);
+
+	std::cout << "1 Newton iteration: step " << (converged ? "converged" : "not converged") << ", " << "10 Newton iterations: step "
+			  << (convergedAgain ? "converged" : "not converged") << " (" << simulator.getNewtonIterations() << " iterations)\n";
+
+	// Report
+	const bool passed = (mismatches == 0) && reportedPassed && recoveredPassed;
+	std::cout << (passed ? "PASSED" : "FAILED") << "\n";
+
+	// Exit program
+	return passed ? 0 : 1;
+}
\ No newline at end of file
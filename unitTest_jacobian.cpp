@@ -0,0 +1,115 @@
+// Libraries
+#include "DroneRopeCargoDynamics.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+// Computes the derivative of the state vector, with the output vector following from the state vector
+StateArray calculateDerivative(const StateArray& stateVector, const ControlArray& controlVector, const ParameterArray& parameterList, bool dynamicsType)
+{
+	OutputArray outputVector{};
+	StateArray dynamicsStateVector{};
+	DroneRopeCargoDynamics::calculateOutputArray(stateVector, outputVector);
+	DroneRopeCargoDynamics::calculateDerivativeStateVector(stateVector, controlVector, outputVector, parameterList, dynamicsType, dynamicsStateVector);
+	return dynamicsStateVector;
+}
+
+// Compares the analytic Jacobians with central finite differences, returns the number of mismatching entries
+int compareJacobian(const char* name, const StateArray& stateVector, const ControlArray& controlVector, const ParameterArray& parameterList, bool dynamicsType)
+{
+	// Analytic Jacobians
+	StateJacobianArray stateJacobian{};
+	ControlJacobianArray controlJacobian{};
+	DroneRopeCargoDynamics::calculateJacobian(stateVector, controlVector, parameterList, dynamicsType, stateJacobian, controlJacobian);
+
+	// Tolerances (relative to the largest entry of a row)
+	const double delta = 1e-6;
+	const double tolerance = 1e-5;
+	int failures = 0;
+
+	// Compares a single entry
+	auto compare = [&](const char* matrix, std::size_t i, std::size_t j, double analytic, double finiteDifference, double rowScale) {
+		if (std::fabs(analytic - finiteDifference) > tolerance * (1 + rowScale)) {
+			std::cout << name << ": " << matrix << "(" << i << ", " << j << ") = " << analytic << ", finite difference = " << finiteDifference << "\n";
+			failures++;
+		}
+	};
+
+	// df/dx
+	StateJacobianArray stateJacobianFiniteDifference{};
+	for (std::size_t j = 0; j < stateVector.size(); j++) {
+		StateArray stateVectorPlus = stateVector, stateVectorMinus = stateVector;
+		stateVectorPlus[j] += delta;
+		stateVectorMinus[j] -= delta;
+		const StateArray dynamicsPlus = calculateDerivative(stateVectorPlus, controlVector, parameterList, dynamicsType);
+		const StateArray dynamicsMinus = calculateDerivative(stateVectorMinus, controlVector, parameterList, dynamicsType);
+		for (std::size_t i = 0; i < stateVector.size(); i++) {
+			stateJacobianFiniteDifference[i][j] = (dynamicsPlus[i] - dynamicsMinus[i]) / (2 * delta);
+		}
+	}
+	for (std::size_t i = 0; i < stateVector.size(); i++) {
+		double rowScale = 0;
+		for (std::size_t j = 0; j < stateVector.size(); j++) { rowScale = std::max(rowScale, std::fabs(stateJacobianFiniteDifference[i][j])); }
+		for (std::size_t j = 0; j < stateVector.size(); j++) { compare("df/dx", i, j, stateJacobian[i][j], stateJacobianFiniteDifference[i][j], rowScale); }
+	}
+
+	// df/du
+	ControlJacobianArray controlJacobianFiniteDifference{};
+	for (std::size_t j = 0; j < controlVector.size(); j++) {
+		ControlArray controlVectorPlus = controlVector, controlVectorMinus = controlVector;
+		controlVectorPlus[j] += delta;
+		controlVectorMinus[j] -= delta;
+		const StateArray dynamicsPlus = calculateDerivative(stateVector, controlVectorPlus, parameterList, dynamicsType);
+		const StateArray dynamicsMinus = calculateDerivative(stateVector, controlVectorMinus, parameterList, dynamicsType);
+		for (std::size_t i = 0; i < stateVector.size(); i++) {
+			controlJacobianFiniteDifference[i][j] = (dynamicsPlus[i] - dynamicsMinus[i]) / (2 * delta);
+		}
+	}
+	for (std::size_t i = 0; i < stateVector.size(); i++) {
+		const double rowScale = std::max(std::fabs(controlJacobianFiniteDifference[i][0]), std::fabs(controlJacobianFiniteDifference[i][1]));
+		for (std::size_t j = 0; j < controlVector.size(); j++) { compare("df/du", i, j, controlJacobian[i][j], controlJacobianFiniteDifference[i][j], rowScale); }
+	}
+
+	return failures;
+}
+
+// Main function
+int main()
+{
+	/* ---------------------------------- PARAMETERS ---------------------------------- */
+
+	// Initialize parameter list (see DynamicSystemArrays.h)
+	double gravitationalConstant = 9.81;	// in [m / s^2]
+	double massDrone = 3;					// in [kg]
+	double dragConstantDrone = 0.1;			// in [N s^2 / m^2]
+	double ropeInitialLength = 1.5;			// in [m]
+	double ropeDamping = 50;				// in [N s / m]
+	double ropeStiffness = 40000;			// in [N / m]
+	double massCargo = 2;					// in [kg]
+	double dragConstantCargo = 0.2;			// in [N s^2 / m^2]
+
+	const ParameterArray parameterList = { gravitationalConstant, massDrone, dragConstantDrone, ropeInitialLength, ropeDamping, ropeStiffness, massCargo, dragConstantCargo };
+
+	// Specify a control vector
+	const ControlArray controlVector = { 35, 0.4 };
+
+	/* ---------------------------------- ACTIONS ---------------------------------- */
+
+	// Initialize states (taut: rope longer than its initial length; slack: shorter)
+	const StateArray droneStateVector = { 0.3, 2.0, 0.25, 1.2, -0.7, 0, 0, 0, 0 };
+	const StateArray tautStateVector = { 0.3, 2.0, 0.25, 1.2, -0.7, -0.4, 0.49, 0.9, -0.5 };
+	const StateArray slackStateVector = { 0.3, 2.0, 0.25, 1.2, -0.7, -0.2, 1.0, 0.9, -0.5 };
+
+	// Compare
+	int failures = 0;
+	failures += compareJacobian("drone", droneStateVector, controlVector, parameterList, false);
+	failures += compareJacobian("drone (cargo states ignored)", tautStateVector, controlVector, parameterList, false);
+	failures += compareJacobian("drone + cargo, taut rope", tautStateVector, controlVector, parameterList, true);
+	failures += compareJacobian("drone + cargo, slack rope", slackStateVector, controlVector, parameterList, true);
+
+	// Report
+	std::cout << (failures == 0 ? "PASSED" : "FAILED") << "\n";
+
+	// Exit program
+	return (failures == 0) ? 0 : 1;
+}
\ No newline at end of file
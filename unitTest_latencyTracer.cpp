@@ -0,0 +1,102 @@
+// Libraries
+#include "LatencyTracer.h"
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Main function
+int main()
+{
+	/* ---------------------------------- SETTINGS ---------------------------------- */
+
+	const unsigned numberOfThreads = 4;
+	const std::uint64_t numberOfValuesPerThread = 500000;	// Values 1, 2, ..., in [ns]
+	const double relativeError = 1.0 / 32;					// Half the width of the widest bin, relative to its values
+	const double period = 0.01;								// Deadline of the callbacks in [s]
+	const std::int64_t microsecond = 1000;					// in [ns]
+
+	/* ---------------------------------- ACTIONS ---------------------------------- */
+
+	// 1. Bins: contiguous and increasing, each value in the bin it is counted in
+	int binMismatches = 0;
+	for (std::size_t bin = 0; bin + 1 < LatencyHistogram::numberOfBins; bin++) {
+		const std::uint64_t lowerBound = LatencyHistogram::getBinLowerBound(bin);
+		const std::uint64_t upperBound = lowerBound + LatencyHistogram::getBinWidth(bin);
+		binMismatches += (LatencyHistogram::toBin(lowerBound) != bin) || (LatencyHistogram::toBin(upperBound - 1) != bin)
+						 || (LatencyHistogram::getBinLowerBound(bin + 1) != upperBound);
+	}
+	binMismatches += (LatencyHistogram::toBin(UINT64_MAX) != LatencyHistogram::numberOfBins - 1);
+	std::cout << "Bins: " << LatencyHistogram::numberOfBins << " bins, " << binMismatches << " mismatches\n";
+
+	// 2. Threads adding at once: no value lost, quantiles within the bin width
+	LatencyHistogram histogram;
+	std::vector<std::thread> threads;
+	for (unsigned thread = 0; thread < numberOfThreads; thread++) {
+		threads.emplace_back([&histogram, thread, numberOfThreads, numberOfValuesPerThread]() {
+			for (std::uint64_t value = thread + 1; value <= numberOfThreads * numberOfValuesPerThread; value += numberOfThreads) {
+				histogram.add(value);
+			}
+		});
+	}
+	for (std::thread& thread : threads) {
+		thread.join();
+	}
+
+	const double numberOfValues = double(numberOfThreads * numberOfValuesPerThread);
+	double largestError = 0;
+	for (double probability : { 0.001, 0.1, 0.5, 0.9, 0.99, 0.999 }) {
+		const double exactQuantile = std::ceil(probability * numberOfValues);
+		largestError = std::max(largestError, std::abs(double(histogram.getQuantile(probability)) - exactQuantile) / exactQuantile);
+	}
+	const bool threadsPassed = (histogram.getCount() == numberOfThreads * numberOfValuesPerThread) && (histogram.getMinimum() == 1)
+							   && (histogram.getMaximum() == numberOfThreads * numberOfValuesPerThread) && (histogram.getMean() == (numberOfValues + 1) / 2)
+							   && (histogram.getQuantile(1) == histogram.getMaximum()) && (histogram.getQuantile(0) == 1) && (largestError <= relativeError);
+	std::cout << "Threads: " << histogram.getCount() << " of " << numberOfThreads * numberOfValuesPerThread << " values, mean " << histogram.getMean()
+			  << " ns, largest relative error of the quantiles " << largestError << "\n";
+
+	// 3. Hops of a loop with known stamps: simulator --> buffer --> controller --> simulator
+	LatencyTracer buffer("simulator --> buffer (state)", period);
+	LatencyTracer controller("buffer --> controller (state)", period);
+	LatencyTracer simulator("controller --> simulator (control)", period);
+	for (std::uint64_t sequence = 1; sequence <= 100; sequence++) {
+		if (sequence == 50 || sequence == 51) {
+			continue; // Lost between the simulator and the buffer
+		}
+		const std::int64_t origin = std::int64_t(sequence) * 10000 * microsecond;
+
+		// Buffer: 10 us transit, held for 100 us; drops every tenth sample
+		buffer.recordReceive({ sequence, origin, origin }, origin + 10 * microsecond);
+		buffer.recordProcess(origin + 10 * microsecond, origin + 12 * microsecond);
+		if (sequence % 10 == 0) {
+			buffer.recordDrop();
+			continue;
+		}
+		buffer.recordPublish(origin + 10 * microsecond, origin + 110 * microsecond);
+
+		// Controller: 20 us transit, computes for 30 us (every 25th computation misses its deadline)
+		controller.recordReceive({ sequence, origin, origin + 110 * microsecond }, origin + 130 * microsecond);
+		controller.recordProcess(origin + 130 * microsecond, origin + ((sequence % 25 == 0) ? 20000 : 160) * microsecond);
+		controller.recordPublish(origin + 130 * microsecond, origin + 160 * microsecond);
+
+		// Simulator: 40 us transit of the control, stamped with the origin of its state
+		simulator.recordReceive({ sequence, origin, origin + 160 * microsecond }, origin + 200 * microsecond);
+	}
+
+	const std::string report = LatencyTracer::formatReport({ &buffer, &controller, &simulator });
+	const bool hopsPassed = (buffer.getNumberOfMessages() == 98) && (buffer.getNumberOfLostSamples() == 2) && (buffer.getNumberOfDroppedSamples() == 9)
+							&& (controller.getNumberOfLostSamples() == 10) && (controller.getNumberOfDeadlineOverruns() == 2)
+							&& (simulator.getNumberOfMessages() == 89) && (simulator.getNumberOfDeadlineOverruns() == 0)
+							&& (buffer.getResidenceHistogram().getQuantile(0.5) == 100 * microsecond)	// Middle of its bin, at most the maximum
+							&& (simulator.getAgeHistogram().getMinimum() == 200 * microsecond) && (simulator.getTransitHistogram().getMaximum() == 40 * microsecond)
+							&& (report.find("loop age [us]    : p50 200.0") != std::string::npos);
+	std::cout << report;
+
+	// Report
+	const bool passed = (binMismatches == 0) && threadsPassed && hopsPassed;
+	std::cout << (passed ? "PASSED" : "FAILED") << "\n";
+
+	// Exit program
+	return passed ? 0 : 1;
+}
\ No newline at end of file
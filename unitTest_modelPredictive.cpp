@@ -0,0 +1,99 @@
+// Libraries
+#include "DroneControllerModelPredictive.h"
+#include "DroneRopeCargoSimulator.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+// Initializes a simulator with the drone hovering and the cargo hanging at rest
+void initializeSimulator(DroneRopeCargoSimulator& simulator)
+{
+	simulator.setConstantDroneParameters(3, 0.1);			// in [kg], [N s^2 / m^2]
+	simulator.setConstantRopeParameters(1.5, 40000, 50);	// in [m], [N / m], [N s / m]
+	simulator.setConstantCargoParameters(2, 0.1);			// in [kg], [N s^2 / m^2]
+	simulator.setImplementation(true, IntegrationType::RungeKuttaFourStageOutput);
+
+	const DynamicSystemParameters& parameters = simulator.getParameters();
+	simulator.setStateArray({ 0, 0, 0, 0, 0, 0, -(parameters.ropeLengthInitial + parameters.massCargo * parameters.gravitationalConstant / parameters.ropeStiffness), 0, 0 });
+}
+
+// Main function
+int main()
+{
+	/* ---------------------------------- SETTINGS ---------------------------------- */
+
+	const std::array<double, 2> referenceVelocity = { 1.0, 0 };	// in [m / s]
+	const int numberOfTicksMoving = 300;						// 3 s
+	const int numberOfTicksStopping = 200;						// 2 s
+	const int numberOfComparedTicks = 5;
+
+	/* ---------------------------------- ACTIONS ---------------------------------- */
+
+	// 1. The control does not depend on the number of workers
+	DroneRopeCargoSimulator simulator;
+	initializeSimulator(simulator);
+	StateArray stateVector = simulator.getStateArray();
+	stateVector[7] = 0.5; // Swinging cargo
+
+	WorkStealingThreadPool singleWorker(1), threeWorkers(3);
+	DroneControllerModelPredictive serialController, singleWorkerController, threeWorkersController;
+	singleWorkerController.setThreadPool(&singleWorker);
+	threeWorkersController.setThreadPool(&threeWorkers);
+
+	int mismatches = 0;
+	for (DroneControllerModelPredictive* controller : { &serialController, &singleWorkerController, &threeWorkersController }) {
+		controller->setModel(true, simulator.getParameters());
+		controller->setVelocityVector(referenceVelocity);
+	}
+	for (int tick = 0; tick < numberOfComparedTicks; tick++) {
+		const ControlArray controlVector = serialController.calculateControlArray(stateVector);
+		mismatches += (singleWorkerController.calculateControlArray(stateVector) != controlVector) || (singleWorkerController.getRolloutCosts() != serialController.getRolloutCosts());
+		mismatches += (threeWorkersController.calculateControlArray(stateVector) != controlVector) || (threeWorkersController.getRolloutCosts() != serialController.getRolloutCosts());
+	}
+
+	std::cout << "Equal control for 0, 1 and 3 workers over " << numberOfComparedTicks << " ticks: " << ((mismatches == 0) ? "yes" : "NO") << "\n";
+
+	// 2. Closed loop: follow the reference velocity, then stop, with little swing of the cargo
+	DroneControllerModelPredictive controller;
+	controller.setModel(true, simulator.getParameters());
+	controller.setThreadPool(&threeWorkers);
+	stateVector = simulator.getStateArray();
+
+	double peakSwingAngle = 0, meanTickTime = 0, maximumTickTime = 0;
+	StateArray movingStateVector{};
+	for (int tick = 0; tick < numberOfTicksMoving + numberOfTicksStopping; tick++) {
+		controller.setVelocityVector((tick < numberOfTicksMoving) ? referenceVelocity : std::array<double, 2>{ 0, 0 });
+
+		const auto start = std::chrono::steady_clock::now();
+		const ControlArray controlVector = controller.calculateControlArray(stateVector);
+		const double tickTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		meanTickTime += tickTime / (numberOfTicksMoving + numberOfTicksStopping);
+		maximumTickTime = std::max(maximumTickTime, tickTime);
+
+		simulator.simulationStep(controlVector, stateVector);
+		peakSwingAngle = std::max(peakSwingAngle, std::fabs(std::atan2(stateVector[5] - stateVector[0], stateVector[1] - stateVector[6])));
+		if (tick + 1 == numberOfTicksMoving) {
+			movingStateVector = stateVector;
+		}
+	}
+
+	const bool closedLoopPassed = (std::fabs(movingStateVector[3] - referenceVelocity[0]) < 0.2) && (std::fabs(stateVector[3]) < 0.2) && (std::fabs(stateVector[4]) < 0.2) && (peakSwingAngle < 0.3);
+
+	std::cout << "After " << numberOfTicksMoving * controller.getTimeStep() << " s: xDotDrone " << movingStateVector[3] << " m/s, after stopping: xDotDrone "
+			  << stateVector[3] << " m/s, peak swing angle " << peakSwingAngle << " rad\n";
+
+	// 3. A control tick fits in the control period (timer of the controller node)
+	const bool timingPassed = (meanTickTime < controller.getTimeStep());
+
+	std::cout << controller.getSettings().numberOfRollouts << " rollouts of " << controller.getSettings().horizon << " steps on " << threeWorkers.getNumberOfWorkers()
+			  << " workers: " << meanTickTime * 1000 << " ms per tick (maximum " << maximumTickTime * 1000 << " ms), control period " << controller.getTimeStep() * 1000
+			  << " ms, vectorized: " << (DroneRopeCargoBatchSimulator::isVectorized() ? "yes" : "no") << "\n";
+
+	// Report
+	const bool passed = (mismatches == 0) && closedLoopPassed && timingPassed;
+	std::cout << (passed ? "PASSED" : "FAILED") << "\n";
+
+	// Exit program
+	return passed ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,143 @@
+// Libraries
+#include "MonteCarloRunner.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+// Compares two aggregated metrics bit for bit, returns the number of mismatches
+int compareMetric(const MonteCarloMetricStatistics& first, const MonteCarloMetricStatistics& second)
+{
+	int mismatches = 0;
+	const double firstValues[] = { first.statistics.getMean(), first.statistics.getVariance(), first.statistics.getMinimum(), first.statistics.getMaximum(), first.quantiles.getQuantile(0.5), first.quantiles.getQuantile(0.99) };
+	const double secondValues[] = { second.statistics.getMean(), second.statistics.getVariance(), second.statistics.getMinimum(), second.statistics.getMaximum(), second.quantiles.getQuantile(0.5), second.quantiles.getQuantile(0.99) };
+	mismatches += (std::memcmp(firstValues, secondValues, sizeof(firstValues)) != 0);
+	mismatches += (first.statistics.getCount() != second.statistics.getCount()) + (first.quantiles.getCount() != second.quantiles.getCount());
+	return mismatches;
+}
+
+// Main function
+int main()
+{
+	/* ---------------------------------- SETTINGS ---------------------------------- */
+
+	const std::size_t numberOfValues = 100000;
+	const std::size_t numberOfRuns = 2000;
+	const std::uint64_t seed = 2024;
+
+	// Parameters drawn per run
+	MonteCarloParameterDistributions distributions;
+	distributions.massCargo = { DistributionType::Uniform, 0.5, 3 };					// in [kg]
+	distributions.ropeStiffness = { DistributionType::LogUniform, 500, 5000 };			// in [N / m]
+	distributions.ropeDamping = { DistributionType::Uniform, 2, 20 };					// in [N s / m]
+	distributions.dragConstantDrone = { DistributionType::Normal, 0.1, 0.01 };			// in [N s^2 / m^2]
+	distributions.dragConstantCargo = { DistributionType::Normal, 0.1, 0.01 };			// in [N s^2 / m^2]
+	distributions.timeConstantX = { DistributionType::Uniform, 0.3, 1.0 };				// in [s]
+	distributions.timeConstantY = { DistributionType::Uniform, 0.3, 1.0 };				// in [s]
+	distributions.timeConstantTheta = { DistributionType::Uniform, 0.05, 0.15 };		// in [s]
+
+	MonteCarloScenario scenario;
+	scenario.duration = 5; // in [s]
+
+	/* ---------------------------------- ACTIONS ---------------------------------- */
+
+	// 1. Online statistics and quantile sketch against two-pass statistics and sorted values
+	SplitMix64 generator{ seed };
+	std::vector<double> values(numberOfValues);
+	RunningStatistics statistics, firstHalf, secondHalf;
+	HistogramQuantileSketch quantiles(0, 10, 1000);
+	for (std::size_t i = 0; i < numberOfValues; i++) {
+		values[i] = 5 + 2 * std::cos(6.283185307179586 * generator.nextUniform()) * std::sqrt(generator.nextUniform());
+		statistics.add(values[i]);
+		(i < numberOfValues / 2 ? firstHalf : secondHalf).add(values[i]);
+		quantiles.add(values[i]);
+	}
+	firstHalf.merge(secondHalf);
+
+	double mean = 0, variance = 0;
+	for (double value : values) {
+		mean += value / double(numberOfValues);
+	}
+	for (double value : values) {
+		variance += (value - mean) * (value - mean) / double(numberOfValues - 1);
+	}
+	std::sort(values.begin(), values.end());
+
+	double quantileError = 0;
+	for (double probability : { 0.01, 0.25, 0.5, 0.75, 0.99 }) {
+		quantileError = std::max(quantileError, std::abs(quantiles.getQuantile(probability) - values[std::size_t(probability * double(numberOfValues)) - 1]));
+	}
+	const bool statisticsPassed = std::abs(statistics.getMean() - mean) < 1e-12 && std::abs(statistics.getVariance() - variance) < 1e-12
+								  && std::abs(firstHalf.getMean() - mean) < 1e-12 && std::abs(firstHalf.getVariance() - variance) < 1e-12
+								  && statistics.getMinimum() == values.front() && statistics.getMaximum() == values.back() && quantileError <= quantiles.getBinWidth();
+
+	std::cout << "Statistics: mean " << statistics.getMean() << " (two-pass " << mean << "), variance " << statistics.getVariance() << " (two-pass " << variance
+			  << "), largest quantile error " << quantileError << " (bin width " << quantiles.getBinWidth() << ")\n";
+
+	// 2. Monte-Carlo result independent of the number of workers
+	MonteCarloRunner runner(scenario, distributions);
+	runner.setQuantileUpperBounds(0.5, 200);
+
+	MonteCarloResult referenceResult;
+	int mismatches = 0;
+	for (std::size_t numberOfWorkers : { 1, 2, 3, 8 }) {
+		WorkStealingThreadPool threadPool(numberOfWorkers);
+		auto start = std::chrono::steady_clock::now();
+		const MonteCarloResult result = runner.run(numberOfRuns, seed, threadPool);
+		auto end = std::chrono::steady_clock::now();
+
+		if (numberOfWorkers == 1) {
+			referenceResult = result;
+		}
+		mismatches += compareMetric(result.peakSwingAngle, referenceResult.peakSwingAngle) + compareMetric(result.settlingTime, referenceResult.settlingTime)
+					  + compareMetric(result.peakRopeForce, referenceResult.peakRopeForce) + (result.numberOfDivergedRuns != referenceResult.numberOfDivergedRuns);
+
+		std::cout << numberOfWorkers << " worker(s): " << std::chrono::duration<double, std::milli>(end - start).count() << " ms for " << numberOfRuns << " runs\n";
+	}
+
+	// 3. A single run is reproducible from its index
+	const MonteCarloRunMetrics firstMetrics = runner.simulateRun(17, seed);
+	const MonteCarloRunMetrics secondMetrics = runner.simulateRun(17, seed);
+	mismatches += (firstMetrics.peakSwingAngle != secondMetrics.peakSwingAngle) + (firstMetrics.settlingTime != secondMetrics.settlingTime) + (firstMetrics.peakRopeForce != secondMetrics.peakRopeForce);
+	mismatches += (referenceResult.peakSwingAngle.statistics.getCount() + referenceResult.numberOfDivergedRuns != numberOfRuns);
+
+	std::cout << "Peak swing angle [rad]: mean " << referenceResult.peakSwingAngle.statistics.getMean() << ", standard deviation " << referenceResult.peakSwingAngle.statistics.getStandardDeviation()
+			  << ", median " << referenceResult.peakSwingAngle.quantiles.getQuantile(0.5) << ", 99% " << referenceResult.peakSwingAngle.quantiles.getQuantile(0.99) << "\n";
+	std::cout << "Settling time [s]: mean " << referenceResult.settlingTime.statistics.getMean() << ", maximum " << referenceResult.settlingTime.statistics.getMaximum()
+			  << ", 90% " << referenceResult.settlingTime.quantiles.getQuantile(0.9) << "\n";
+	std::cout << "Peak rope force [N]: mean " << referenceResult.peakRopeForce.statistics.getMean() << ", minimum " << referenceResult.peakRopeForce.statistics.getMinimum()
+			  << ", maximum " << referenceResult.peakRopeForce.statistics.getMaximum() << ", diverged runs: " << referenceResult.numberOfDivergedRuns << "\n";
+	std::cout << "Mismatches between numbers of workers: " << mismatches << "\n";
+
+	// 4. Wide normal distributions are truncated to positive values, distributions that can draw non-positive values are ignored
+	const ParameterDistribution wideDistribution{ DistributionType::Normal, 0.5, 1.0 }; // 31% of the normal draws negative
+	SplitMix64 wideGenerator{ seed };
+	double smallestDraw = wideDistribution.first, wideMean = 0;
+	for (std::size_t i = 0; i < numberOfValues; i++) {
+		const double value = MonteCarloRunner::drawParameter(wideDistribution, wideGenerator);
+		smallestDraw = std::min(smallestDraw, value);
+		wideMean += value / double(numberOfValues);
+	}
+
+	MonteCarloParameterDistributions invalidDistributions = distributions;
+	invalidDistributions.ropeStiffness = { DistributionType::Normal, -1000, 100 };
+	int rejectionMismatches = 0;
+	rejectionMismatches += runner.setDistributions(invalidDistributions);
+	rejectionMismatches += (runner.getDistributions().ropeStiffness.type != DistributionType::LogUniform);
+	rejectionMismatches += MonteCarloRunner::isPositive({ DistributionType::Uniform, 0, 1 }) + MonteCarloRunner::isPositive({ DistributionType::Constant, 0 })
+						   + !MonteCarloRunner::isPositive({ DistributionType::Normal, 0.1, 10 });
+
+	// Truncated normal distribution (mean 0.5, standard deviation 1 before truncation at zero): mean 1.0091
+	std::cout << "Wide normal distribution: smallest draw " << smallestDraw << ", mean " << wideMean << " (truncated: 1.0091)"
+			  << ", mismatches of rejected distributions: " << rejectionMismatches << "\n";
+	mismatches += (smallestDraw <= 0) + (std::abs(wideMean - 1.0091) > 0.02) + rejectionMismatches;
+
+	// Report
+	const bool passed = statisticsPassed && (mismatches == 0);
+	std::cout << (passed ? "PASSED" : "FAILED") << "\n";
+
+	// Exit program
+	return passed ? 0 : 1;
+}
\ No newline at end of file
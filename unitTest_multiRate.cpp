@@ -0,0 +1,108 @@
+// Libraries
+#include "DroneRopeCargoSimulator.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+// Initializes a simulator with a swinging cargo on a stiff, taut rope
+void initialize(DroneRopeCargoSimulator& simulator, IntegrationType integrationType, double ropeStiffness)
+{
+	// Constant parameters
+	simulator.setConstantDroneParameters(3, 0.1);				// in [kg], [N s^2 / m^2]
+	simulator.setConstantRopeParameters(1.5, ropeStiffness, 20);	// in [m], [N / m], [N s / m]
+	simulator.setConstantCargoParameters(2, 0.1);				// in [kg], [N s^2 / m^2]
+
+	// Set implementation
+	simulator.setImplementation(true, integrationType);
+
+	// Set state
+	simulator.setStateArray({ 0, 0, 0, 0, 0, 0.3, -1.47, 1.0, 0 });
+	simulator.setOutputVector();
+}
+
+// Steps a simulator over a duration with a constant control vector
+StateArray simulate(DroneRopeCargoSimulator& simulator, double duration, const ControlArray& controlVector)
+{
+	StateArray stateVector = simulator.getStateArray();
+	const long numberOfSteps = std::lround(duration / simulator.getTimeStep());
+	for (long step = 0; step < numberOfSteps; step++) {
+		simulator.simulationStep(controlVector, stateVector);
+	}
+	return stateVector;
+}
+
+// Maximum absolute difference between two state vectors; infinite if a state is not finite
+double calculateError(const StateArray& stateVector, const StateArray& referenceStateVector)
+{
+	double error = 0;
+	for (std::size_t i = 0; i < stateVector.size(); i++) {
+		if (!std::isfinite(stateVector[i])) { return INFINITY; }
+		error = std::max(error, std::fabs(stateVector[i] - referenceStateVector[i]));
+	}
+	return error;
+}
+
+// Main function
+int main()
+{
+	/* ---------------------------------- SETTINGS ---------------------------------- */
+
+	const ControlArray controlVector = { 49.05, 0 };					// Hover thrust
+	const double duration = 1;											// in [s]
+	const double referenceTimeStep = 0.00001;							// in [s]
+	const std::vector<double> ropeStiffnesses = { 4e4, 1e5, 2e5 };		// in [N / m]
+	const double tolerance = 1e-2;										// Multi-rate: final state w.r.t. the reference
+
+	/* ---------------------------------- ACTIONS ---------------------------------- */
+
+	// 1. Stiff ropes: multi-rate integration stays close to fine-step RK4, with k = ceil(h / fastTimeStep) substeps
+	int mismatches = 0;
+	for (double ropeStiffness : ropeStiffnesses) {
+		// Reference (RK4 with output vector per stage, small time step)
+		DroneRopeCargoSimulator referenceSimulator;
+		initialize(referenceSimulator, IntegrationType::RungeKuttaFourStageOutput, ropeStiffness);
+		referenceSimulator.setTimeStep(referenceTimeStep);
+		const StateArray referenceStateVector = simulate(referenceSimulator, duration, controlVector);
+
+		// Multi-rate
+		DroneRopeCargoSimulator simulator;
+		initialize(simulator, IntegrationType::MultiRate, ropeStiffness);
+		const double error = calculateError(simulate(simulator, duration, controlVector), referenceStateVector);
+
+		// Fast time step from the parameters, substeps from the fast time step
+		const double fastTimeStep = DroneRopeCargoDynamics::calculateRopeTimeStep(simulator.getParameters());
+		const int substeps = static_cast<int>(std::ceil(simulator.getTimeStep() / fastTimeStep));
+
+		const bool passed = (error < tolerance) && (simulator.getFastTimeStep() == fastTimeStep) && (simulator.getNumberOfSubsteps() == substeps) && (substeps > 1);
+		mismatches += !passed;
+
+		std::cout << ropeStiffness << " N/m: " << simulator.getNumberOfSubsteps() << " substeps (fast time step " << simulator.getFastTimeStep() << " s), error "
+				  << error << (passed ? "" : " (NOT AS EXPECTED)") << "\n";
+	}
+
+	// 2. Fast time step follows the parameters (not the step): stiffer rope --> more substeps; fixed substeps are kept
+	DroneRopeCargoSimulator simulator;
+	initialize(simulator, IntegrationType::MultiRate, 4e4);
+	const int substepsSoft = simulator.getNumberOfSubsteps();
+	simulator.setConstantRopeParameters(1.5, 1e6, 20);
+	const int substepsStiff = simulator.getNumberOfSubsteps();
+	simulator.setConstantCargoParameters(20, 0.1);
+	const bool updatedPassed = (substepsStiff > substepsSoft) && (simulator.getFastTimeStep() == DroneRopeCargoDynamics::calculateRopeTimeStep(simulator.getParameters()));
+
+	simulator.setSubsteps(3);
+	simulate(simulator, 0.1, controlVector);
+	const bool fixedPassed = (simulator.getNumberOfSubsteps() == 3);
+
+	simulator.setImplementation(false, IntegrationType::MultiRate);
+	const bool droneOnlyPassed = (simulator.getFastTimeStep() == 0);
+
+	std::cout << "Substeps: " << substepsSoft << " (4e4 N/m), " << substepsStiff << " (1e6 N/m), fixed " << simulator.getNumberOfSubsteps() << "\n";
+
+	// Report
+	const bool passed = (mismatches == 0) && updatedPassed && fixedPassed && droneOnlyPassed;
+	std::cout << (passed ? "PASSED" : "FAILED") << "\n";
+
+	// Exit program
+	return passed ? 0 : 1;
+}
\ No newline at end of file
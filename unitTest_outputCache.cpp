@@ -0,0 +1,119 @@
+// Libraries
+#include "DroneRopeCargoDynamicsExtended.h"
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+// Compares the cached output vector with the output vector computed from the state vector, returns the number of mismatches
+int compareOutput(const char* name, const DroneRopeCargoDynamicsExtended& dynamics)
+{
+	// Expected output vector
+	const StateArray stateVector = dynamics.getStateArray();
+	OutputArray expectedOutputVector{};
+	DroneRopeCargoDynamics::calculateOutputArray(stateVector, expectedOutputVector);
+	expectedOutputVector[2] = atan2(stateVector[5] - stateVector[0], stateVector[6] - stateVector[1]);
+
+	// Cached output vector, through every getter
+	const std::vector<double> outputVector = dynamics.getOutputVector();
+	int mismatches = 0;
+	mismatches += (dynamics.getOutputArray() != expectedOutputVector);
+	mismatches += (dynamics.getRopeLength() != expectedOutputVector[0]);
+	mismatches += (dynamics.getRopeRateOfChange() != expectedOutputVector[1]);
+	mismatches += (dynamics.getRopeAngle() != expectedOutputVector[2]);
+	mismatches += (outputVector.size() != 3) || (outputVector[0] != expectedOutputVector[0]) || (outputVector[2] != expectedOutputVector[2]);
+
+	std::cout << name << ": rope length " << outputVector[0] << ", rope angle " << outputVector[2] << ", mismatches: " << mismatches << "\n";
+
+	return mismatches;
+}
+
+// Main function
+int main()
+{
+	/* ---------------------------------- SETTINGS ---------------------------------- */
+
+	const int numberOfReads = 1000000;
+
+	/* ---------------------------------- ACTIONS ---------------------------------- */
+
+	// 1. Output vector follows every way of changing the state vector
+	DroneRopeCargoDynamicsExtended dynamics;
+	int mismatches = 0;
+
+	dynamics.setStateArray({ 0, 0, 0, 0, 0, 0.3, -1.5, 1.0, 0 });
+	mismatches += compareOutput("setStateArray", dynamics);
+
+	dynamics.setXCargo(-0.4);
+	mismatches += compareOutput("setXCargo", dynamics);
+
+	dynamics.setYDotDrone(2.0);
+	mismatches += compareOutput("setYDotDrone", dynamics);
+
+	dynamics.setDroneStateVector({ 1, 2, 0, 0.5, 0 });
+	mismatches += compareOutput("setDroneStateVector", dynamics);
+
+	dynamics.setStateVector({ 0, 0, 0, 0, 0, 0, 0, 0, 0 }); // Zero rope length
+	mismatches += compareOutput("setStateVector", dynamics);
+
+	// 2. Repeated reads are served from the cache
+	dynamics.setStateArray({ 0, 0, 0, 0, 0, 0.3, -1.5, 1.0, 0 });
+	double checksum = 0;
+	auto start = std::chrono::steady_clock::now();
+	for (int read = 0; read < numberOfReads; read++) {
+		checksum += dynamics.getRopeLength() + dynamics.getRopeRateOfChange() + dynamics.getRopeAngle();
+	}
+	auto end = std::chrono::steady_clock::now();
+	const double timeRead = std::chrono::duration<double, std::nano>(end - start).count() / numberOfReads;
+
+	std::cout << "Reading rope length, rate of change and angle: " << timeRead << " ns (checksum " << checksum << ")\n";
+
+	// 3. Overridden values are kept until the state vector changes, the other values still belong to the state vector
+	dynamics.setStateArray({ 0, 0, 0, 0, 0, 0.3, -1.5, 1.0, 0 });
+	const OutputArray computedOutputVector = dynamics.getOutputArray();
+	dynamics.setRopeLength(5.0);
+	dynamics.setRopeRateOfChange(7.0);
+	int overrideMismatches = 0;
+	overrideMismatches += (dynamics.getRopeLength() != 5.0) || (dynamics.getRopeRateOfChange() != 7.0);
+	overrideMismatches += (dynamics.getOutputArray() != OutputArray{ 5.0, 7.0, computedOutputVector[2] });
+	overrideMismatches += (dynamics.getOutputVector() != std::vector<double>{ 5.0, 7.0, computedOutputVector[2] }); // Extended: with rope angle
+
+	dynamics.setYDotCargo(0.5); // Overrides are dropped
+	overrideMismatches += compareOutput("override, then setYDotCargo", dynamics);
+
+	dynamics.setXCargo(0.1); // Override on a stale cache: the other values belong to the new state vector
+	dynamics.setRopeAngle(1.0);
+	const StateArray overrideStateVector = dynamics.getStateArray();
+	OutputArray overrideOutputVector{};
+	DroneRopeCargoDynamics::calculateOutputArray(overrideStateVector, overrideOutputVector);
+	overrideMismatches += (dynamics.getRopeAngle() != 1.0) || (dynamics.getRopeLength() != overrideOutputVector[0]);
+
+	std::cout << "Overrides of rope length, rate of change and angle, mismatches: " << overrideMismatches << "\n";
+	mismatches += overrideMismatches;
+
+	// 4. Const reads of a shared object with an outdated cache do not write to it (concurrent readers)
+	dynamics.setStateArray({ 0, 0, 0, 0, 0, 0.3, -1.5, 1.0, 0 });
+	dynamics.setXCargo(-0.2);
+	const DroneRopeCargoDynamicsExtended& sharedDynamics = dynamics;
+	const OutputArray sharedOutputVector = sharedDynamics.getOutputArray();
+	std::vector<int> threadMismatches(4, 0);
+	std::vector<std::thread> threads;
+	for (std::size_t thread = 0; thread < threadMismatches.size(); thread++) {
+		threads.emplace_back([&, thread]() {
+			for (int read = 0; read < numberOfReads / 100; read++) {
+				threadMismatches[thread] += (sharedDynamics.getOutputArray() != sharedOutputVector) || (sharedDynamics.getRopeLength() != sharedOutputVector[0]);
+			}
+		});
+	}
+	for (std::thread& thread : threads) { thread.join(); }
+	for (int threadMismatch : threadMismatches) { mismatches += threadMismatch; }
+	mismatches += compareOutput("concurrent reads", sharedDynamics);
+
+	// Report
+	const bool passed = (mismatches == 0);
+	std::cout << (passed ? "PASSED" : "FAILED") << "\n";
+
+	// Exit program
+	return passed ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,89 @@
+// Libraries
+#include "DroneRopeCargoSimulator.h"
+#include <cmath>
+#include <iostream>
+
+// Compares the parameter block with the parameters of the object, returns the number of mismatches
+int compareParameters(const char* name, const DroneRopeCargoDynamics& dynamics)
+{
+	const DynamicSystemParameters& parameters = dynamics.getParameters();
+	int mismatches = 0;
+	mismatches += (parameters.massDrone != dynamics.getMassDrone()) || (parameters.inverseMassDrone != 1 / dynamics.getMassDrone());
+	mismatches += (parameters.dragConstantDrone != dynamics.getDragConstantDrone());
+	mismatches += (parameters.ropeLengthInitial != dynamics.getRopeLengthInitial());
+	mismatches += (parameters.ropeStiffness != dynamics.getRopeStiffness());
+	mismatches += (parameters.ropeDamping != dynamics.getRopeDamping());
+	mismatches += (parameters.massCargo != dynamics.getMassCargo()) || (parameters.inverseMassCargo != 1 / dynamics.getMassCargo());
+	mismatches += (parameters.dragConstantCargo != dynamics.getDragConstantCargo());
+
+	std::cout << name << ": mismatches: " << mismatches << "\n";
+
+	return mismatches;
+}
+
+// Simulates the duration with a constant control vector, returns the final state vector
+StateArray simulate(DroneRopeCargoSimulator& simulator, double duration, const ControlArray& controlVector)
+{
+	StateArray stateVector = simulator.getStateArray();
+	const long numberOfSteps = std::lround(duration / simulator.getTimeStep());
+	for (long step = 0; step < numberOfSteps; step++) {
+		simulator.simulationStep(controlVector, stateVector);
+	}
+	return stateVector;
+}
+
+// Main function
+int main()
+{
+	/* ---------------------------------- ACTIONS ---------------------------------- */
+
+	// 1. Parameter block follows every setter of a single parameter
+	DroneRopeCargoSimulator simulator;
+	simulator.setConstantDroneParameters(3, 0.1);
+	simulator.setConstantRopeParameters(1.5, 40000, 50);
+	simulator.setConstantCargoParameters(2, 0.1);
+	simulator.setImplementation(true, IntegrationType::MultiRate);
+	int mismatches = compareParameters("setConstant*Parameters", simulator);
+
+	simulator.setMassDrone(4);
+	mismatches += compareParameters("setMassDrone", simulator);
+	simulator.setDragConstantDrone(0.2);
+	mismatches += compareParameters("setDragConstantDrone", simulator);
+	simulator.setRopeLengthInitial(2);
+	mismatches += compareParameters("setRopeLengthInitial", simulator);
+	simulator.setRopeStiffness(1e6);
+	mismatches += compareParameters("setRopeStiffness", simulator);
+	simulator.setRopeDamping(20);
+	mismatches += compareParameters("setRopeDamping", simulator);
+	simulator.setMassCargo(5);
+	mismatches += compareParameters("setMassCargo", simulator);
+	simulator.setDragConstantCargo(0.3);
+	mismatches += compareParameters("setDragConstantCargo", simulator);
+
+	// 2. Through the simulator, the fast time step of multi-rate integration follows as well
+	const bool fastTimeStepPassed = (simulator.getFastTimeStep() == DroneRopeCargoDynamics::calculateRopeTimeStep(simulator.getParameters()));
+
+	// 3. Same steps as a simulator with the same parameters set per group
+	DroneRopeCargoSimulator referenceSimulator;
+	referenceSimulator.setConstantDroneParameters(4, 0.2);
+	referenceSimulator.setConstantRopeParameters(2, 1e6, 20);
+	referenceSimulator.setConstantCargoParameters(5, 0.3);
+	referenceSimulator.setImplementation(true, IntegrationType::MultiRate);
+
+	const StateArray initialStateVector = { 0, 0, 0, 0, 0, 0.3, -1.99, 1.0, 0 };
+	const ControlArray controlVector = { 88.29, 0.1 };
+	simulator.setStateArray(initialStateVector);
+	simulator.setOutputVector();
+	referenceSimulator.setStateArray(initialStateVector);
+	referenceSimulator.setOutputVector();
+	const bool stepsPassed = (simulate(simulator, 0.5, controlVector) == simulate(referenceSimulator, 0.5, controlVector));
+
+	std::cout << "Fast time step: " << simulator.getFastTimeStep() << " s, steps equal: " << (stepsPassed ? "yes" : "no") << "\n";
+
+	// Report
+	const bool passed = (mismatches == 0) && fastTimeStepPassed && stepsPassed;
+	std::cout << (passed ? "PASSED" : "FAILED") << "\n";
+
+	// Exit program
+	return passed ? 0 : 1;
+}
\ No newline at end of file
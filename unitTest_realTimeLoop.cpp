@@ -0,0 +1,113 @@
+// Libraries
+#include "RealTimeLoop.h"
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <sched.h>
+
+// Time of the monotonic clock in [s]
+double currentTime()
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Runs a number of steps; one step lasts longer than the period. Returns the start and end times of the steps.
+std::vector<std::array<double, 2>> runWithOverrun(RealTimeLoop& loop, const RealTimeSettings& settings, std::size_t numberOfSteps, std::size_t overrunStep, double overrunDuration)
+{
+	std::vector<std::array<double, 2>> times;
+	times.reserve(numberOfSteps);
+	loop.setSettings(settings);
+	loop.start([&]() {
+		const double startTime = currentTime();
+		if (times.size() == overrunStep) {
+			std::this_thread::sleep_for(std::chrono::duration<double>(overrunDuration));
+		}
+		times.push_back({ startTime, currentTime() });
+		return times.size() < numberOfSteps;
+	});
+	loop.wait();
+	return times;
+}
+
+// Main function
+int main()
+{
+	/* ---------------------------------- SETTINGS ---------------------------------- */
+
+	const double period = 0.002;			// in [s]
+	const std::size_t numberOfSteps = 30;
+	const std::size_t overrunStep = 10;		// Step lasting longer than the period
+	const double overrunDuration = 0.007;	// in [s]; passes 3 releases
+	const double tolerance = 0.001;			// Wake-up latency allowed in [s]
+	const int priority = 10;				// SCHED_FIFO where permitted, such that other load does not delay the wake-ups
+	const int attempts = 5;					// Per timing check; a stall of the host (e.g. a virtual machine) spoils an attempt
+
+	/* ---------------------------------- ACTIONS ---------------------------------- */
+
+	// 1. Catch-up policies: time of the last step relative to the first (in periods), the releases missed, and one overrun (not one per catch-up step)
+	const std::vector<std::pair<CatchUpPolicy, std::string>> catchUpPolicies = {
+		{ CatchUpPolicy::Skip, "Skip" }, { CatchUpPolicy::CatchUp, "Catch up" }, { CatchUpPolicy::Restart, "Restart" } };
+	const std::vector<double> expectedLastStep = { 32, 29, 29 + overrunDuration / period };
+	const std::vector<std::uint64_t> expectedMissedPeriods = { 3, 0, 3 };
+
+	int mismatches = 0;
+	for (std::size_t policy = 0; policy < catchUpPolicies.size(); policy++) {
+		RealTimeSettings settings;
+		settings.period = period;
+		settings.priority = priority;
+		settings.catchUpPolicy = catchUpPolicies[policy].first;
+
+		bool policyPassed = false;
+		for (int attempt = 0; attempt < attempts && !policyPassed; attempt++) {
+			RealTimeLoop loop;
+			const std::vector<std::array<double, 2>> times = runWithOverrun(loop, settings, numberOfSteps, overrunStep, overrunDuration);
+			const double lastStep = (times.back()[0] - times.front()[0]) / period;
+			const double stepAfterOverrun = (times[overrunStep + 1][0] - times[overrunStep][1]) / period; // Catch up --> at once, restart --> one period
+
+			policyPassed = (times.size() == numberOfSteps) && (loop.getNumberOfSteps() == numberOfSteps) && (loop.getJitterHistogram().getCount() == numberOfSteps)
+						   && (std::abs(lastStep - expectedLastStep[policy]) * period < tolerance) && (loop.getNumberOfOverruns() == 1)
+						   && (loop.getNumberOfMissedPeriods() == expectedMissedPeriods[policy])
+						   && ((policy != 1) || (stepAfterOverrun * period < tolerance)) && ((policy != 2) || (std::abs(stepAfterOverrun - 1) * period < tolerance));
+
+			std::cout << catchUpPolicies[policy].second << ": last step after " << lastStep << " periods (expected " << expectedLastStep[policy] << "), next step "
+					  << stepAfterOverrun << " periods after the overrun, " << loop.getNumberOfOverruns() << " overruns, " << loop.getNumberOfMissedPeriods()
+					  << " missed periods, " << (policyPassed ? "as expected" : "NOT AS EXPECTED") << "\n";
+		}
+		mismatches += !policyPassed;
+	}
+
+	// 2. Cadence: steps stay on the schedule of the first one (no drift from the step duration or the wake-up latency)
+	RealTimeSettings settings;
+	settings.period = period;
+	settings.priority = priority;
+	bool cadencePassed = false;
+	for (int attempt = 0; attempt < attempts && !cadencePassed; attempt++) {
+		RealTimeLoop loop;
+		const std::vector<std::array<double, 2>> times = runWithOverrun(loop, settings, 100, 100, 0);
+		double largestDeviation = 0;
+		for (std::size_t step = 0; step < times.size(); step++) {
+			largestDeviation = std::max(largestDeviation, std::abs(times[step][0] - times.front()[0] - double(step) * period));
+		}
+		cadencePassed = (times.size() == 100) && (largestDeviation < tolerance) && (loop.getNumberOfMissedPeriods() == 0);
+		std::cout << "Cadence: " << times.size() << " steps, largest deviation from the schedule " << largestDeviation * 1e6 << " us\n" << loop.formatReport();
+	}
+
+	// 3. Settings: pinned to the current CPU; real-time scheduling and locked memory where permitted
+	settings.cpu = sched_getcpu();
+	settings.lockMemory = true;
+	RealTimeLoop realTimeLoop;
+	runWithOverrun(realTimeLoop, settings, 10, 10, 0);
+	const bool settingsPassed = realTimeLoop.isPinned() && !realTimeLoop.isRunning() && (realTimeLoop.getNumberOfSteps() == 10);
+	std::cout << "Settings: " << realTimeLoop.formatReport();
+
+	// Report
+	const bool passed = (mismatches == 0) && cadencePassed && settingsPassed;
+	std::cout << (passed ? "PASSED" : "FAILED") << "\n";
+
+	// Exit program
+	return passed ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,105 @@
+// Libraries
+#include "SingleProducerSingleConsumerRingBuffer.h"
+#include <array>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Record of the size of a state vector of the buffer nodes
+typedef std::array<double, 9> StateRecord;
+
+// Fills a record with its sequence number (torn records then have unequal elements)
+StateRecord makeRecord(std::uint64_t sequenceNumber)
+{
+	StateRecord record;
+	record.fill(double(sequenceNumber));
+	return record;
+}
+
+// Pushes five records into a buffer of capacity three and pops it empty
+std::vector<double> popAfterOverflow(OverflowPolicy overflowPolicy, std::uint64_t& numberOfDrops)
+{
+	SingleProducerSingleConsumerRingBuffer<StateRecord> buffer(3, overflowPolicy);
+	for (std::uint64_t sequenceNumber = 1; sequenceNumber <= 5; sequenceNumber++) {
+		buffer.push(makeRecord(sequenceNumber));
+	}
+
+	std::vector<double> popped;
+	StateRecord record;
+	while (buffer.pop(record)) {
+		popped.push_back(record[0]);
+	}
+	numberOfDrops = buffer.getNumberOfDrops();
+	return popped;
+}
+
+// Main function
+int main()
+{
+	/* ---------------------------------- SETTINGS ---------------------------------- */
+
+	const std::vector<std::pair<OverflowPolicy, std::string>> overflowPolicies = {
+		{ OverflowPolicy::DropNewest, "Drop newest" }, { OverflowPolicy::DropOldest, "Drop oldest" }, { OverflowPolicy::LatestValue, "Latest value" } };
+	const std::vector<std::vector<double>> expectedPopped = { { 1, 2, 3 }, { 3, 4, 5 }, { 5 } };
+	const std::vector<std::uint64_t> expectedDrops = { 2, 2, 4 };
+	const std::size_t capacity = 10;					// As the buffer nodes
+	const std::uint64_t numberOfPushes = 2000000;
+
+	/* ---------------------------------- ACTIONS ---------------------------------- */
+
+	int mismatches = 0;
+	for (std::size_t policy = 0; policy < overflowPolicies.size(); policy++) {
+		// 1. Overflow policy: which records remain
+		std::uint64_t numberOfDrops = 0;
+		const bool overflowPassed = (popAfterOverflow(overflowPolicies[policy].first, numberOfDrops) == expectedPopped[policy]) && (numberOfDrops == expectedDrops[policy]);
+
+		// 2. Producer and consumer thread: no torn records, in order, and every record pushed is popped, dropped or left
+		SingleProducerSingleConsumerRingBuffer<StateRecord> buffer(capacity, overflowPolicies[policy].first);
+		int tornRecords = 0, outOfOrderRecords = 0;
+
+		const auto start = std::chrono::steady_clock::now();
+		std::thread consumer([&]() {
+			StateRecord record;
+			double lastSequenceNumber = 0;
+			while (lastSequenceNumber < double(numberOfPushes)) {
+				if (!buffer.pop(record)) {
+					// The last record may have been dropped (drop newest)
+					if ((buffer.getNumberOfPushes() == numberOfPushes) && buffer.isEmpty()) {
+						break;
+					}
+					std::this_thread::yield();
+					continue;
+				}
+				for (double element : record) {
+					tornRecords += (element != record[0]);
+				}
+				outOfOrderRecords += (record[0] <= lastSequenceNumber);
+				lastSequenceNumber = record[0];
+			}
+		});
+		for (std::uint64_t sequenceNumber = 1; sequenceNumber <= numberOfPushes; sequenceNumber++) {
+			buffer.push(makeRecord(sequenceNumber));
+		}
+		consumer.join();
+		const double pushTime = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / numberOfPushes;
+
+		const bool threadsPassed = (tornRecords == 0) && (outOfOrderRecords == 0) && (buffer.getNumberOfPushes() == numberOfPushes)
+								   && (buffer.getNumberOfPushes() == buffer.getNumberOfPops() + buffer.getNumberOfDrops() + buffer.getSize())
+								   && (buffer.getMaximumSize() <= capacity);
+		mismatches += !(overflowPassed && threadsPassed);
+
+		std::cout << overflowPolicies[policy].second << ": overflow " << (overflowPassed ? "as expected" : "NOT AS EXPECTED") << ", " << buffer.getNumberOfPops()
+				  << " popped and " << buffer.getNumberOfDrops() << " dropped of " << numberOfPushes << " (maximum size " << buffer.getMaximumSize() << "), "
+				  << tornRecords << " torn, " << outOfOrderRecords << " out of order, " << pushTime << " ns per record\n";
+	}
+
+	// Report
+	const bool passed = (mismatches == 0);
+	std::cout << (passed ? "PASSED" : "FAILED") << "\n";
+
+	// Exit program
+	return passed ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,118 @@
+// Libraries
+#include "SharedMemorySimulatorAdapter.h"
+#include "SharedMemoryControllerAdapter.h"
+#include "DroneRopeCargoClosedLoop.h"
+#include <iostream>
+#include <string>
+#include <thread>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// Main function
+int main()
+{
+	/* ---------------------------------- SETTINGS ---------------------------------- */
+
+	const std::string segmentName = "unitTest_sharedMemory_" + std::to_string(getpid());
+	const std::uint32_t numberOfPublishes = 1000000;
+	const std::array<double, 2> referenceVelocity = { 1.0, 0 };	// in [m / s]
+	const double duration = 3;										// in [s]
+	const double timeout = 5;										// in [s]
+
+	/* ---------------------------------- ACTIONS ---------------------------------- */
+
+	// 1. Seqlock: a reader running alongside the writer never reads a torn record, and records arrive in order
+	SharedMemoryTransport transport;
+	bool passed = transport.create(segmentName);
+	std::cout << "Segment " << segmentName << ": " << (passed ? "created" : "NOT CREATED") << ", " << sizeof(SharedMemoryLayout) << " bytes\n";
+	if (!passed) {
+		std::cout << "FAILED\n";
+		return 1;
+	}
+
+	SharedMemoryChannel<StateRecord>& stateChannel = transport.getStateChannel();
+	int tornRecords = 0, outOfOrderRecords = 0, numberOfReads = 0;
+	std::thread reader([&]() {
+		StateRecord record;
+		std::uint32_t sequence = 0;
+		double lastValue = 0;
+		while (stateChannel.waitForNew(sequence, record, timeout, 100)) {
+			const StateArray values = { record.xdrone, record.xdotdrone, record.thetadrone, record.ydrone, record.ydotdrone,
+										record.xcargo, record.xdotcargo, record.ycargo, record.ydotcargo };
+			for (double value : values) {
+				tornRecords += (value != record.xdrone);
+			}
+			outOfOrderRecords += (record.xdrone <= lastValue);
+			lastValue = record.xdrone;
+			numberOfReads++;
+			if (record.xdrone == numberOfPublishes) {
+				break;
+			}
+		}
+	});
+	for (std::uint32_t publish = 1; publish <= numberOfPublishes; publish++) {
+		const double value = publish;
+		stateChannel.publish({ value, value, value, value, value, value, value, value, value });
+	}
+	reader.join();
+
+	const bool seqlockPassed = (tornRecords == 0) && (outOfOrderRecords == 0) && (stateChannel.getSequence() == 2 * numberOfPublishes);
+	std::cout << "Seqlock: " << numberOfReads << " of " << numberOfPublishes << " records read, " << tornRecords << " torn, " << outOfOrderRecords << " out of order\n";
+
+	// 2. Closed loop across processes: equal to the closed loop within one process (bit for bit)
+	DroneRopeCargoClosedLoop closedLoop;
+	DroneRopeCargoSimulator simulator = closedLoop.getSimulator();
+	const DynamicSystemParameters parameters = simulator.getParameters();
+	const StateArray directStateVector = closedLoop.run({ { duration, referenceVelocity } });
+
+	SharedMemoryTransport loopTransport;
+	loopTransport.create(segmentName + "_loop");
+	const pid_t child = fork();
+	if (child == 0) {
+		// Controller process
+		SharedMemoryTransport controllerTransport;
+		if (!controllerTransport.open(segmentName + "_loop", timeout)) {
+			_exit(2);
+		}
+		DroneControllerControlVector controller(0.2, 0.2, 0.1, 50); // As DroneRopeCargoClosedLoop
+		controller.setVelocityVector({ referenceVelocity[0], referenceVelocity[1] });
+		SharedMemoryControllerAdapter controllerAdapter(controller, controllerTransport);
+		controllerAdapter.setModel(simulator.getDynamicsType(), parameters.gravitationalConstant, parameters.massDrone, parameters.massCargo);
+		controllerAdapter.setSpinCount(0);
+		while (controllerAdapter.step(timeout)) {}
+		_exit(controllerAdapter.getNumberOfMissedStates() == 0 ? 0 : 1);
+	}
+
+	// Simulator process
+	SharedMemorySimulatorAdapter simulatorAdapter(simulator, loopTransport);
+	simulatorAdapter.setSpinCount(0);
+	simulatorAdapter.publishState();
+	const long numberOfSteps = std::lround(duration / simulator.getTimeStep());
+	for (long step = 0; step < numberOfSteps; step++) {
+		if (!simulatorAdapter.step(timeout)) {
+			break;
+		}
+	}
+	loopTransport.closeChannels();
+
+	int childStatus = -1;
+	waitpid(child, &childStatus, 0);
+	const bool loopPassed = (simulatorAdapter.getNumberOfSteps() == std::uint64_t(numberOfSteps)) && (simulator.getStateArray() == directStateVector)
+							&& WIFEXITED(childStatus) && (WEXITSTATUS(childStatus) == 0) && (simulatorAdapter.getNumberOfMissedControls() == 0);
+
+	std::cout << "Closed loop across processes: " << simulatorAdapter.getNumberOfSteps() << " of " << numberOfSteps << " steps, xDotDrone "
+			  << simulator.getStateArray()[3] << " m/s (within one process " << directStateVector[3] << " m/s), "
+			  << ((simulator.getStateArray() == directStateVector) ? "equal" : "NOT EQUAL") << ", controller exit status " << WEXITSTATUS(childStatus) << "\n";
+
+	// 3. Records map onto the state vector of the simulator and back
+	const StateArray stateVector = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+	const StateRecord stateRecord = StateRecord::fromStateArray(stateVector);
+	const bool recordPassed = (stateRecord.toStateArray() == stateVector) && (stateRecord.ydrone == 2) && (stateRecord.xdotdrone == 4) && (stateRecord.xdotcargo == 8);
+
+	// Report
+	passed = seqlockPassed && loopPassed && recordPassed;
+	std::cout << (passed ? "PASSED" : "FAILED") << "\n";
+
+	// Exit program
+	return passed ? 0 : 1;
+}
\ No newline at end of file
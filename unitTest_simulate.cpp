@@ -0,0 +1,108 @@
+// Libraries
+#include "DroneRopeCargoSimulator.h"
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+// Initializes a simulator with a hanging, swinging cargo
+void initializeSimulator(DroneRopeCargoSimulator& simulator)
+{
+	simulator.setConstantDroneParameters(3, 0.1);			// in [kg], [N s^2 / m^2]
+	simulator.setConstantRopeParameters(1.5, 40000, 50);	// in [m], [N / m], [N s / m]
+	simulator.setConstantCargoParameters(2, 0.1);			// in [kg], [N s^2 / m^2]
+	simulator.setImplementation(true, IntegrationType::RungeKuttaFourStageOutput);
+	simulator.setStateArray({ 0, 0, 0, 0, 0, 0.3, -1.5, 1.0, 0 });
+}
+
+// Main function
+int main()
+{
+	/* ---------------------------------- SETTINGS ---------------------------------- */
+
+	const std::vector<ControlScheduleEntry> controlSchedule = { { 0.5, { 49.05, 0.2 } }, { 0.25, { 60, -0.4 } }, { 0.25, { 45, 0 } } };
+	const std::size_t decimation = 10;
+	const double timedDuration = 20.0; // in [s]
+
+	/* ---------------------------------- ACTIONS ---------------------------------- */
+
+	// 1. Control schedule with a decimated trajectory equals stepping one step at a time
+	DroneRopeCargoSimulator simulator, referenceSimulator;
+	initializeSimulator(simulator);
+	initializeSimulator(referenceSimulator);
+
+	std::vector<TrajectorySample> samples(6); // Room for 6 of the 10 samples
+	TrajectoryBuffer trajectoryBuffer{ samples.data(), samples.size(), decimation };
+	const StateArray finalStateVector = simulator.simulate(controlSchedule, trajectoryBuffer);
+
+	int mismatches = 0;
+	std::size_t stepIndex = 0;
+	StateArray referenceStateVector{};
+	for (const ControlScheduleEntry& entry : controlSchedule) {
+		for (int step = 0; step < int(std::lround(entry.duration / referenceSimulator.getTimeStep())); step++) {
+			referenceSimulator.simulationStep(std::vector<double>{ entry.controlVector[0], entry.controlVector[1] });
+			referenceStateVector = referenceSimulator.getStateArray();
+			stepIndex++;
+
+			const std::size_t sampleIndex = stepIndex / decimation - 1;
+			if (stepIndex % decimation == 0 && sampleIndex < samples.size()) {
+				mismatches += (samples[sampleIndex].stateVector != referenceStateVector) + (samples[sampleIndex].time != referenceSimulator.getSimulationTime());
+			}
+		}
+	}
+	mismatches += (finalStateVector != referenceStateVector) + (simulator.getSimulationTime() != referenceSimulator.getSimulationTime());
+	mismatches += (trajectoryBuffer.numberOfSamples != samples.size()); // Buffer full, further samples dropped
+
+	std::cout << "Control schedule: " << stepIndex << " steps, " << trajectoryBuffer.numberOfSamples << " samples, mismatches: " << mismatches << "\n";
+
+	// 2. Held control vector equals the schedule with a single entry
+	DroneRopeCargoSimulator holdSimulator, scheduleSimulator;
+	initializeSimulator(holdSimulator);
+	initializeSimulator(scheduleSimulator);
+	const bool holdPassed = (holdSimulator.simulate(0.5, { 49.05, 0.2 }) == scheduleSimulator.simulate({ { 0.5, { 49.05, 0.2 } } }));
+	std::cout << "Held control vector: " << (holdPassed ? "equal" : "different") << "\n";
+
+	// 3. Duration or time step not positive (or NaN): no steps, state vector and simulation time unchanged
+	DroneRopeCargoSimulator invalidSimulator;
+	initializeSimulator(invalidSimulator);
+	const StateArray initialStateVector = invalidSimulator.getStateArray();
+	TrajectoryBuffer invalidTrajectoryBuffer{ samples.data(), samples.size(), 1 };
+	int invalidMismatches = 0;
+	for (double duration : { 0.0, -0.5, std::nan(""), -HUGE_VAL }) {
+		invalidMismatches += (invalidSimulator.simulate(duration, { 49.05, 0.2 }) != initialStateVector);
+		invalidMismatches += (invalidSimulator.simulate({ { duration, { 49.05, 0.2 } } }, invalidTrajectoryBuffer) != initialStateVector) + (invalidTrajectoryBuffer.numberOfSamples != 0);
+	}
+	for (double timeStep : { 0.0, -0.01, std::nan("") }) {
+		invalidSimulator.setTimeStep(timeStep);
+		invalidMismatches += (invalidSimulator.simulate(0.5, { 49.05, 0.2 }) != initialStateVector);
+		invalidMismatches += (invalidSimulator.simulate(-0.5, { 49.05, 0.2 }) != initialStateVector); // Negative ratio is positive
+	}
+	invalidMismatches += (invalidSimulator.getSimulationTime() != 0);
+	std::cout << "Invalid durations and time steps: mismatches: " << invalidMismatches << "\n";
+
+	// 4. Speed: simulate() against one call per step with a new control vector
+	auto timeSimulation = [&](auto&& run) {
+		DroneRopeCargoSimulator timedSimulator;
+		initializeSimulator(timedSimulator);
+		auto start = std::chrono::steady_clock::now();
+		run(timedSimulator);
+		auto end = std::chrono::steady_clock::now();
+		return std::chrono::duration<double, std::milli>(end - start).count();
+	};
+	const double timePerCall = timeSimulation([&](DroneRopeCargoSimulator& timedSimulator) {
+		for (int step = 0; step < int(std::lround(timedDuration / timedSimulator.getTimeStep())); step++) {
+			timedSimulator.simulationStep(std::vector<double>{ 49.05, 0.2 });
+		}
+	});
+	const double timeSimulate = timeSimulation([&](DroneRopeCargoSimulator& timedSimulator) {
+		timedSimulator.simulate(timedDuration, { 49.05, 0.2 });
+	});
+
+	std::cout << timedDuration << " s simulated: one call per step " << timePerCall << " ms, simulate() " << timeSimulate << " ms\n";
+
+	// Report
+	const bool passed = (mismatches == 0) && holdPassed && (invalidMismatches == 0);
+	std::cout << (passed ? "PASSED" : "FAILED") << "\n";
+
+	// Exit program
+	return passed ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,192 @@
+// Libraries
+#include "DroneRopeCargoSimulator.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Initializes a simulator with a swinging cargo on a slack rope
+void initializeSimulator(DroneRopeCargoSimulator& simulator, IntegrationType integrationType, bool eventDetection)
+{
+	simulator.setConstantDroneParameters(3, 0.1);			// in [kg], [N s^2 / m^2]
+	simulator.setConstantRopeParameters(1.5, 40000, 50);	// in [m], [N / m], [N s / m]
+	simulator.setConstantCargoParameters(2, 0.1);			// in [kg], [N s^2 / m^2]
+	simulator.setImplementation(true, integrationType);
+	simulator.setEventDetection(eventDetection);
+	simulator.setRestartTolerance(1.0);
+	simulator.setStateArray({ 0, 0, 0, 0, 0, 0.3, -1.4, 1.0, 0 });
+}
+
+// Result of a continued run, compared bit for bit
+struct ContinuedRun {
+	StateArray stateVector{};
+	StateArray interpolatedStateVector{};	// Halfway the last step
+	double simulationTime = 0;
+	std::size_t numberOfRopeEvents = 0;
+	int numberOfRestarts = 0;
+
+	bool operator==(const ContinuedRun& other) const {
+		return (stateVector == other.stateVector) && (interpolatedStateVector == other.interpolatedStateVector) && (simulationTime == other.simulationTime)
+			   && (numberOfRopeEvents == other.numberOfRopeEvents) && (numberOfRestarts == other.numberOfRestarts);
+	}
+};
+
+// Continues a simulator with a control schedule
+ContinuedRun continueRun(DroneRopeCargoSimulator& simulator, const std::vector<ControlScheduleEntry>& controlSchedule)
+{
+	ContinuedRun run;
+	run.stateVector = simulator.simulate(controlSchedule);
+	run.simulationTime = simulator.getSimulationTime();
+	run.interpolatedStateVector = simulator.getInterpolatedStateArray(run.simulationTime - simulator.getTimeStep() / 2);
+	run.numberOfRopeEvents = simulator.getNumberOfRopeEvents();
+	run.numberOfRestarts = simulator.getNumberOfRestarts();
+	return run;
+}
+
+// Median time per call of a function [ns], over batches of calls
+template <typename Function>
+double calculateMedianTime(Function&& function, int numberOfBatches, int callsPerBatch)
+{
+	std::vector<double> batchTimes(numberOfBatches);
+	for (double& batchTime : batchTimes) {
+		auto start = std::chrono::steady_clock::now();
+		for (int call = 0; call < callsPerBatch; call++) {
+			function();
+		}
+		batchTime = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / callsPerBatch;
+	}
+	std::nth_element(batchTimes.begin(), batchTimes.begin() + numberOfBatches / 2, batchTimes.end());
+	return batchTimes[numberOfBatches / 2];
+}
+
+// Main function
+int main()
+{
+	/* ---------------------------------- SETTINGS ---------------------------------- */
+
+	const std::vector<ControlScheduleEntry> firstSchedule = { { 0.3, { 49.05, 0.2 } } };
+	const std::vector<ControlScheduleEntry> secondSchedule = { { 0.1, { 60, -0.4 } }, { 0.2, { 45, 0.1 } } };
+	const std::vector<ControlScheduleEntry> otherSchedule = { { 0.3, { 40, 0.3 } } };
+	const std::vector<std::pair<IntegrationType, std::string>> integrationTypes = {
+		{ IntegrationType::RungeKuttaFourStageOutput, "RK4 (output vector per stage)" }, { IntegrationType::ImplicitRungeKutta, "Implicit RK" },
+		{ IntegrationType::MultiRate, "Multi-rate" }, { IntegrationType::AdamsBashforthMoulton, "Adams-Bashforth-Moulton" }, { IntegrationType::Heun, "Heun" } };
+	const int numberOfBatches = 201;		// Timed batches, of which the median is taken
+	const int callsPerBatch = 5000;
+	const double timeBound = 100;			// Largest median time of restore() and fork() [ns]
+
+	/* ---------------------------------- ACTIONS ---------------------------------- */
+
+	int mismatches = 0;
+	for (const auto& integrationType : integrationTypes) {
+		for (bool eventDetection : { false, true }) {
+			DroneRopeCargoSimulator simulator;
+			initializeSimulator(simulator, integrationType.first, eventDetection);
+			simulator.simulate(firstSchedule);
+
+			// 1. Restore: the continued run is repeated bit for bit
+			const SimulatorSnapshot snapshot = simulator.snapshot();
+			const ContinuedRun run = continueRun(simulator, secondSchedule);
+			simulator.restore(snapshot);
+			const bool restorePassed = (continueRun(simulator, secondSchedule) == run);
+
+			// 2. Checkpoint: written, read and restored into a new simulator
+			std::stringstream stream;
+			DroneRopeCargoSimulator::writeSnapshot(stream, snapshot);
+			SimulatorSnapshot readSimulatorSnapshot;
+			DroneRopeCargoSimulator resumedSimulator;
+			bool checkpointPassed = DroneRopeCargoSimulator::readSnapshot(stream, readSimulatorSnapshot);
+			resumedSimulator.restore(readSimulatorSnapshot);
+			checkpointPassed = checkpointPassed && (continueRun(resumedSimulator, secondSchedule) == run); // Including the number of rope events
+
+			// 3. Fork: the branch continues like the original, and is independent of it
+			simulator.restore(snapshot);
+			DroneRopeCargoSimulator branch;
+			simulator.fork(branch);
+			const ContinuedRun otherRun = continueRun(branch, otherSchedule);
+			const bool forkPassed = (continueRun(simulator, secondSchedule) == run) && !(otherRun == run);
+			simulator.fork(branch);
+			const bool forkAgainPassed = (continueRun(branch, otherSchedule).stateVector == simulator.simulate(otherSchedule));
+
+			const bool passed = restorePassed && checkpointPassed && forkPassed && forkAgainPassed;
+			mismatches += !passed;
+
+			std::cout << integrationType.second << (eventDetection ? ", event detection" : "") << ": xCargo " << run.stateVector[5] << " m, "
+					  << run.numberOfRopeEvents << " rope events" << (passed ? "" : " (MISMATCH)") << "\n";
+		}
+	}
+
+	// 4. Damaged checkpoints are rejected and leave the snapshot unchanged
+	DroneRopeCargoSimulator simulator;
+	initializeSimulator(simulator, IntegrationType::AdamsBashforthMoulton, false);
+	simulator.simulate(firstSchedule);
+	const SimulatorSnapshot snapshot = simulator.snapshot();
+
+	std::stringstream stream;
+	DroneRopeCargoSimulator::writeSnapshot(stream, snapshot);
+	const std::string checkpoint = stream.str();
+	std::string damagedCheckpoint = checkpoint;
+	damagedCheckpoint[0] = 'X';
+
+	SimulatorSnapshot readSimulatorSnapshot;
+	std::stringstream truncatedStream(checkpoint.substr(0, checkpoint.size() - 1)), damagedStream(damagedCheckpoint);
+	const bool damagedPassed = !DroneRopeCargoSimulator::readSnapshot(truncatedStream, readSimulatorSnapshot)
+							   && !DroneRopeCargoSimulator::readSnapshot(damagedStream, readSimulatorSnapshot) && (readSimulatorSnapshot.timeStep == 0);
+
+	// Damaged fields: sizes, ring positions and integration type out of range
+	const std::vector<std::function<void(SimulatorSnapshot&)>> damageFunctions = {
+		[](SimulatorSnapshot& damaged) { damaged.adamsBashforthMoultonHistory.stateSize = 1000; },
+		[](SimulatorSnapshot& damaged) { damaged.adamsBashforthMoultonHistory.stateSize = 6; },
+		[](SimulatorSnapshot& damaged) { damaged.adamsBashforthMoultonHistory.controlSize = 3; },
+		[](SimulatorSnapshot& damaged) { damaged.adamsBashforthMoultonHistory.historyLength = 5; },
+		[](SimulatorSnapshot& damaged) { damaged.adamsBashforthMoultonHistory.historyLength = -1; },
+		[](SimulatorSnapshot& damaged) { damaged.adamsBashforthMoultonHistory.historyIndex = 4; },
+		[](SimulatorSnapshot& damaged) { damaged.adamsBashforthMoultonHistory.historyIndex = -1; },
+		[](SimulatorSnapshot& damaged) { damaged.denseOutputHistory.stateSize = 100; },
+		[](SimulatorSnapshot& damaged) { damaged.integrationType = static_cast<IntegrationType>(42); } };
+	int acceptedFields = 0, nonFiniteRestores = 0;
+	for (const auto& damageFunction : damageFunctions) {
+		SimulatorSnapshot damagedSnapshot = snapshot;
+		damageFunction(damagedSnapshot);
+		std::stringstream damagedFieldStream;
+		DroneRopeCargoSimulator::writeSnapshot(damagedFieldStream, damagedSnapshot);
+		acceptedFields += DroneRopeCargoSimulator::readSnapshot(damagedFieldStream, readSimulatorSnapshot);
+
+		// Restored anyway (not through a checkpoint): the integrators discard the damaged history and keep stepping
+		if (damagedSnapshot.integrationType == IntegrationType::AdamsBashforthMoulton) {
+			DroneRopeCargoSimulator damagedSimulator;
+			damagedSimulator.restore(damagedSnapshot);
+			const StateArray stateVector = damagedSimulator.simulate(secondSchedule);
+			nonFiniteRestores += !std::isfinite(stateVector[5]) || !std::isfinite(damagedSimulator.getInterpolatedStateArray(damagedSimulator.getSimulationTime() - 0.001)[5]);
+		}
+	}
+	const bool damagedFieldsPassed = (acceptedFields == 0) && (nonFiniteRestores == 0) && (readSimulatorSnapshot.timeStep == 0);
+
+	std::cout << "Checkpoint of " << checkpoint.size() << " bytes (snapshot of " << sizeof(SimulatorSnapshot) << " bytes), damaged checkpoints "
+			  << (damagedPassed ? "rejected" : "NOT REJECTED") << ", damaged fields " << damageFunctions.size() - acceptedFields << " of " << damageFunctions.size()
+			  << " rejected\n";
+
+	// 5. Median time per call, compared to copying the simulator
+	SimulatorSnapshot timedSnapshot;
+	DroneRopeCargoSimulator branch, copiedSimulator;
+	simulator.fork(branch);
+
+	const double snapshotTime = calculateMedianTime([&]() { simulator.snapshot(timedSnapshot); }, numberOfBatches, callsPerBatch);
+	const double restoreTime = calculateMedianTime([&]() { branch.restore(timedSnapshot); }, numberOfBatches, callsPerBatch);
+	const double forkTime = calculateMedianTime([&]() { simulator.fork(branch); }, numberOfBatches, callsPerBatch);
+	const double copyTime = calculateMedianTime([&]() { copiedSimulator = simulator; }, numberOfBatches, callsPerBatch);
+	const bool timePassed = (restoreTime < timeBound) && (forkTime < timeBound) && (forkTime < copyTime);
+
+	std::cout << "snapshot() " << snapshotTime << " ns, restore() " << restoreTime << " ns, fork() " << forkTime << " ns, copy of the simulator " << copyTime
+			  << " ns (median; restore() and fork() below " << timeBound << " ns and fork() faster than a copy: " << (timePassed ? "yes" : "NO") << ")\n";
+
+	// Report
+	const bool passed = (mismatches == 0) && damagedPassed && damagedFieldsPassed && timePassed && (branch.getStateArray() == simulator.getStateArray());
+	std::cout << (passed ? "PASSED" : "FAILED") << "\n";
+
+	// Exit program
+	return passed ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,124 @@
+// Libraries
+#include "DroneRopeCargoSimulator.h"
+#include "DroneRopeCargoSimulatorVariant.h"
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+// Sets the parameters of a simulator
+template <typename Simulator>
+void setParameters(Simulator& simulator)
+{
+	simulator.setConstantDroneParameters(3, 0.2);			// in [kg], [N s^2 / m^2]
+	simulator.setConstantRopeParameters(1.5, 1000, 5);	// in [m], [N / m], [N s / m] (stable with constant output vector)
+	simulator.setConstantCargoParameters(2, 0.1);			// in [kg], [N s^2 / m^2]
+}
+
+// Control vector at a step (varying thrust and angular velocity)
+ControlArray getControlArray(int step)
+{
+	return { 49.05 + 5 * sin(0.01 * step), 0.3 * cos(0.02 * step) };
+}
+
+// Steps the facade and DroneRopeCargoSimulator with the same implementation, returns the number of mismatching states
+int compareImplementation(const char* name, bool dynamicsType, IntegrationType integrationType, int numberOfSteps, bool expectSpecialized)
+{
+	// Initialize simulators
+	DroneRopeCargoSimulator simulator;
+	DroneRopeCargoSimulatorVariant variant;
+	setParameters(simulator);
+	setParameters(variant);
+	simulator.setImplementation(dynamicsType, integrationType);
+	variant.setImplementation(dynamicsType, integrationType);
+
+	// Hanging cargo, swinging sideways
+	const StateArray initialStateVector = { 0, 0, 0, 0, 0, 0.3, -1.5, 1.0, 0 };
+	simulator.setStateArray(initialStateVector);
+	simulator.setOutputVector();
+	variant.setStateArray(initialStateVector);
+
+	// Step
+	int mismatches = (variant.isSpecialized() != expectSpecialized) + (simulator.getTimeStep() != variant.getTimeStep());
+	StateArray stateVector{}, variantStateVector{};
+	for (int step = 0; step < numberOfSteps; step++) {
+		simulator.simulationStep(getControlArray(step), stateVector);
+		variant.simulationStep(getControlArray(step), variantStateVector);
+
+		// Without cargo only the drone states are simulated
+		for (std::size_t i = 0; i < (dynamicsType ? 9u : 5u); i++) {
+			mismatches += (stateVector[i] != variantStateVector[i]);
+		}
+	}
+
+	std::cout << name << (dynamicsType ? " (drone with cargo)" : " (drone)") << ": mismatching states: " << mismatches << "\n";
+
+	return mismatches;
+}
+
+// Time per step of a simulator [ns]
+template <typename Simulator>
+double timeSimulationStep(Simulator& simulator, int numberOfSteps, double& checksum)
+{
+	StateArray stateVector{};
+	auto start = std::chrono::steady_clock::now();
+	for (int step = 0; step < numberOfSteps; step++) {
+		simulator.simulationStep(getControlArray(step), stateVector);
+		checksum += stateVector[0]; // Keep result alive
+	}
+	auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::nano>(end - start).count() / numberOfSteps;
+}
+
+// Main function
+int main()
+{
+	/* ---------------------------------- SETTINGS ---------------------------------- */
+
+	const int numberOfSteps = 500;
+	const int numberOfTimedSteps = 200000;
+
+	/* ---------------------------------- ACTIONS ---------------------------------- */
+
+	// 1. The specialized simulators reproduce DroneRopeCargoSimulator bit for bit; the others fall back to it
+	int mismatches = 0;
+	for (bool dynamicsType : { false, true }) {
+		mismatches += compareImplementation("Euler", dynamicsType, IntegrationType::Euler, numberOfSteps, true);
+		mismatches += compareImplementation("RK4", dynamicsType, IntegrationType::RungeKuttaFour, numberOfSteps, true);
+		mismatches += compareImplementation("RK4 (output vector per stage)", dynamicsType, IntegrationType::RungeKuttaFourStageOutput, numberOfSteps, true);
+		mismatches += compareImplementation("Heun", dynamicsType, IntegrationType::Heun, numberOfSteps, true);
+		mismatches += compareImplementation("RK3", dynamicsType, IntegrationType::RungeKuttaThree, numberOfSteps, true);
+		mismatches += compareImplementation("RK4 (3/8-rule)", dynamicsType, IntegrationType::RungeKuttaFourThreeEighths, numberOfSteps, true);
+		mismatches += compareImplementation("SSPRK3", dynamicsType, IntegrationType::StrongStabilityPreservingRungeKuttaThree, numberOfSteps, true);
+		mismatches += compareImplementation("Implicit RK", dynamicsType, IntegrationType::ImplicitRungeKutta, numberOfSteps, false);
+		mismatches += compareImplementation("Adams-Bashforth-Moulton", dynamicsType, IntegrationType::AdamsBashforthMoulton, numberOfSteps, false);
+	}
+
+	// 2. Time per step, drone with cargo (RK4, output vector per stage)
+	double checksum = 0;
+	DroneRopeCargoSimulator simulator;
+	setParameters(simulator);
+	simulator.setImplementation(true, IntegrationType::RungeKuttaFourStageOutput);
+	simulator.setStateArray({ 0, 0, 0, 0, 0, 0.3, -1.5, 1.0, 0 });
+	simulator.setOutputVector();
+
+	SpecializedDroneRopeCargoSimulator<DroneRopeCargoModel, RungeKuttaFourStageOutputIntegrator> specializedSimulator;
+	setParameters(specializedSimulator);
+	specializedSimulator.setStateArray({ 0, 0, 0, 0, 0, 0.3, -1.5, 1.0, 0 });
+
+	SpecializedDroneRopeCargoSimulator<DroneModel, RungeKuttaFourStageOutputIntegrator> specializedDroneSimulator;
+	setParameters(specializedDroneSimulator);
+
+	const double timeRuntime = timeSimulationStep(simulator, numberOfTimedSteps, checksum);
+	const double timeSpecialized = timeSimulationStep(specializedSimulator, numberOfTimedSteps, checksum);
+	const double timeSpecializedDrone = timeSimulationStep(specializedDroneSimulator, numberOfTimedSteps, checksum);
+
+	std::cout << "RK4 (output vector per stage), drone with cargo: runtime-selected " << timeRuntime << " ns/step, specialized " << timeSpecialized
+			  << " ns/step; drone: specialized " << timeSpecializedDrone << " ns/step (checksum " << checksum << ")\n";
+
+	// Report
+	const bool passed = (mismatches == 0);
+	std::cout << (passed ? "PASSED" : "FAILED") << "\n";
+
+	// Exit program
+	return passed ? 0 : 1;
+}
\ No newline at end of file